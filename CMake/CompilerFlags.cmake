@@ -29,6 +29,7 @@ function(set_compiler_flags project_name)
 
     set(CLANG_GCC_FLAGS
             -fms-extensions                 # enable MS extensions (among other things allow anonymous structs)
+            -fno-math-errno                 # sqrt etc. do not set errno, so they can be inlined and vectorized (matches MSVC)
             #            -fvisibility=hidden             # hide symbols by default
             -W
             -Wall                           # set warning level
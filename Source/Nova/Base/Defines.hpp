@@ -46,6 +46,16 @@ static_assert(NOVA_CPLUSPLUS >= 202'002L, "__cplusplus >= 202002L: C++20 at leas
 #define NOVA_NODISCARD       [[nodiscard]]
 #define NOVA_DEPRECATED(...) [[deprecated(__VA_ARGS__)]]
 
+// 编译目标支持 AVX2 时 (GCC/Clang 的 -mavx2，MSVC 的 /arch:AVX2) 启用对应的向量化实现
+#if defined(__AVX2__)
+#  define NOVA_HAS_AVX2
+#endif
+
+// x86-64 总是支持 SSE2，MSVC 不定义 __SSE2__
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define NOVA_HAS_SSE2
+#endif
+
 // Debug & Release
 namespace nova {
 #ifdef NDEBUG
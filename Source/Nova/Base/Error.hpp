@@ -133,15 +133,15 @@ ReportAssertion(const std::source_location& loc, std::string_view cond, std::for
 #  define NOVA_ASSERT(cond, ...)                                                                                       \
       do {                                                                                                             \
           if (!(cond)) {                                                                                               \
-              ::nova::internal::ReportAssertion(std::source_location::current(), #cond, __VA_ARGS__);                \
+              ::nova::internal::ReportAssertion(std::source_location::current(), #cond, ##__VA_ARGS__);                \
           }                                                                                                            \
       } while (0)
 
 #  define NOVA_ASSERT_OP(a, b, OP)                                                                                     \
       do {                                                                                                             \
-          if (!(a OP b)) {                                                                                             \
+          if (!((a) OP (b))) {                                                                                         \
               ::nova::internal::ReportAssertion(std::source_location::current(),                                       \
-                                                std::format("{} {} {} ({} {} {})", #a, #OP, #b, a, #OP, b));           \
+                                                std::format("{} {} {} ({} {} {})", #a, #OP, #b, (a), #OP, (b)));       \
           }                                                                                                            \
       } while (0)
 
@@ -10,6 +10,7 @@
 #include "./Object.hpp"
 #include "./Error.hpp"
 #include "Nova/Utils/Logger.hpp"
+#include "Nova/Utils/StringTable.hpp"
 
 using namespace nova;
 
@@ -58,3 +59,8 @@ void Object::traceAliveObjects()
     for (const auto* object : sTrackedObjects)
         object->traceRefs();
 }
+
+StringId Object::InternTypeName(std::string_view name)
+{
+    return Intern(name);
+}
@@ -8,13 +8,19 @@
 #pragma once
 
 #include <atomic>
+#include <string_view>
+#include <utility>
 #include "./Defines.hpp"
+#include "./StringHash.hpp"
 
 namespace nova {
 
 class NOVA_API Object
 {
 public:
+    static constexpr std::string_view kTypeName = "Object";
+    static constexpr StringId kTypeId           = StringId(kTypeName);
+
     Object() = default;
 
     Object(const Object&) { }
@@ -27,18 +33,38 @@ public:
 
     int refCount() const { return static_cast<int>(_refCount); }
 
-    virtual std::string_view id() const { return "Object"; }
+    virtual std::string_view id() const { return kTypeName; }
+
+    /// 类型 ID，即类名的 StringId，在编译期确定，可以直接用作注册表的键。首次调用时注册类名，之后可以通过 str() 取回
+    virtual StringId typeId() const
+    {
+        static const auto sId = InternTypeName(kTypeName);
+        return sId;
+    }
+
+    /// 是否恰好是类型 T (不考虑派生关系)，只需要比较整数
+    template<typename T> bool is() const { return typeId() == T::kTypeId; }
 
 protected:
     virtual ~Object() = default;
 
+    /// 把类名注册到全局字符串表，返回值与 StringId(name) 相同
+    static StringId InternTypeName(std::string_view name);
+
 private:
     mutable std::atomic_uint32_t _refCount{0};
 };
 
 #define NOVA_OBJECT(class_)                                                                                            \
 public:                                                                                                                \
-    std::string_view id() const override { return #class_; }
+    static constexpr std::string_view kTypeName = #class_;                                                             \
+    static constexpr ::nova::StringId kTypeId   = ::nova::StringId(kTypeName);                                         \
+    std::string_view id() const override { return kTypeName; }                                                         \
+    ::nova::StringId typeId() const override                                                                           \
+    {                                                                                                                  \
+        static const auto sId = InternTypeName(kTypeName);                                                             \
+        return sId;                                                                                                    \
+    }
 
 static inline uint64_t NextRefId()
 {
@@ -0,0 +1,198 @@
+/**
+ * @File StringHash.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "./Defines.hpp"
+
+// wyhash 的字节处理、编译期字符串哈希与 StringId 只依赖 Defines.hpp，供 Base (类型 ID) 与 Math/Hash.hpp 共用
+
+namespace nova {
+
+// -------------------------
+// wyhash
+// https://github.com/wangyi-fudan/wyhash
+// -------------------------
+namespace internal {
+
+NOVA_FUNC constexpr u64 wyRot(u64 x)
+{
+    return (x >> 32) | (x << 32);
+}
+
+NOVA_FUNC constexpr void wyMum(u64* A, u64* B)
+{
+#if defined(__SIZEOF_INT128__)
+    // 一条 64x64 位乘法得到完整的 128 位乘积，与下面的分解结果相同
+    const auto r = static_cast<unsigned __int128>(*A) * *B;
+    *A ^= static_cast<u64>(r);
+    *B ^= static_cast<u64>(r >> 64);
+#else
+    u64 ha = *A >> 32, hb = *B >> 32, la = (uint32_t)*A, lb = (uint32_t)*B, hi, lo;
+    u64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
+    lo  = t + (rm1 << 32);
+    c  += lo < t;
+    hi  = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    *A ^= lo;
+    *B ^= hi;
+#endif
+}
+
+NOVA_FUNC constexpr u64 wyMix(u64 A, u64 B)
+{
+    wyMum(&A, &B);
+    return A ^ B;
+}
+
+/// 读取的字节可以是 u8 或 char；编译期逐字节读取，结果与运行期相同
+template<typename B>
+concept WyByte = std::integral<B> && sizeof(B) == 1;
+
+template<WyByte B> NOVA_FUNC constexpr u64 wyLoad(const B* p, i32 n)
+{
+    u64 v = 0;
+    for (i32 i = 0; i < n; ++i)
+        v |= u64(u8(p[i])) << (std::endian::native == std::endian::little ? 8 * (n - 1 - i) : 8 * i);
+    return v;
+}
+
+template<WyByte B> NOVA_FUNC constexpr u64 wyR8(const B* p)
+{
+    if (std::is_constant_evaluated())
+        return wyLoad(p, 8);
+
+    u64 v;
+    std::memcpy(&v, p, 8);
+    return (((v >> 56) & 0xff) | ((v >> 40) & 0xff00) | ((v >> 24) & 0xff0000) | ((v >> 8) & 0xff000000) |
+            ((v << 8) & 0xff00000000) | ((v << 24) & 0xff0000000000) | ((v << 40) & 0xff000000000000) |
+            ((v << 56) & 0xff00000000000000));
+}
+
+template<WyByte B> NOVA_FUNC constexpr u64 wyR4(const B* p)
+{
+    if (std::is_constant_evaluated())
+        return wyLoad(p, 4);
+
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return (((v >> 24) & 0xff) | ((v >> 8) & 0xff00) | ((v << 8) & 0xff0000) | ((v << 24) & 0xff000000));
+}
+
+template<WyByte B> NOVA_FUNC constexpr u64 wyR3(const B* p, size_t k)
+{
+    return (u64(u8(p[0])) << 16) | (u64(u8(p[k >> 1])) << 8) | u8(p[k - 1]);
+}
+
+template<WyByte B> NOVA_FUNC constexpr u64 wyHashBytes(const B* p, size_t len, u64 seed, const u64* secret)
+{
+    seed ^= internal::wyMix(seed ^ secret[0], secret[1]);
+    u64 a, b;
+    if (len <= 16) {
+        if (len >= 4) {
+            a = (internal::wyR4(p) << 32) | internal::wyR4(p + ((len >> 3) << 2));
+            b = (internal::wyR4(p + len - 4) << 32) | internal::wyR4(p + len - 4 - ((len >> 3) << 2));
+        }
+        else if (len > 0) {
+            a = internal::wyR3(p, len);
+            b = 0;
+        }
+        else
+            a = b = 0;
+    }
+    else {
+        size_t i = len;
+        if (i > 48) {
+            u64 see1 = seed, see2 = seed;
+            do {
+                seed  = internal::wyMix(internal::wyR8(p) ^ secret[1], internal::wyR8(p + 8) ^ seed);
+                see1  = internal::wyMix(internal::wyR8(p + 16) ^ secret[2], internal::wyR8(p + 24) ^ see1);
+                see2  = internal::wyMix(internal::wyR8(p + 32) ^ secret[3], internal::wyR8(p + 40) ^ see2);
+                p    += 48;
+                i    -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed  = internal::wyMix(internal::wyR8(p) ^ secret[1], internal::wyR8(p + 8) ^ seed);
+            i    -= 16;
+            p    += 16;
+        }
+
+        a = internal::wyR8(p + i - 16);
+        b = internal::wyR8(p + i - 8);
+    }
+    a ^= secret[1];
+    b ^= seed;
+    internal::wyMum(&a, &b);
+    return internal::wyMix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+
+} // namespace internal
+
+/// wyhash 默认使用的密钥
+static constexpr u64 kWySecret[4] = {0x2d358dccaa6c78a5ull,
+                                     0x8bb84b93962eacc9ull,
+                                     0x4b33a62ed433d4a3ull,
+                                     0x4d5a2da51de1aa47ull};
+
+/// 字符串的 wyHash，可以在编译期计算 (如类型 ID、资源名称)，结果与 wyHash(s.data(), s.size(), seed) 相同
+NOVA_FUNC constexpr u64 HashString(std::string_view s, u64 seed = 0)
+{
+    return internal::wyHashBytes(s.data(), s.size(), seed, kWySecret);
+}
+
+/**
+ * @brief 字符串的 64 位 ID，即 HashString 的结果。比较、排序与作为哈希表的键都只是整数运算。
+ *
+ * 可以在编译期由字面量构造 (见 _sid)，用作注册表与资源查找的键；
+ * 需要取回原字符串时，先通过 StringTable::intern (或 Intern) 注册，字符串表见 Utils/StringTable.hpp。
+ */
+class StringId
+{
+public:
+    constexpr StringId() = default;
+
+    constexpr explicit StringId(std::string_view s) : _value(HashString(s)) { }
+
+    static constexpr StringId FromValue(u64 value)
+    {
+        StringId id;
+        id._value = value;
+        return id;
+    }
+
+    constexpr u64 value() const { return _value; }
+
+    /// 默认构造的 ID 无效
+    constexpr bool valid() const { return _value != 0; }
+
+    constexpr bool operator==(const StringId&) const  = default;
+    constexpr auto operator<=>(const StringId&) const = default;
+
+    /// 在全局字符串表中查找原字符串，没有注册过时返回空串
+    NOVA_API std::string_view str() const;
+
+private:
+    u64 _value = 0;
+};
+
+namespace literals {
+
+consteval StringId operator""_sid(const char* s, size n)
+{
+    return StringId(std::string_view(s, n));
+}
+
+} // namespace literals
+
+} // namespace nova
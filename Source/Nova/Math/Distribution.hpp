@@ -0,0 +1,399 @@
+/**
+ * @File Distribution.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "./Constants.hpp"
+#include "./Vector.hpp"
+
+namespace nova {
+
+namespace internal {
+
+inline constexpr size kDistributionGrain = 1 << 14;
+
+/// 依次处理各块的策略；Parallel/Distribution.hpp 中的 ParallelChunks 在全局执行器上并行处理
+struct SerialChunks
+{
+    template<typename Func> void operator()(size chunks, Func&& func) const
+    {
+        for (size c = 0; c < chunks; ++c)
+            func(c);
+    }
+};
+
+/// 把 [0, count) 按 kDistributionGrain 切块，交给 chunks 处理。块的划分与策略无关，因此结果也与策略无关
+template<typename Chunks, typename Func> void ForEachDistributionChunk(const Chunks& chunks, size count, Func&& func)
+{
+    const auto n = (count + kDistributionGrain - 1) / kDistributionGrain;
+    chunks(n, [&](size c) { func(c, c * kDistributionGrain, Min(count, (c + 1) * kDistributionGrain)); });
+}
+
+/**
+ * @brief 由 count 个非负权重 weight(i) 构建归一化的 CDF：cdf[0] = 0，cdf[count] = 1。
+ *
+ * 两遍分块扫描：先求各块的部分和，串行求出各块的起点后再写入。累加使用 f64，分块固定，结果与线程数无关。
+ * 权重之和为 0 时退化为均匀分布。
+ *
+ * @return 权重之和
+ */
+template<typename Chunks, typename Weight>
+f64 BuildCdf(const Chunks& chunks, size count, Weight&& weight, std::span<f32> cdf)
+{
+    NOVA_CHECK(cdf.size() == count + 1);
+
+    const auto chunkCount = (count + kDistributionGrain - 1) / kDistributionGrain;
+    std::vector<f64> offsets(chunkCount + 1, 0.0);
+
+    ForEachDistributionChunk(chunks, count, [&](size c, size first, size last) {
+        f64 sum = 0;
+        for (auto i = first; i < last; ++i)
+            sum += weight(i);
+        offsets[c + 1] = sum;
+    });
+
+    for (size c = 0; c < chunkCount; ++c)
+        offsets[c + 1] += offsets[c];
+
+    const auto total = offsets[chunkCount];
+    cdf[0]           = 0;
+
+    if (total > 0) {
+        ForEachDistributionChunk(chunks, count, [&](size c, size first, size last) {
+            auto run = offsets[c];
+            for (auto i = first; i < last; ++i) {
+                run += weight(i);
+                cdf[i + 1] = f32(run / total);
+            }
+        });
+    }
+    else {
+        for (size i = 1; i <= count; ++i)
+            cdf[i] = f32(f64(i) / f64(count));
+    }
+
+    cdf[count] = 1;
+    return total;
+}
+
+} // namespace internal
+
+/**
+ * @brief Walker / Vose 别名表，O(1) 地从离散分布中抽样。
+ *
+ * 每个格子保存自身的概率 p、接受阈值 q 与别名：u 先选中一个格子，剩余部分小于 q 时返回该格子，否则返回别名。
+ * 构建时归一化与格子初始化分块进行，配对过程为 O(n) 的串行扫描。权重取绝对值，全为 0 时为均匀分布。
+ * chunks 为分块的执行策略，传入 ParallelChunks (见 Parallel/Distribution.hpp) 时各块并行处理，结果不变。
+ */
+class AliasTable
+{
+public:
+    AliasTable() = default;
+
+    template<typename Chunks = internal::SerialChunks>
+    explicit AliasTable(std::span<const f32> weights, const Chunks& chunks = {})
+    {
+        const auto n = weights.size();
+        _bins.resize(n);
+        if (n == 0)
+            return;
+
+        std::vector<f64> partial((n + internal::kDistributionGrain - 1) / internal::kDistributionGrain, 0.0);
+        internal::ForEachDistributionChunk(chunks, n, [&](size c, size first, size last) {
+            for (auto i = first; i < last; ++i)
+                partial[c] += Abs(weights[i]);
+        });
+
+        f64 total = 0;
+        for (const auto s : partial)
+            total += s;
+
+        // pHat 为 p * n，平均值为 1；用 f64 保存以减少配对过程中的误差累积
+        std::vector<f64> pHat(n);
+        internal::ForEachDistributionChunk(chunks, n, [&](size, size first, size last) {
+            for (auto i = first; i < last; ++i) {
+                const auto p = total > 0 ? Abs(weights[i]) / total : 1.0 / f64(n);
+                _bins[i].p   = f32(p);
+                pHat[i]      = p * f64(n);
+            }
+        });
+
+        std::vector<u32> under, over;
+        for (size i = 0; i < n; ++i)
+            (pHat[i] < 1.0 ? under : over).push_back(u32(i));
+
+        while (!under.empty() && !over.empty()) {
+            const auto s = under.back(), l = over.back();
+            under.pop_back();
+            over.pop_back();
+
+            _bins[s].q     = f32(pHat[s]);
+            _bins[s].alias = l;
+
+            // l 把 1 - pHat[s] 的概率让给 s 所在的格子
+            pHat[l] -= 1.0 - pHat[s];
+            (pHat[l] < 1.0 ? under : over).push_back(l);
+        }
+
+        // 剩下的格子由于舍入误差与 1 略有偏差，直接取 1
+        for (const auto i : under)
+            _bins[i] = {1.f, _bins[i].p, i};
+        for (const auto i : over)
+            _bins[i] = {1.f, _bins[i].p, i};
+    }
+
+    NOVA_FUNC size count() const { return _bins.size(); }
+
+    NOVA_FUNC f32 pmf(u32 index) const { return _bins[index].p; }
+
+    /**
+     * @brief 抽取一个下标。
+     *
+     * @param pmf 该下标的概率
+     * @param uRemapped 剩余的随机性重新映射到 [0, 1)，可以继续用于后续的抽样
+     */
+    NOVA_FUNC u32 sample(f32 u, f32& pmf, f32& uRemapped) const
+    {
+        NOVA_ASSERT(!_bins.empty());
+
+        const auto n      = f32(_bins.size());
+        const auto offset = Min(u32(u * n), u32(_bins.size() - 1));
+        const auto up     = Min(u * n - f32(offset), kFloatOneMinusEpsilon);
+
+        const auto& bin = _bins[offset];
+        if (up < bin.q) {
+            pmf       = bin.p;
+            uRemapped = Min(up / bin.q, kFloatOneMinusEpsilon);
+            return offset;
+        }
+
+        pmf       = _bins[bin.alias].p;
+        uRemapped = Min((up - bin.q) / (1.f - bin.q), kFloatOneMinusEpsilon);
+        return bin.alias;
+    }
+
+    NOVA_FUNC u32 sample(f32 u) const
+    {
+        f32 pmf, uRemapped;
+        return sample(u, pmf, uRemapped);
+    }
+
+private:
+    struct Bin
+    {
+        f32 q = 0;
+        f32 p = 0;
+        u32 alias = 0;
+    };
+
+    std::vector<Bin> _bins;
+};
+
+/**
+ * @brief 定义域 [min, max] 上的分段常数分布，按函数值的比例抽样。
+ *
+ * 查找时先用引导表 (guide table，Chen & Asau 的 cutpoint 方法) 把 u 定位到很少的几个区间，再在其中二分查找，
+ * 期望的查找长度为常数；CDF 按块构建，chunks 的含义与 AliasTable 相同。函数值取绝对值，全为 0 时为均匀分布。
+ */
+class PiecewiseConstant1D
+{
+public:
+    PiecewiseConstant1D() = default;
+
+    template<typename Chunks = internal::SerialChunks>
+    explicit PiecewiseConstant1D(std::span<const f32> f, f32 min = 0, f32 max = 1, const Chunks& chunks = {}) :
+        _func(f.size()), _cdf(f.size() + 1), _min(min), _max(max)
+    {
+        NOVA_CHECK(!f.empty() && max > min);
+
+        const auto n = f.size();
+        internal::ForEachDistributionChunk(chunks, n, [&](size, size first, size last) {
+            for (auto i = first; i < last; ++i)
+                _func[i] = Abs(f[i]);
+        });
+
+        const auto total = internal::BuildCdf(chunks, n, [&](size i) { return f64(_func[i]); }, _cdf);
+        _funcInt         = f32(total * f64(max - min) / f64(n));
+
+        // _guide[j] 为满足 cdf[i] <= j / n 的最大区间 i
+        _guide.resize(n + 1);
+        size i = 0;
+        for (size j = 0; j <= n; ++j) {
+            const auto t = f32(f64(j) / f64(n));
+            while (i + 1 < n && _cdf[i + 1] <= t)
+                ++i;
+            _guide[j] = u32(i);
+        }
+    }
+
+    NOVA_FUNC size count() const { return _func.size(); }
+
+    /// 函数在定义域上的积分
+    NOVA_FUNC f32 integral() const { return _funcInt; }
+
+    NOVA_FUNC f32 min() const { return _min; }
+
+    NOVA_FUNC f32 max() const { return _max; }
+
+    NOVA_FUNC std::span<const f32> func() const { return _func; }
+
+    /**
+     * @brief 按函数值的比例在定义域内抽取一点。
+     *
+     * @param pdf 该点的概率密度
+     * @param offset 该点所在的区间
+     */
+    NOVA_FUNC f32 sample(f32 u, f32& pdf, u32& offset) const
+    {
+        offset = find(u);
+
+        auto du          = u - _cdf[offset];
+        const auto width = _cdf[offset + 1] - _cdf[offset];
+        if (width > 0)
+            du /= width;
+
+        pdf = _funcInt > 0 ? _func[offset] / _funcInt : 1.f / (_max - _min);
+        return Lerp(_min, _max, Min((f32(offset) + du) / f32(count()), kFloatOneMinusEpsilon));
+    }
+
+    NOVA_FUNC f32 sample(f32 u, f32& pdf) const
+    {
+        u32 offset;
+        return sample(u, pdf, offset);
+    }
+
+    /// 定义域内一点的概率密度
+    NOVA_FUNC f32 pdf(f32 x) const
+    {
+        if (_funcInt <= 0)
+            return 1.f / (_max - _min);
+
+        const auto t = (x - _min) / (_max - _min) * f32(count());
+        return _func[Clamp(i64(t), i64(0), i64(count() - 1))] / _funcInt;
+    }
+
+    /**
+     * @brief 把区间当作离散事件抽样，概率正比于函数值。
+     *
+     * @param pmf 选中区间的概率
+     * @param uRemapped 剩余的随机性重新映射到 [0, 1)
+     */
+    NOVA_FUNC u32 sampleDiscrete(f32 u, f32& pmf, f32& uRemapped) const
+    {
+        const auto offset = find(u);
+        const auto width  = _cdf[offset + 1] - _cdf[offset];
+
+        pmf       = width;
+        uRemapped = width > 0 ? Min((u - _cdf[offset]) / width, kFloatOneMinusEpsilon) : 0.f;
+        return offset;
+    }
+
+    NOVA_FUNC f32 pmf(u32 offset) const { return _cdf[offset + 1] - _cdf[offset]; }
+
+private:
+    /// 满足 cdf[i] <= u 的最大区间 i，概率为 0 的区间不会被选中
+    NOVA_FUNC u32 find(f32 u) const
+    {
+        const auto n = count();
+        auto       j = Min(nova::size(u * f32(n)), n - 1);
+
+        // cdf[guide[j]] <= j / n <= u < (j + 1) / n，答案位于 [guide[j], guide[j + 1]] 之间；
+        // u * n 的舍入可能让 j 偏离一格，此时向相邻的格子修正
+        while (j > 0 && _cdf[_guide[j]] > u)
+            --j;
+        while (j + 1 < n && _cdf[_guide[j + 1] + 1] <= u)
+            ++j;
+
+        const auto first = _cdf.begin() + _guide[j] + 1;
+        const auto last  = _cdf.begin() + _guide[j + 1] + 1;
+        return u32(std::upper_bound(first, last, u) - _cdf.begin() - 1);
+    }
+
+    std::vector<f32> _func;
+    std::vector<f32> _cdf;
+    std::vector<u32> _guide;
+    f32 _min     = 0;
+    f32 _max     = 1;
+    f32 _funcInt = 0;
+};
+
+/**
+ * @brief [0, 1]^2 上的分段常数分布，用于按亮度对环境贴图等二维函数抽样。
+ *
+ * 先由各行的积分构成的边缘分布抽取 v，再由该行的条件分布抽取 u。函数按行存放，共 nv 行、每行 nu 个值；
+ * 各行的条件分布按若干行一块构建，chunks 的含义与 AliasTable 相同。
+ */
+class PiecewiseConstant2D
+{
+public:
+    PiecewiseConstant2D() = default;
+
+    template<typename Chunks = internal::SerialChunks>
+    PiecewiseConstant2D(std::span<const f32> func, u32 nu, u32 nv, const Chunks& chunks = {})
+    {
+        NOVA_CHECK(nu > 0 && nv > 0 && func.size() == size(nu) * nv);
+
+        _conditional.resize(nv);
+
+        const auto rows = Max<size>(1, internal::kDistributionGrain / nu);
+        chunks((nv + rows - 1) / rows, [&](size c) {
+            for (auto v = c * rows; v < Min<size>(nv, (c + 1) * rows); ++v)
+                _conditional[v] = PiecewiseConstant1D(func.subspan(v * nu, nu));
+        });
+
+        std::vector<f32> marginal(nv);
+        for (u32 v = 0; v < nv; ++v)
+            marginal[v] = _conditional[v].integral();
+        _marginal = PiecewiseConstant1D(marginal);
+    }
+
+    NOVA_FUNC f32 integral() const { return _marginal.integral(); }
+
+    NOVA_FUNC uint2 resolution() const { return {u32(_conditional[0].count()), u32(_marginal.count())}; }
+
+    /**
+     * @brief 按函数值的比例抽取一点。
+     *
+     * @param pdf 该点在 [0, 1]^2 上的概率密度
+     * @param offset 该点所在的格子
+     */
+    NOVA_FUNC float2 sample(const float2& u, f32& pdf, uint2& offset) const
+    {
+        f32 pdfs[2];
+        const auto y = _marginal.sample(u.y, pdfs[1], offset.y);
+        const auto x = _conditional[offset.y].sample(u.x, pdfs[0], offset.x);
+
+        pdf = pdfs[0] * pdfs[1];
+        return {x, y};
+    }
+
+    NOVA_FUNC float2 sample(const float2& u, f32& pdf) const
+    {
+        uint2 offset;
+        return sample(u, pdf, offset);
+    }
+
+    NOVA_FUNC f32 pdf(const float2& p) const
+    {
+        const auto res = resolution();
+        const auto iu  = Clamp(i64(p.x * f32(res.x)), i64(0), i64(res.x - 1));
+        const auto iv  = Clamp(i64(p.y * f32(res.y)), i64(0), i64(res.y - 1));
+
+        const auto total = _marginal.integral();
+        return total > 0 ? _conditional[iv].func()[iu] / total : 1.f;
+    }
+
+private:
+    std::vector<PiecewiseConstant1D> _conditional;
+    PiecewiseConstant1D _marginal;
+};
+
+} // namespace nova
@@ -8,4 +8,14 @@
 #pragma once
 
 #include "./Geometry/Bounds.hpp"
+#include "./Geometry/ClosestPoint.hpp"
+#include "./Geometry/Delaunay.hpp"
 #include "./Geometry/Frame.hpp"
+#include "./Geometry/Gjk.hpp"
+#include "./Geometry/Obb.hpp"
+#include "./Geometry/Predicates.hpp"
+#include "./Geometry/SoA.hpp"
+#include "./Geometry/SphereSoA.hpp"
+#include "./Geometry/SweepAndPrune.hpp"
+#include "./Geometry/Triangle.hpp"
+#include "./Geometry/Warp.hpp"
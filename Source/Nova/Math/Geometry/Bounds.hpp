@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <array>
+#include <span>
+
 #include "../Vector.hpp"
 #include "../Matrix.hpp"
 #include "../Constants.hpp"
@@ -62,9 +65,9 @@ template<i32 N> struct bounds
 
     NOVA_FUNC f32 radius() const { return 0.5f * Length(extent()); }
 
-    NOVA_FUNC i32 shortestAxis() const { return minIndex(extent()); }
+    NOVA_FUNC i32 shortestAxis() const { return MinIndex(extent()); }
 
-    NOVA_FUNC i32 longestAxis() const { return maxIndex(extent()); }
+    NOVA_FUNC i32 longestAxis() const { return MaxIndex(extent()); }
 
     // @formatter:on
 
@@ -181,10 +184,10 @@ template<i32 N> NOVA_FUNC f32 DistanceSqr(const bounds<N>& b, const vec<N, f32>&
 
     for (i32 i = 0; i < N; ++i) {
         f32 val = 0.f;
-        if (p[i] < b.b.minPoint[i])
-            val = f32(b.b.minPoint[i] - p[i]);
-        else if (p[i] > b.b.maxPoint[i])
-            val = f32(p[i] - b.b.maxPoint[i]);
+        if (p[i] < b.minPoint[i])
+            val = f32(b.minPoint[i] - p[i]);
+        else if (p[i] > b.maxPoint[i])
+            val = f32(p[i] - b.maxPoint[i]);
 
         res += val * val;
     }
@@ -213,10 +216,10 @@ template<i32 N> NOVA_FUNC f32 DistanceSqr(const bounds<N>& b1, const bounds<N>&
 
     for (i32 i = 0; i < N; ++i) {
         f32 val = 0.f;
-        if (b2.b.maxPoint[i] < b1.b.minPoint[i])
-            val = f32(b1.b.minPoint[i] - b2.b.maxPoint[i]);
-        else if (b2.b.minPoint[i] > b1.b.maxPoint[i])
-            val = f32(b2.b.minPoint[i] - b2.b.maxPoint[i]);
+        if (b2.maxPoint[i] < b1.minPoint[i])
+            val = f32(b1.minPoint[i] - b2.maxPoint[i]);
+        else if (b2.minPoint[i] > b1.maxPoint[i])
+            val = f32(b2.minPoint[i] - b1.maxPoint[i]);
 
         res += val * val;
     }
@@ -331,4 +334,135 @@ NOVA_FUNC bool RayIntersect(const aabb& b, const Ray& r, Float& nearT, Float& fa
     return r.tMin <= farT && nearT <= r.tMax;
 }
 
-} // namespace nova
\ No newline at end of file
+// -------------------------
+// 批量计算
+//
+// 数据按分量展平为连续的 f32 数组，每次处理若干个元素并分别累积到独立的通道中，最后再把通道合并。
+// 各通道的 min / max 互不依赖，内层循环直接对应 SIMD 的 min / max 指令。按块并行的版本见 Parallel/Bounds.hpp。
+// -------------------------
+
+namespace internal {
+
+/**
+ * @brief 对每 Stride 个 f32 组成的元素分别求各分量的最小值与最大值，结果写入 lo / hi。
+ */
+template<size Stride>
+NOVA_FUNC void MinMaxStrided(const f32* data, size count, std::array<f32, Stride>& lo, std::array<f32, Stride>& hi)
+{
+    // 8 个元素为一组，组内每个 f32 对应一个独立的累积通道
+    constexpr size kGroup = 8;
+    constexpr size kLanes = Stride * kGroup;
+
+    std::array<f32, kLanes> mn, mx;
+    mn.fill(kInfinity);
+    mx.fill(-kInfinity);
+
+    const auto full = count / kGroup * kLanes;
+    for (size i = 0; i < full; i += kLanes) {
+        for (size j = 0; j < kLanes; ++j) {
+            const auto v = data[i + j];
+            mn[j]        = v < mn[j] ? v : mn[j];
+            mx[j]        = v > mx[j] ? v : mx[j];
+        }
+    }
+
+    for (size j = 0; j < Stride; ++j) {
+        lo[j] = kInfinity;
+        hi[j] = -kInfinity;
+        for (size g = 0; g < kGroup; ++g) {
+            lo[j] = Min(lo[j], mn[g * Stride + j]);
+            hi[j] = Max(hi[j], mx[g * Stride + j]);
+        }
+    }
+
+    for (size i = full; i < count * Stride; ++i) {
+        lo[i % Stride] = Min(lo[i % Stride], data[i]);
+        hi[i % Stride] = Max(hi[i % Stride], data[i]);
+    }
+}
+
+template<i32 N> NOVA_FUNC bounds<N> ComputeBounds(std::span<const vec<N, f32>> points)
+{
+    static_assert(sizeof(vec<N, f32>) == N * sizeof(f32));
+
+    using point_type = typename bounds<N>::point_type;
+
+    bounds<N> b(point_type(kInfinity), point_type(-kInfinity));
+    if (points.empty())
+        return b;
+
+    std::array<f32, N> lo, hi;
+    MinMaxStrided<N>(&points[0][0], points.size(), lo, hi);
+
+    for (i32 i = 0; i < N; ++i) {
+        b.minPoint[i] = lo[i];
+        b.maxPoint[i] = hi[i];
+    }
+    return b;
+}
+
+template<i32 N> NOVA_FUNC bounds<N> UnionBounds(std::span<const bounds<N>> boxes)
+{
+    static_assert(sizeof(bounds<N>) == 2 * N * sizeof(f32));
+
+    using point_type = typename bounds<N>::point_type;
+
+    bounds<N> b(point_type(kInfinity), point_type(-kInfinity));
+    if (boxes.empty())
+        return b;
+
+    // 每个 bounds 展平为 2N 个 f32，前 N 个取最小值、后 N 个取最大值
+    std::array<f32, 2 * N> lo, hi;
+    MinMaxStrided<2 * N>(&boxes[0].minPoint[0], boxes.size(), lo, hi);
+
+    for (i32 i = 0; i < N; ++i) {
+        b.minPoint[i] = lo[i];
+        b.maxPoint[i] = hi[N + i];
+    }
+    return b;
+}
+
+} // namespace internal
+
+/**
+ * @brief 包住所有点的包围盒，与逐个 include 的结果相同。points 为空时返回 minPoint > maxPoint 的空包围盒。
+ */
+NOVA_FUNC aabb ComputeBounds(std::span<const float3> points) { return internal::ComputeBounds<3>(points); }
+
+NOVA_FUNC rect ComputeBounds(std::span<const float2> points) { return internal::ComputeBounds<2>(points); }
+
+/**
+ * @brief 所有包围盒的并集，与逐个 include 的结果相同。boxes 为空时返回 minPoint > maxPoint 的空包围盒。
+ */
+NOVA_FUNC aabb UnionBounds(std::span<const aabb> boxes) { return internal::UnionBounds<3>(boxes); }
+
+NOVA_FUNC rect UnionBounds(std::span<const rect> boxes) { return internal::UnionBounds<2>(boxes); }
+
+/**
+ * @brief 对每个包围盒调用 TransformAABB，结果与逐个调用完全一致 (包括无效的包围盒变换为默认值)。
+ *
+ * out 可以与 boxes 是同一块内存。
+ */
+NOVA_FUNC void TransformAABBs(const mat4x4_t<Float>& m, std::span<const aabb> boxes, std::span<aabb> out)
+{
+    NOVA_CHECK(out.size() >= boxes.size());
+
+    const auto c0 = GetColumn(m, 0).xyz(), c1 = GetColumn(m, 1).xyz();
+    const auto c2 = GetColumn(m, 2).xyz(), c3 = GetColumn(m, 3).xyz();
+
+    for (size i = 0; i < boxes.size(); ++i) {
+        const auto b = boxes[i];
+
+        // 与 TransformAABB 相同的运算顺序，但不在循环中提前返回
+        const auto xa = c0 * b.minPoint.x, xb = c0 * b.maxPoint.x;
+        const auto ya = c1 * b.minPoint.y, yb = c1 * b.maxPoint.y;
+        const auto za = c2 * b.minPoint.z, zb = c2 * b.maxPoint.z;
+
+        const auto lo = Min(xa, xb) + Min(ya, yb) + Min(za, zb) + c3;
+        const auto hi = Max(xa, xb) + Max(ya, yb) + Max(za, zb) + c3;
+
+        out[i] = b.valid() ? aabb(lo, hi) : aabb{};
+    }
+}
+
+} // namespace nova
@@ -0,0 +1,403 @@
+/**
+ * @File ClosestPoint.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "./Bounds.hpp"
+#include "./Obb.hpp"
+#include "./SoA.hpp"
+
+namespace nova {
+
+// -------------------------
+// 单个查询
+// -------------------------
+
+/**
+ * @brief 点 p 到三角形 abc 的最近点 (Ericson, Real-Time Collision Detection 5.1.5)。
+ *
+ * @param uvw 最近点的重心坐标，最近点为 a * uvw.x + b * uvw.y + c * uvw.z
+ */
+NOVA_FUNC float3 ClosestPointOnTriangle(const float3& p, const float3& a, const float3& b, const float3& c, float3& uvw)
+{
+    const auto ab = b - a, ac = c - a, ap = p - a;
+
+    const auto d1 = Dot(ab, ap), d2 = Dot(ac, ap);
+    if (d1 <= 0.f && d2 <= 0.f) {
+        uvw = {1.f, 0.f, 0.f};
+        return a;
+    }
+
+    const auto bp = p - b;
+    const auto d3 = Dot(ab, bp), d4 = Dot(ac, bp);
+    if (d3 >= 0.f && d4 <= d3) {
+        uvw = {0.f, 1.f, 0.f};
+        return b;
+    }
+
+    const auto vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+        const auto v = d1 / (d1 - d3);
+        uvw          = {1.f - v, v, 0.f};
+        return a + ab * v;
+    }
+
+    const auto cp = p - c;
+    const auto d5 = Dot(ab, cp), d6 = Dot(ac, cp);
+    if (d6 >= 0.f && d5 <= d6) {
+        uvw = {0.f, 0.f, 1.f};
+        return c;
+    }
+
+    const auto vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+        const auto w = d2 / (d2 - d6);
+        uvw          = {1.f - w, 0.f, w};
+        return a + ac * w;
+    }
+
+    const auto va = d3 * d6 - d5 * d4;
+    if (va <= 0.f && d4 - d3 >= 0.f && d5 - d6 >= 0.f) {
+        const auto w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        uvw          = {0.f, 1.f - w, w};
+        return b + (c - b) * w;
+    }
+
+    // 退化 (共线) 的三角形上述区域判定不可靠，退化为求三条边上最近的点
+    const auto sum = va + vb + vc;
+    if (sum <= kMachineEpsilon * LengthSqr(ab) * LengthSqr(ac)) {
+        const auto bc = c - b;
+        const auto tab = Clamp(d1 / Max(Dot(ab, ab), kFloatMin), 0.f, 1.f);
+        const auto tac = Clamp(d2 / Max(Dot(ac, ac), kFloatMin), 0.f, 1.f);
+        const auto tbc = Clamp(Dot(bp, bc) / Max(Dot(bc, bc), kFloatMin), 0.f, 1.f);
+
+        const auto qab = a + ab * tab, qac = a + ac * tac, qbc = b + bc * tbc;
+        const auto dab = LengthSqr(p - qab), dac = LengthSqr(p - qac), dbc = LengthSqr(p - qbc);
+
+        if (dab <= dac && dab <= dbc) {
+            uvw = {1.f - tab, tab, 0.f};
+            return qab;
+        }
+        if (dac <= dbc) {
+            uvw = {1.f - tac, 0.f, tac};
+            return qac;
+        }
+        uvw = {0.f, 1.f - tbc, tbc};
+        return qbc;
+    }
+
+    const auto v = vb / sum;
+    const auto w = vc / sum;
+    uvw          = {1.f - v - w, v, w};
+    return a + ab * v + ac * w;
+}
+
+NOVA_FUNC float3 ClosestPointOnTriangle(const float3& p, const float3& a, const float3& b, const float3& c)
+{
+    float3 uvw;
+    return ClosestPointOnTriangle(p, a, b, c, uvw);
+}
+
+NOVA_FUNC f32 DistanceSqrToTriangle(const float3& p, const float3& a, const float3& b, const float3& c)
+{
+    return LengthSqr(p - ClosestPointOnTriangle(p, a, b, c));
+}
+
+/**
+ * @brief 点 p 到线段 ab 的最近点，t 为其在线段上的参数。
+ */
+NOVA_FUNC float3 ClosestPointOnSegment(const float3& p, const float3& a, const float3& b, f32& t)
+{
+    const auto ab  = b - a;
+    const auto len = LengthSqr(ab);
+    t              = len > 0.f ? Clamp(Dot(p - a, ab) / len, 0.f, 1.f) : 0.f;
+    return a + ab * t;
+}
+
+struct SegmentClosestPoints
+{
+    float3 pointA{0.f};  ///< 第一条线段上的最近点
+    float3 pointB{0.f};  ///< 第二条线段上的最近点
+    f32 s = 0;           ///< pointA 在第一条线段上的参数
+    f32 t = 0;           ///< pointB 在第二条线段上的参数
+    f32 distanceSqr = 0; ///< 两点距离的平方
+};
+
+namespace internal {
+
+/// 两条线段 p1 + s * d1 与 p2 + t * d2 之间的最近参数，线段退化为点时同样适用。只用选择而没有分支，批量查询时不会因数据不同而分支预测失败
+NOVA_FUNC void SegmentSegmentParams(const float3& p1, const float3& d1, const float3& p2, const float3& d2, f32& s, f32& t)
+{
+    const auto r = p1 - p2;
+    const auto a = Dot(d1, d1), e = Dot(d2, d2);
+    const auto b = Dot(d1, d2), c = Dot(d1, r), f = Dot(d2, r);
+
+    const auto invA = a > 0.f ? 1.f / a : 0.f;
+    const auto invE = e > 0.f ? 1.f / e : 0.f;
+
+    // 平行时 denom 为 0，任取 s = 0，再由 t 的截断修正
+    const auto denom = a * e - b * b;
+    s                = denom > kMachineEpsilon * a * e ? Clamp((b * f - c * e) / denom, 0.f, 1.f) : 0.f;
+
+    const auto tn = (b * s + f) * invE;
+    t             = Clamp(tn, 0.f, 1.f);
+
+    // t 被截断 (或第二条线段退化为点) 时，s 需要按 t 重新求最近值
+    const auto sFromT = Clamp((b * t - c) * invA, 0.f, 1.f);
+    s                 = tn == t && e > 0.f ? s : sFromT;
+}
+
+} // namespace internal
+
+/**
+ * @brief 线段 p1q1 与线段 p2q2 之间的最近点对 (Ericson, Real-Time Collision Detection 5.1.9)。
+ */
+NOVA_FUNC SegmentClosestPoints ClosestPointsOnSegments(const float3& p1, const float3& q1, const float3& p2, const float3& q2)
+{
+    SegmentClosestPoints r;
+    internal::SegmentSegmentParams(p1, q1 - p1, p2, q2 - p2, r.s, r.t);
+
+    r.pointA      = p1 + (q1 - p1) * r.s;
+    r.pointB      = p2 + (q2 - p2) * r.t;
+    r.distanceSqr = LengthSqr(r.pointA - r.pointB);
+    return r;
+}
+
+NOVA_FUNC float3 ClosestPoint(const aabb& b, const float3& p) { return Clamp(p, float3(b.minPoint), float3(b.maxPoint)); }
+
+NOVA_FUNC float3 ClosestPoint(const obb& b, const float3& p)
+{
+    return b.toWorld(Clamp(b.toLocal(p), -b.halfExtents, b.halfExtents));
+}
+
+NOVA_FUNC f32 DistanceSqr(const obb& b, const float3& p)
+{
+    const auto local = b.toLocal(p);
+    return LengthSqr(local - Clamp(local, -b.halfExtents, b.halfExtents));
+}
+
+// -------------------------
+// 网格
+// -------------------------
+
+struct MeshClosestPoint
+{
+    float3 point{0.f};
+    u32 triangle    = ~0u;       ///< 最近点所在三角形在输入中的编号，没有找到时为 ~0u
+    f32 distanceSqr = kInfinity;
+
+    NOVA_FUNC bool valid() const { return triangle != ~0u; }
+};
+
+namespace internal {
+
+/**
+ * @brief 无分支的点到三角形最近点。
+ *
+ * 投影落在三角形内部时取投影点，否则取三条边上最近点中最近的一个。
+ * 比 Ericson 的区域判定多做一些计算，但没有分支，批量查询时每个点的开销相同。
+ */
+NOVA_FUNC float3 ClosestPointOnTriangleBranchless(const float3& p, const float3& a, const float3& ab, const float3& ac)
+{
+    const auto ap  = p - a;
+    const auto d00 = Dot(ab, ab), d01 = Dot(ab, ac), d11 = Dot(ac, ac);
+    const auto d20 = Dot(ap, ab), d21 = Dot(ap, ac);
+
+    const auto denom  = d00 * d11 - d01 * d01;
+    const auto inv    = 1.f / Max(denom, kFloatMin);
+    const auto v      = (d11 * d20 - d01 * d21) * inv;
+    const auto w      = (d00 * d21 - d01 * d20) * inv;
+    const auto inside = (v >= 0.f) & (w >= 0.f) & (v + w <= 1.f) & (denom > kMachineEpsilon * d00 * d11);
+
+    const auto bc  = ac - ab;
+    const auto tab = Clamp(d20 / Max(d00, kFloatMin), 0.f, 1.f);
+    const auto tac = Clamp(d21 / Max(d11, kFloatMin), 0.f, 1.f);
+    const auto tbc = Clamp(Dot(ap - ab, bc) / Max(Dot(bc, bc), kFloatMin), 0.f, 1.f);
+
+    const auto qab = a + ab * tab;
+    const auto qac = a + ac * tac;
+    const auto qbc = a + ab + bc * tbc;
+
+    const auto dab = LengthSqr(p - qab), dac = LengthSqr(p - qac), dbc = LengthSqr(p - qbc);
+
+    auto edge = dac < dab ? qac : qab;
+    edge      = dbc < Min(dab, dac) ? qbc : edge;
+
+    return inside ? a + ab * v + ac * w : edge;
+}
+
+/// 将 10 位整数的各位间隔两位展开
+NOVA_FUNC u32 SpreadBits3(u32 v)
+{
+    v = (v | (v << 16)) & 0x030000FFu;
+    v = (v | (v << 8)) & 0x0300F00Fu;
+    v = (v | (v << 4)) & 0x030C30C3u;
+    v = (v | (v << 2)) & 0x09249249u;
+    return v;
+}
+
+} // namespace internal
+
+/**
+ * @brief 为最近点查询准备的 SoA 三角形集合。
+ *
+ * 三角形按重心的 Morton 码排序后每 kBlock 个分为一块，顶点以 a、b - a、c - a 逐分量连续存放。
+ * 查询时先用块的包围盒与当前最近距离剪枝，未被剪掉的块内各三角形的距离无分支地一起计算。
+ * 不构建 BVH，适合中小规模的网格或需要频繁重建的场合。
+ */
+class TriangleSoA
+{
+public:
+    static constexpr size kBlock = 8;
+
+    TriangleSoA() = default;
+
+    TriangleSoA(std::span<const u32> indices, std::span<const float3> positions)
+    {
+        NOVA_CHECK(indices.size() % 3 == 0);
+
+        const auto n = indices.size() / 3;
+        if (n == 0)
+            return;
+
+        std::vector<float3> centroids(n);
+        for (size t = 0; t < n; ++t)
+            centroids[t] = (positions[indices[t * 3]] + positions[indices[t * 3 + 1]] + positions[indices[t * 3 + 2]]) / 3.f;
+
+        aabb bounds(centroids[0]);
+        for (const auto& c : centroids)
+            bounds.include(c);
+
+        const auto extent = Max(float3(bounds.extent()), float3(kFloatMin));
+        std::vector<u32> codes(n);
+        for (size t = 0; t < n; ++t) {
+            const auto q = uint3(Clamp((centroids[t] - float3(bounds.minPoint)) / extent * 1023.f, float3(0.f), float3(1023.f)));
+            codes[t]     = internal::SpreadBits3(q.x) | (internal::SpreadBits3(q.y) << 1) | (internal::SpreadBits3(q.z) << 2);
+        }
+
+        _triangles.resize(n);
+        std::iota(_triangles.begin(), _triangles.end(), 0u);
+        std::stable_sort(_triangles.begin(), _triangles.end(), [&](u32 l, u32 r) { return codes[l] < codes[r]; });
+
+        // 填充到整块，多出的位置重复最后一个三角形，距离相同不会改变结果
+        const auto padded = (n + kBlock - 1) / kBlock * kBlock;
+        for (auto& c : _data)
+            c.resize(padded);
+        _blocks.resize(padded / kBlock);
+
+        for (size i = 0; i < padded; ++i) {
+            const auto t = _triangles[Min(i, n - 1)];
+            const auto a = positions[indices[t * 3]];
+            const auto b = positions[indices[t * 3 + 1]];
+            const auto c = positions[indices[t * 3 + 2]];
+
+            store(i, a, b - a, c - a);
+
+            auto& box = _blocks[i / kBlock];
+            if (i % kBlock == 0)
+                box = aabb(a);
+            box.include(a);
+            box.include(b);
+            box.include(c);
+        }
+    }
+
+    /// 三角形数量
+    NOVA_FUNC size count() const { return _triangles.size(); }
+
+    /**
+     * @brief 查找点 p 在网格上的最近点，只考虑距离平方小于 maxDistanceSqr 的三角形。
+     */
+    MeshClosestPoint closestPoint(const float3& p, f32 maxDistanceSqr = kInfinity) const
+    {
+        MeshClosestPoint result;
+        result.distanceSqr = maxDistanceSqr;
+
+        size best = ~size(0);
+        std::array<f32, kBlock> dist;
+
+        for (size blk = 0; blk < _blocks.size(); ++blk) {
+            if (DistanceSqr(_blocks[blk], p) >= result.distanceSqr)
+                continue;
+
+            const auto base = blk * kBlock;
+            for (size k = 0; k < kBlock; ++k)
+                dist[k] = LengthSqr(p - closestInSlot(base + k, p));
+
+            for (size k = 0; k < kBlock; ++k) {
+                if (dist[k] < result.distanceSqr) {
+                    result.distanceSqr = dist[k];
+                    best               = base + k;
+                }
+            }
+        }
+
+        if (best != ~size(0)) {
+            result.point    = closestInSlot(best, p);
+            result.triangle = _triangles[Min(best, _triangles.size() - 1)];
+        }
+        return result;
+    }
+
+private:
+    enum Component : i32 { kAx, kAy, kAz, kABx, kABy, kABz, kACx, kACy, kACz, kComponentCount };
+
+    void store(size i, const float3& a, const float3& ab, const float3& ac)
+    {
+        _data[kAx][i]  = a.x;
+        _data[kAy][i]  = a.y;
+        _data[kAz][i]  = a.z;
+        _data[kABx][i] = ab.x;
+        _data[kABy][i] = ab.y;
+        _data[kABz][i] = ab.z;
+        _data[kACx][i] = ac.x;
+        _data[kACy][i] = ac.y;
+        _data[kACz][i] = ac.z;
+    }
+
+    NOVA_FUNC float3 closestInSlot(size i, const float3& p) const
+    {
+        return internal::ClosestPointOnTriangleBranchless(p,
+                                                          {_data[kAx][i], _data[kAy][i], _data[kAz][i]},
+                                                          {_data[kABx][i], _data[kABy][i], _data[kABz][i]},
+                                                          {_data[kACx][i], _data[kACy][i], _data[kACz][i]});
+    }
+
+    std::array<std::vector<f32>, kComponentCount> _data;
+    std::vector<aabb> _blocks;
+    std::vector<u32> _triangles; ///< 排序后的位置对应的输入三角形编号
+};
+
+/**
+ * @brief 点 p 在索引三角形网格上的最近点。
+ *
+ * 单次查询直接遍历所有三角形；对同一网格的多次查询应先构建 TriangleSoA。
+ */
+NOVA_FUNC MeshClosestPoint ClosestPointOnMesh(std::span<const u32> indices, std::span<const float3> positions, const float3& p)
+{
+    NOVA_CHECK(indices.size() % 3 == 0);
+
+    MeshClosestPoint result;
+    for (size t = 0; t < indices.size() / 3; ++t) {
+        const auto q = ClosestPointOnTriangle(p, positions[indices[t * 3]], positions[indices[t * 3 + 1]], positions[indices[t * 3 + 2]]);
+        const auto d = LengthSqr(p - q);
+        if (d < result.distanceSqr) {
+            result.point       = q;
+            result.triangle    = cast_to<u32>(t);
+            result.distanceSqr = d;
+        }
+    }
+    return result;
+}
+
+} // namespace nova
@@ -0,0 +1,671 @@
+/**
+ * @File Delaunay.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
+
+#include "./Bounds.hpp"
+#include "./Predicates.hpp"
+#include "../Bit.hpp"
+
+namespace nova {
+
+/**
+ * @brief 二维 (约束) Delaunay 三角剖分。
+ *
+ * 点按 Morton 码排序后逐个插入 (Bowyer-Watson)：从上一个插入点所在的三角形出发沿可见性行走定位，
+ * 再删除外接圆包含新点的三角形并以新点为中心重新连接，相邻两次插入在空间上接近，期望复杂度接近线性。
+ * 凸包之外用一个无穷远顶点组成的 "幽灵三角形" 封闭，因此不需要超级三角形，凸包边界也是精确的。
+ * 所有判定使用自适应精度的 Orient2D / InCircle。
+ *
+ * 约束边在所有点插入之后逐条加入：翻转与其相交的边直到约束边出现 (Sloan)，再对新产生的边恢复 Delaunay 性质。
+ * 互相交叉的约束边无法同时满足，后加入的一条会被跳过。
+ *
+ * 对象内部持有临时缓冲区，重复构建时应复用同一个对象。
+ */
+class Delaunay
+{
+public:
+    static constexpr u32 kInvalid = ~0u;
+
+    Delaunay() = default;
+
+    /**
+     * @brief 对点集构建三角剖分，constraints 为必须出现在结果中的边 (点的下标对)。
+     *
+     * 重复的点只保留第一个，约束边中引用重复点的端点会被替换为保留的点。
+     * @return 所有约束边都成功加入时返回 true。点全部共线时结果为空，但仍返回 true。
+     */
+    bool build(std::span<const float2> points, std::span<const uint2> constraints = {})
+    {
+        rect domain(points.empty() ? float2(0) : points[0]);
+        for (const auto& p : points)
+            domain.include(p);
+
+        return build(points, constraints, domain, false);
+    }
+
+    /**
+     * @brief 在矩形区域 domain 内构建三角剖分。
+     *
+     * domain 的四个角点作为额外的顶点加入，下标依次为 points.size() + 0..3 (按 rect::corner 的顺序)，
+     * 因此结果恰好覆盖整个矩形。位于 domain 之外的点被忽略。
+     */
+    bool build(std::span<const float2> points, std::span<const uint2> constraints, const rect& domain)
+    {
+        return build(points, constraints, domain, true);
+    }
+
+    /// 逆时针排列的三角形，下标指向输入的点 (以及 domain 的角点)
+    NOVA_FUNC std::span<const u32> indices() const { return _indices; }
+
+    NOVA_FUNC size triangleCount() const { return _indices.size() / 3; }
+
+    /// 每个输入点在结果中对应的顶点：重复的点指向保留的点，未插入的点 (domain 之外或非有限值) 为 kInvalid
+    NOVA_FUNC std::span<const u32> vertexMap() const { return _remap; }
+
+    /// 因与已有约束边交叉或端点无效而被跳过的约束边数量
+    NOVA_FUNC size skippedConstraints() const { return _skipped; }
+
+    /// 判断边 (a, b) 是否在结果中，并且是约束边
+    bool isConstrained(u32 a, u32 b) const
+    {
+        u32 t, i;
+        return a < _remap.size() && b < _remap.size() && _remap[a] != kInvalid && _remap[b] != kInvalid
+            && findEdge(_remap[a], _remap[b], t, i) && (_tris[t].fixed & (1u << i));
+    }
+
+private:
+    /**
+     * @brief 三角形，顶点逆时针排列；边 i 为 v[i] -> v[i + 1]，n[i] 为跨过边 i 的相邻三角形。
+     *
+     * 含有无穷远顶点的是幽灵三角形，代表凸包某条边之外的半平面。
+     */
+    struct Tri
+    {
+        std::array<u32, 3> v;
+        std::array<u32, 3> n;
+        u8 fixed = 0; ///< 约束边的位掩码
+    };
+
+    NOVA_FUNC static u32 Next(u32 i) { return i == 2 ? 0 : i + 1; }
+
+    NOVA_FUNC static u32 Prev(u32 i) { return i == 0 ? 2 : i - 1; }
+
+    bool build(std::span<const float2> points, std::span<const uint2> constraints, const rect& domain, bool addCorners)
+    {
+        _indices.clear();
+        _tris.clear();
+        _free.clear();
+        _skipped = 0;
+
+        const auto n = cast_to<u32>(points.size());
+        _pointCount  = n + (addCorners ? 4 : 0);
+        _infinite    = _pointCount;
+
+        _pos.assign(points.begin(), points.end());
+        if (addCorners) {
+            for (i32 c = 0; c < 4; ++c)
+                _pos.push_back(domain.corner(c));
+        }
+        _pos.emplace_back(0.f);
+
+        _remap.assign(n, kInvalid);
+        _vertexTri.assign(_pointCount + 1, kInvalid);
+        _start.assign(_pointCount + 1, kInvalid);
+        _mark.clear();
+        _stamp = 0;
+
+        auto order = sortVertices(domain, addCorners);
+        if (!initialize(order))
+            return true;
+
+        for (const auto v : order)
+            insert(v);
+
+        for (const auto& c : constraints) {
+            const auto a = c.x < n ? _remap[c.x] : kInvalid;
+            const auto b = c.y < n ? _remap[c.y] : kInvalid;
+            if (a == kInvalid || b == kInvalid || !insertConstraint(a, b))
+                ++_skipped;
+        }
+
+        for (const auto& t : _tris) {
+            if (t.v[0] != kInvalid && !isGhost(t))
+                _indices.insert(_indices.end(), t.v.begin(), t.v.end());
+        }
+
+        return _skipped == 0;
+    }
+
+    // -------------------------
+    // 点插入
+    // -------------------------
+
+    /// 按 domain 内量化坐标的 Morton 码排序，并记录重复的点
+    std::vector<u32> sortVertices(const rect& domain, bool addCorners)
+    {
+        const auto n      = cast_to<u32>(_remap.size());
+        const auto lo     = float2(domain.minPoint);
+        const auto extent = Max(float2(domain.extent()), float2(kFloatMin));
+
+        std::vector<u64> keys;
+        keys.reserve(_pointCount);
+        for (u32 i = 0; i < _pointCount; ++i) {
+            const auto& p = _pos[i];
+            if (!IsFinite(p.x) || !IsFinite(p.y) || (addCorners && i < n && !domain.contains(p)))
+                continue;
+
+            const auto q = uint2(Clamp((p - lo) / extent * 65535.f, float2(0.f), float2(65535.f)));
+            keys.push_back((u64(Shuffle((q.y << 16) | q.x)) << 32) | i);
+        }
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<u32> order;
+        order.reserve(keys.size());
+        for (const auto k : keys)
+            order.push_back(u32(k));
+
+        // 量化后不同的坐标也可能得到相同的 Morton 码，因此按坐标再排一次来找重复；
+        // 相同坐标中角点排在最前面，其次是下标最小的输入点，由它们作为保留的顶点
+        std::vector<u32> byPos = order;
+        std::sort(byPos.begin(), byPos.end(), [&](u32 a, u32 b) {
+            const auto &pa = _pos[a], &pb = _pos[b];
+            if (pa.x != pb.x)
+                return pa.x < pb.x;
+            if (pa.y != pb.y)
+                return pa.y < pb.y;
+            return (a >= n) != (b >= n) ? a >= n : a < b;
+        });
+
+        std::vector<u8> duplicate(_pointCount, 0);
+        u32 keep = kInvalid;
+        for (size i = 0; i < byPos.size(); ++i) {
+            const auto v = byPos[i];
+            if (i == 0 || !all_eq(_pos[v], _pos[byPos[i - 1]]))
+                keep = v;
+            else
+                duplicate[v] = 1;
+
+            if (v < n)
+                _remap[v] = keep;
+        }
+
+        std::erase_if(order, [&](u32 v) { return duplicate[v] != 0; });
+        return order;
+    }
+
+    /// 取前三个不共线的点组成初始三角形与三个幽灵三角形
+    bool initialize(std::vector<u32>& order)
+    {
+        if (order.size() < 3)
+            return false;
+
+        const auto a = order[0];
+        const auto b = order[1];
+
+        size k = 2;
+        while (k < order.size() && Orient2D(_pos[a], _pos[b], _pos[order[k]]) == 0)
+            ++k;
+        if (k == order.size())
+            return false;
+
+        auto c = order[k];
+        auto bb = b;
+        if (Orient2D(_pos[a], _pos[b], _pos[c]) < 0)
+            std::swap(bb, c);
+
+        const auto inf = _infinite;
+        const auto t0  = newTri({a, bb, c});
+        const auto g0  = newTri({bb, a, inf});
+        const auto g1  = newTri({c, bb, inf});
+        const auto g2  = newTri({a, c, inf});
+
+        link(t0, 0, g0, 0);
+        link(t0, 1, g1, 0);
+        link(t0, 2, g2, 0);
+        link(g0, 1, g2, 2);
+        link(g1, 1, g0, 2);
+        link(g2, 1, g1, 2);
+
+        _last = t0;
+
+        // 初始三角形的三个点从插入序列中移除
+        order.erase(order.begin() + k);
+        order.erase(order.begin(), order.begin() + 2);
+        return true;
+    }
+
+    u32 newTri(const std::array<u32, 3>& v)
+    {
+        u32 t;
+        if (!_free.empty()) {
+            t = _free.back();
+            _free.pop_back();
+        }
+        else {
+            t = cast_to<u32>(_tris.size());
+            _tris.emplace_back();
+            _mark.push_back(0);
+        }
+
+        _tris[t].v     = v;
+        _tris[t].n     = {kInvalid, kInvalid, kInvalid};
+        _tris[t].fixed = 0;
+        for (const auto x : v)
+            _vertexTri[x] = t;
+        return t;
+    }
+
+    void link(u32 t, u32 i, u32 u, u32 j)
+    {
+        _tris[t].n[i] = u;
+        _tris[u].n[j] = t;
+    }
+
+    NOVA_FUNC bool isGhost(const Tri& t) const { return t.v[0] == _infinite || t.v[1] == _infinite || t.v[2] == _infinite; }
+
+    /// 幽灵三角形的有限边起点在三角形中的位置 (有限边为 v[i] -> v[i + 1])
+    NOVA_FUNC u32 ghostEdge(const Tri& t) const { return Next(t.v[0] == _infinite ? 0 : (t.v[1] == _infinite ? 1 : 2)); }
+
+    /// 沿可见性行走定位包含 p 的三角形；p 在凸包之外时返回其所在半平面的幽灵三角形
+    u32 locate(const float2& p)
+    {
+        auto t = _last;
+        if (isGhost(_tris[t]))
+            t = _tris[t].n[ghostEdge(_tris[t])];
+
+        for (;;) {
+            const auto& tri = _tris[t];
+            if (isGhost(tri))
+                return t;
+
+            // 起始边轮换，避免在退化情况下来回行走
+            bool moved = false;
+            for (u32 k = 0; k < 3; ++k) {
+                const auto i = (k + _walk) % 3;
+                if (Orient2D(_pos[tri.v[i]], _pos[tri.v[Next(i)]], p) < 0) {
+                    t     = tri.n[i];
+                    moved = true;
+                    break;
+                }
+            }
+
+            if (!moved)
+                return t;
+            ++_walk;
+        }
+    }
+
+    /// p 是否在三角形的外接圆内；幽灵三角形对应其有限边外侧的开半平面 (加上边本身的内部)
+    bool inCircumcircle(const Tri& t, const float2& p) const
+    {
+        if (!isGhost(t))
+            return InCircle(_pos[t.v[0]], _pos[t.v[1]], _pos[t.v[2]], p) > 0;
+
+        const auto i = ghostEdge(t);
+        const auto& a = _pos[t.v[i]];
+        const auto& b = _pos[t.v[Next(i)]];
+
+        const auto o = Orient2D(a, b, p);
+        if (o != 0)
+            return o > 0;
+
+        // 共线时只有落在边内部的点才会让这条凸包边被切分
+        return Dot(p - a, b - a) > 0 && Dot(p - b, a - b) > 0;
+    }
+
+    void insert(u32 v)
+    {
+        const auto& p = _pos[v];
+        const auto t0 = locate(p);
+
+        ++_stamp;
+        _cavity.clear();
+        _boundary.clear();
+
+        _mark[t0] = _stamp;
+        _cavity.push_back(t0);
+
+        // 从定位到的三角形出发，收集外接圆包含 p 的连通区域，并记录区域的边界边
+        for (size k = 0; k < _cavity.size(); ++k) {
+            const auto t = _cavity[k];
+            for (u32 i = 0; i < 3; ++i) {
+                const auto u = _tris[t].n[i];
+                if (_mark[u] == _stamp)
+                    continue;
+
+                if (inCircumcircle(_tris[u], p)) {
+                    _mark[u] = _stamp;
+                    _cavity.push_back(u);
+                }
+                else {
+                    _boundary.push_back({t, i});
+                }
+            }
+        }
+
+        // 边界上被标记为空腔的三角形也可能在之后被加入空腔，这里统一过滤
+        std::erase_if(_boundary, [this](const auto& e) { return _mark[_tris[e[0]].n[e[1]]] == _stamp; });
+
+        // 边界边 (a, b) 与外侧三角形中对应边的编号，先取出来再释放空腔
+        _created.clear();
+        for (const auto& [t, i] : _boundary) {
+            const auto outer = _tris[t].n[i];
+            const auto& o    = _tris[outer];
+            const auto j     = o.n[0] == t ? 0u : (o.n[1] == t ? 1u : 2u);
+            _created.push_back({_tris[t].v[i], _tris[t].v[Next(i)], outer, j});
+        }
+
+        for (const auto t : _cavity) {
+            _tris[t].v[0] = kInvalid;
+            _free.push_back(t);
+        }
+
+        for (auto& [a, b, outer, j] : _created) {
+            const auto nt = newTri({a, b, v});
+            link(nt, 0, outer, j);
+            _start[a] = nt;
+            outer     = nt;
+        }
+
+        // 新三角形 (a, b, v) 的边 b -> v 与以 b 为起点的新三角形的边 v -> b 相邻
+        for (const auto& [a, b, nt, j] : _created)
+            link(nt, 1, _start[b], 2);
+
+        for (const auto& [a, b, nt, j] : _created)
+            _start[a] = kInvalid;
+
+        _last = _created.back()[2];
+    }
+
+    // -------------------------
+    // 约束边
+    // -------------------------
+
+    /// 查找边 a -> b 所在的三角形 t 及其边号 i
+    bool findEdge(u32 a, u32 b, u32& t, u32& i) const
+    {
+        const auto first = _vertexTri[a];
+        if (first == kInvalid)
+            return false;
+
+        t = first;
+        do {
+            const auto& tri = _tris[t];
+            const auto k    = tri.v[0] == a ? 0u : (tri.v[1] == a ? 1u : 2u);
+            if (tri.v[Next(k)] == b) {
+                i = k;
+                return true;
+            }
+            t = tri.n[Prev(k)];
+        } while (t != first);
+
+        return false;
+    }
+
+    void setFixed(u32 a, u32 b)
+    {
+        u32 t, i;
+        if (findEdge(a, b, t, i))
+            _tris[t].fixed |= u8(1u << i);
+        if (findEdge(b, a, t, i))
+            _tris[t].fixed |= u8(1u << i);
+    }
+
+    /**
+     * @brief 翻转三角形 t 的边 i。
+     *
+     * t = (p0, p1, p2)，边 i 为 p0 -> p1，对侧三角形 u 的对顶点为 q。翻转后 t = (p2, p0, q)，u = (q, p1, p2)。
+     */
+    void flip(u32 t, u32 i)
+    {
+        const auto u = _tris[t].n[i];
+        auto& tt     = _tris[t];
+        auto& uu     = _tris[u];
+
+        const auto p0 = tt.v[i], p1 = tt.v[Next(i)], p2 = tt.v[Prev(i)];
+        const auto j  = uu.v[0] == p1 ? 0u : (uu.v[1] == p1 ? 1u : 2u);
+        const auto q  = uu.v[Prev(j)];
+
+        const auto nA = tt.n[Next(i)], nB = tt.n[Prev(i)];
+        const auto nC = uu.n[Next(j)], nD = uu.n[Prev(j)];
+        const auto fA = (tt.fixed >> Next(i)) & 1u, fB = (tt.fixed >> Prev(i)) & 1u;
+        const auto fC = (uu.fixed >> Next(j)) & 1u, fD = (uu.fixed >> Prev(j)) & 1u;
+
+        tt.v     = {p2, p0, q};
+        tt.n     = {nB, nC, u};
+        tt.fixed = u8(fB | (fC << 1));
+        uu.v     = {q, p1, p2};
+        uu.n     = {nD, nA, t};
+        uu.fixed = u8(fD | (fA << 1));
+
+        // A 原本与 t 相邻、C 原本与 u 相邻
+        for (auto& x : _tris[nA].n)
+            x = x == t ? u : x;
+        for (auto& x : _tris[nC].n)
+            x = x == u ? t : x;
+
+        _vertexTri[p0] = t;
+        _vertexTri[p1] = u;
+        _vertexTri[p2] = t;
+        _vertexTri[q]  = u;
+    }
+
+    /// 两条线段的内部是否相交 (端点重合或共线不算)
+    bool crosses(u32 a, u32 b, u32 c, u32 d) const
+    {
+        const auto& pa = _pos[a];
+        const auto& pb = _pos[b];
+        const auto& pc = _pos[c];
+        const auto& pd = _pos[d];
+
+        const auto o1 = Orient2D(pa, pb, pc), o2 = Orient2D(pa, pb, pd);
+        const auto o3 = Orient2D(pc, pd, pa), o4 = Orient2D(pc, pd, pb);
+        return ((o1 > 0 && o2 < 0) || (o1 < 0 && o2 > 0)) && ((o3 > 0 && o4 < 0) || (o3 < 0 && o4 > 0));
+    }
+
+    /**
+     * @brief 插入约束边 a - b。
+     *
+     * 线段经过其他顶点时在该顶点处拆成两段。
+     */
+    bool insertConstraint(u32 a, u32 b)
+    {
+        while (a != b) {
+            u32 t, i;
+            if (findEdge(a, b, t, i)) {
+                setFixed(a, b);
+                return true;
+            }
+
+            // 绕 a 旋转，找到线段 a -> b 穿过的三角形 (a, l, r)，或与线段同向的边 a -> l
+            const auto& pa = _pos[a];
+            const auto& pb = _pos[b];
+            u32 stop = kInvalid;
+
+            t = _vertexTri[a];
+            const auto first = t;
+            u32 l = kInvalid, r = kInvalid;
+            do {
+                const auto& tri = _tris[t];
+                const auto k    = tri.v[0] == a ? 0u : (tri.v[1] == a ? 1u : 2u);
+                const auto vl   = tri.v[Next(k)];
+                const auto vr   = tri.v[Prev(k)];
+
+                if (!isGhost(tri)) {
+                    // 凸包上的边只在一侧有实三角形，所以两条边都要检查
+                    const auto sl = Orient2D(pa, _pos[vl], pb);
+                    const auto sr = Orient2D(pa, _pos[vr], pb);
+                    if (sl == 0 && Dot(_pos[vl] - pa, pb - pa) > 0) {
+                        stop = vl;
+                        break;
+                    }
+                    if (sr == 0 && Dot(_pos[vr] - pa, pb - pa) > 0) {
+                        stop = vr;
+                        break;
+                    }
+                    if (sl > 0 && sr < 0) {
+                        l = vl;
+                        r = vr;
+                        i = Next(k);
+                        break;
+                    }
+                }
+                t = tri.n[Prev(k)];
+            } while (t != first);
+
+            if (stop != kInvalid) {
+                // 线段先经过 a 的一条已有边
+                setFixed(a, stop);
+                a = stop;
+                continue;
+            }
+            if (l == kInvalid)
+                return false;
+
+            // 沿线段收集所有与之相交的边，遇到线段上的顶点时提前停止
+            _crossed.clear();
+            u32 end = kInvalid;
+            for (;;) {
+                if (_tris[t].fixed & (1u << i))
+                    return false;
+
+                _crossed.push_back({l, r});
+                const auto u  = _tris[t].n[i];
+                const auto& uu = _tris[u];
+                const auto j  = uu.v[0] == r ? 0u : (uu.v[1] == r ? 1u : 2u);
+                const auto o  = uu.v[Prev(j)];
+
+                if (o == b) {
+                    end = b;
+                    break;
+                }
+
+                const auto side = Orient2D(pa, pb, _pos[o]);
+                if (side == 0) {
+                    end = o;
+                    break;
+                }
+
+                // u 中的边 j 为 r -> l；下一条相交边为 l -> o (o 在左侧) 或 o -> r (o 在右侧)，始终保持 l 在线段右侧
+                t = u;
+                i = side > 0 ? Next(j) : Prev(j);
+                l = _tris[t].v[i];
+                r = _tris[t].v[Next(i)];
+            }
+
+            if (!flipCrossed(a, end))
+                return false;
+
+            setFixed(a, end);
+            restoreDelaunay();
+            a = end;
+        }
+        return true;
+    }
+
+    /// 翻转所有与线段 a - b 相交的边，直到边 a - b 出现 (Sloan)
+    bool flipCrossed(u32 a, u32 b)
+    {
+        _newEdges.clear();
+
+        // 每条边最多被推迟 _crossed.size() 轮，防止输入异常时死循环
+        size budget = _crossed.size() * _crossed.size() + 16;
+
+        size head = 0;
+        while (head < _crossed.size()) {
+            if (budget-- == 0)
+                return false;
+
+            const auto [u, v] = _crossed[head++];
+
+            u32 t, i;
+            if (!findEdge(u, v, t, i))
+                continue;
+
+            const auto& tt = _tris[t];
+            const auto x   = tt.v[Prev(i)];
+            const auto& uu = _tris[tt.n[i]];
+            const auto y   = uu.v[0] != u && uu.v[0] != v ? uu.v[0] : (uu.v[1] != u && uu.v[1] != v ? uu.v[1] : uu.v[2]);
+
+            // 四边形不是严格凸的，暂时无法翻转
+            if (!crosses(x, y, u, v)) {
+                _crossed.push_back({u, v});
+                continue;
+            }
+
+            flip(t, i);
+            if (crosses(x, y, a, b))
+                _crossed.push_back({x, y});
+            else
+                _newEdges.push_back({x, y});
+        }
+        return true;
+    }
+
+    /// 对约束边插入时产生的新边做 Lawson 翻转，恢复约束 Delaunay 性质
+    void restoreDelaunay()
+    {
+        bool swapped = true;
+        while (swapped) {
+            swapped = false;
+            for (auto& e : _newEdges) {
+                const auto u = e[0], v = e[1];
+
+                u32 t, i;
+                if (!findEdge(u, v, t, i) || (_tris[t].fixed & (1u << i)))
+                    continue;
+
+                const auto& tt = _tris[t];
+                const auto& uu = _tris[tt.n[i]];
+                if (isGhost(tt) || isGhost(uu))
+                    continue;
+
+                const auto x = tt.v[Prev(i)];
+                const auto j = uu.v[0] == v ? 0u : (uu.v[1] == v ? 1u : 2u);
+                const auto y = uu.v[Prev(j)];
+
+                if (InCircle(_pos[tt.v[0]], _pos[tt.v[1]], _pos[tt.v[2]], _pos[y]) > 0) {
+                    flip(t, i);
+                    e       = {x, y};
+                    swapped = true;
+                }
+            }
+        }
+    }
+
+    std::vector<float2> _pos;       ///< 顶点坐标，最后一个为无穷远顶点的占位
+    std::vector<u32> _remap;        ///< 输入点到保留顶点的映射
+    std::vector<u32> _vertexTri;    ///< 每个顶点所在的某个三角形
+    std::vector<Tri> _tris;
+    std::vector<u32> _free;         ///< 被删除的三角形，供之后复用
+    std::vector<u32> _indices;
+    u32 _pointCount = 0;
+    u32 _infinite   = 0;
+    size _skipped   = 0;
+
+    // 点插入
+    u32 _last = 0;
+    u32 _walk = 0;
+    u32 _stamp = 0;
+    std::vector<u32> _mark;
+    std::vector<u32> _cavity;
+    std::vector<std::array<u32, 2>> _boundary;
+    std::vector<std::array<u32, 4>> _created;
+    std::vector<u32> _start;
+
+    // 约束边
+    std::vector<std::array<u32, 2>> _crossed;
+    std::vector<std::array<u32, 2>> _newEdges;
+};
+
+} // namespace nova
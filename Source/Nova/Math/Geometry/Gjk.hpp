@@ -0,0 +1,849 @@
+/**
+ * @File Gjk.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <span>
+#include <variant>
+
+#include "./Bounds.hpp"
+#include "../Quaternion.hpp"
+#include "../Transform.hpp"
+
+namespace nova {
+
+// -------------------------
+// 支撑函数形状
+// -------------------------
+
+/**
+ * @brief 凸形状的支撑映射。
+ *
+ * 形状由 "核心" 与外扩半径组成：support(dir) 返回核心在 dir 方向上最远的点，margin() 为外扩半径。
+ * 球与胶囊的核心分别是点与线段，GJK 只在核心上迭代，外扩部分在最后解析地加上，收敛更快也更稳定。
+ */
+template<typename S>
+concept SupportShape = requires(const S& s, const float3& dir) {
+    { s.support(dir) } -> std::convertible_to<float3>;
+    { s.margin() } -> std::convertible_to<f32>;
+    { s.centroid() } -> std::convertible_to<float3>;
+};
+
+struct SphereShape
+{
+    float3 center{0.f};
+    f32 radius = 1.f;
+
+    NOVA_FUNC float3 support(const float3&) const { return center; }
+
+    NOVA_FUNC f32 margin() const { return radius; }
+
+    NOVA_FUNC float3 centroid() const { return center; }
+};
+
+struct CapsuleShape
+{
+    float3 p0{0.f};
+    float3 p1{0.f};
+    f32 radius = 1.f;
+
+    NOVA_FUNC float3 support(const float3& dir) const { return Dot(p1 - p0, dir) > 0.f ? p1 : p0; }
+
+    NOVA_FUNC f32 margin() const { return radius; }
+
+    NOVA_FUNC float3 centroid() const { return (p0 + p1) * 0.5f; }
+};
+
+/**
+ * @brief 局部空间的 aabb 经仿射变换得到的盒子 (可带旋转与非均匀缩放)。
+ */
+struct BoxShape
+{
+    aabb box;
+    transform<4, f32> xform;
+
+    NOVA_FUNC float3 support(const float3& dir) const
+    {
+        // 方向变换到局部空间需乘以线性部分的转置
+        const auto& m = xform.mat;
+        const float3 local{Dot(FromVector(m[0]), dir), Dot(FromVector(m[1]), dir), Dot(FromVector(m[2]), dir)};
+
+        const float3 p{local.x >= 0.f ? f32(box.maxPoint.x) : f32(box.minPoint.x),
+                       local.y >= 0.f ? f32(box.maxPoint.y) : f32(box.minPoint.y),
+                       local.z >= 0.f ? f32(box.maxPoint.z) : f32(box.minPoint.z)};
+        return xform.xformPoint(p);
+    }
+
+    NOVA_FUNC f32 margin() const { return 0.f; }
+
+    NOVA_FUNC float3 centroid() const { return xform.xformPoint(float3(box.center())); }
+};
+
+/**
+ * @brief 返回点集中沿 dir 方向最远的点的下标。
+ *
+ * 按块先计算点积再求最大值：点积循环可以整块向量化，求最大值的循环只有条件传送。
+ */
+NOVA_FUNC u32 SupportIndex(std::span<const float3> points, const float3& dir)
+{
+    constexpr size kBlock = 16;
+
+    std::array<f32, kBlock> dots;
+    f32 best    = -kInfinity;
+    u32 bestIdx = 0;
+
+    for (size base = 0; base < points.size(); base += kBlock) {
+        const auto count = Min(kBlock, points.size() - base);
+        const auto* p    = points.data() + base;
+
+        for (size i = 0; i < count; ++i)
+            dots[i] = p[i].x * dir.x + p[i].y * dir.y + p[i].z * dir.z;
+
+        for (size i = 0; i < count; ++i) {
+            const auto better = dots[i] > best;
+            best              = better ? dots[i] : best;
+            bestIdx           = better ? cast_to<u32>(base + i) : bestIdx;
+        }
+    }
+
+    return bestIdx;
+}
+
+/**
+ * @brief 点集的凸包，由旋转与平移放置到世界空间。
+ *
+ * 点集无需是严格的凸包顶点，内部点只会增加支撑函数的开销；points 不能为空。
+ */
+struct HullShape
+{
+    std::span<const float3> points;
+    quat<f32> rotation{};
+    float3 translation{0.f};
+
+    NOVA_FUNC float3 support(const float3& dir) const
+    {
+        const auto local = Rotate(Conjugate(rotation), dir);
+        return Rotate(rotation, points[SupportIndex(points, local)]) + translation;
+    }
+
+    NOVA_FUNC f32 margin() const { return 0.f; }
+
+    /// 点的平均值位于凸包内部，作为 GJK 的初始搜索方向与 EPA 的内部参考点
+    NOVA_FUNC float3 centroid() const
+    {
+        float3 sum{0.f};
+        for (const auto& p : points)
+            sum += p;
+        return Rotate(rotation, sum / f32(points.size())) + translation;
+    }
+};
+
+/**
+ * @brief 批量查询使用的类型擦除形状，见 Parallel/Gjk.hpp。
+ */
+using ConvexShape = std::variant<SphereShape, CapsuleShape, BoxShape, HullShape>;
+
+// -------------------------
+// 查询结果
+// -------------------------
+
+/**
+ * @brief 上一帧的单纯形，用于下一帧的热启动。
+ *
+ * 只记录求取各顶点时的搜索方向，下一帧用新的位姿重新求支撑点，因此对任意支撑函数形状都有效。
+ * 物体间的相对运动较小时，GJK 通常在一两次迭代内收敛。
+ */
+struct GjkCache
+{
+    std::array<float3, 4> directions{};
+    u32 count = 0;
+};
+
+/**
+ * @brief 两个凸形状之间的接触信息。
+ */
+struct ContactResult
+{
+    float3 pointA{0.f};    ///< A 上的最近点 (相交时为 A 最深入 B 的点)
+    float3 pointB{0.f};    ///< B 上的最近点 (相交时为 B 最深入 A 的点)
+    float3 normal{0.f, 1.f, 0.f}; ///< 由 A 指向 B 的单位方向
+    f32 distance   = 0.f;  ///< 有符号距离，相交时为负的穿透深度
+    u32 iterations = 0;    ///< GJK 迭代次数
+
+    NOVA_FUNC bool intersect() const { return distance <= 0.f; }
+};
+
+/**
+ * @brief 形状对在形状数组中的下标。
+ */
+struct ShapePair
+{
+    u32 a;
+    u32 b;
+};
+
+namespace internal {
+
+constexpr u32 kGjkMaxIterations = 64;
+constexpr u32 kEpaMaxIterations = 64;
+constexpr u32 kEpaMaxVertices   = 128;
+constexpr u32 kEpaMaxFaces      = 256;
+
+constexpr f32 kGjkRelativeTolerance = 1e-6f;
+constexpr f32 kEpaRelativeTolerance = 1e-4f;
+constexpr f32 kGjkContactDistance   = 1e-6f; ///< 核心间距离不超过该值时视为接触，不再用距离归一化法线
+
+struct SimplexVertex
+{
+    float3 w;   ///< Minkowski 差上的点 a - b
+    float3 a;   ///< A 的支撑点
+    float3 b;   ///< B 的支撑点
+    float3 dir; ///< 求取支撑点时的搜索方向
+};
+
+struct Simplex
+{
+    std::array<SimplexVertex, 4> v;
+    std::array<f32, 4> bary;
+    u32 count = 0;
+
+    NOVA_FUNC void keep1(u32 i)
+    {
+        v[0]    = v[i];
+        bary[0] = 1.f;
+        count   = 1;
+    }
+
+    NOVA_FUNC void keep2(u32 i, u32 j, f32 t)
+    {
+        const auto vi = v[i], vj = v[j];
+        v[0]    = vi;
+        v[1]    = vj;
+        bary[0] = 1.f - t;
+        bary[1] = t;
+        count   = 2;
+    }
+
+    NOVA_FUNC float3 point() const
+    {
+        float3 p{0.f};
+        for (u32 i = 0; i < count; ++i)
+            p += v[i].w * bary[i];
+        return p;
+    }
+
+    NOVA_FUNC void witness(float3& pa, float3& pb) const
+    {
+        pa = pb = float3{0.f};
+        for (u32 i = 0; i < count; ++i) {
+            pa += v[i].a * bary[i];
+            pb += v[i].b * bary[i];
+        }
+    }
+};
+
+template<SupportShape A, SupportShape B>
+NOVA_FUNC SimplexVertex MinkowskiSupport(const A& a, const B& b, const float3& dir)
+{
+    SimplexVertex sv;
+    sv.dir = dir;
+    sv.a   = a.support(dir);
+    sv.b   = b.support(-dir);
+    sv.w   = sv.a - sv.b;
+    return sv;
+}
+
+// 以下求解函数计算单纯形上距原点最近的点，并只保留构成该点的最小子单纯形 (Johnson 子算法的区域判定形式)
+
+NOVA_FUNC void SolveSegment(Simplex& s)
+{
+    const auto a  = s.v[0].w;
+    const auto ab = s.v[1].w - a;
+
+    const auto denom = LengthSqr(ab);
+    const auto t     = -Dot(a, ab);
+    if (t <= 0.f || denom <= 0.f)
+        s.keep1(0);
+    else if (t >= denom)
+        s.keep1(1);
+    else
+        s.keep2(0, 1, t / denom);
+}
+
+// Ericson, Real-Time Collision Detection, 5.1.5
+NOVA_FUNC void SolveTriangle(Simplex& s)
+{
+    const auto a = s.v[0].w, b = s.v[1].w, c = s.v[2].w;
+    const auto ab = b - a, ac = c - a;
+
+    const auto d1 = -Dot(ab, a), d2 = -Dot(ac, a);
+    if (d1 <= 0.f && d2 <= 0.f)
+        return s.keep1(0);
+
+    const auto d3 = -Dot(ab, b), d4 = -Dot(ac, b);
+    if (d3 >= 0.f && d4 <= d3)
+        return s.keep1(1);
+
+    const auto vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+        return s.keep2(0, 1, d1 / (d1 - d3));
+
+    const auto d5 = -Dot(ab, c), d6 = -Dot(ac, c);
+    if (d6 >= 0.f && d5 <= d6)
+        return s.keep1(2);
+
+    const auto vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+        return s.keep2(0, 2, d2 / (d2 - d6));
+
+    const auto va = d3 * d6 - d5 * d4;
+    if (va <= 0.f && d4 - d3 >= 0.f && d5 - d6 >= 0.f)
+        return s.keep2(1, 2, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+    const auto sum = va + vb + vc;
+    if (sum <= 0.f) {
+        // 退化三角形：三点共线，退化为最长的边
+        const auto lab = LengthSqr(ab), lac = LengthSqr(ac), lbc = LengthSqr(c - b);
+        if (lab < lac || lab < lbc)
+            s.v[lac >= lbc ? 1 : 0] = s.v[2];
+        s.count = 2;
+        return SolveSegment(s);
+    }
+
+    const auto inv = 1.f / sum;
+    s.bary[1]      = vb * inv;
+    s.bary[2]      = vc * inv;
+    s.bary[0]      = 1.f - s.bary[1] - s.bary[2];
+    s.count        = 3;
+}
+
+NOVA_FUNC void SolveTetrahedron(Simplex& s)
+{
+    // 面 (i, j, k) 与其对顶点 l
+    constexpr u32 kFaces[4][4] = {
+        {0, 1, 2, 3},
+        {0, 3, 1, 2},
+        {0, 2, 3, 1},
+        {1, 3, 2, 0}
+    };
+
+    // 四个顶点近似共面时无法可靠地判定内外，此时在所有面上求最近点
+    const auto e1 = s.v[1].w - s.v[0].w, e2 = s.v[2].w - s.v[0].w, e3 = s.v[3].w - s.v[0].w;
+    const auto volume     = Dot(Cross(e1, e2), e3);
+    const auto edge       = Sqrt(Max(LengthSqr(e1), Max(LengthSqr(e2), LengthSqr(e3))));
+    const auto degenerate = Abs(volume) <= 1e-5f * edge * edge * edge;
+
+    Simplex best;
+    f32 bestDist = kInfinity;
+    bool inside  = !degenerate;
+
+    for (const auto& f : kFaces) {
+        const auto a = s.v[f[0]].w;
+        const auto n = Cross(s.v[f[1]].w - a, s.v[f[2]].w - a);
+
+        // 原点与对顶点位于面的同侧时，最近点不在该面上
+        const auto sideO = -Dot(n, a);
+        const auto sideD = Dot(n, s.v[f[3]].w - a);
+        if (!degenerate && sideO * sideD > 0.f)
+            continue;
+
+        inside = false;
+
+        Simplex tri;
+        tri.v     = {s.v[f[0]], s.v[f[1]], s.v[f[2]], s.v[f[3]]};
+        tri.count = 3;
+        SolveTriangle(tri);
+
+        const auto dist = LengthSqr(tri.point());
+        if (dist < bestDist) {
+            bestDist = dist;
+            best     = tri;
+        }
+    }
+
+    if (inside) {
+        s.count = 4;
+        return;
+    }
+
+    s = best;
+}
+
+NOVA_FUNC void SolveSimplex(Simplex& s)
+{
+    switch (s.count) {
+        case 1 : s.bary[0] = 1.f; break;
+        case 2 : SolveSegment(s); break;
+        case 3 : SolveTriangle(s); break;
+        default: SolveTetrahedron(s); break;
+    }
+}
+
+struct GjkOutput
+{
+    Simplex simplex;
+    float3 pointA;
+    float3 pointB;
+    f32 distance    = 0.f;
+    u32 iterations  = 0;
+    bool overlap    = false; ///< 核心形状相交
+    bool separated  = false; ///< 提前确认外扩后的形状分离 (仅 earlyOut 时有效)
+};
+
+/**
+ * @brief 在两个形状的核心上运行 GJK。
+ *
+ * earlyOut 为 true 时，一旦找到使外扩后形状分离的方向即返回，用于只需要布尔结果的查询。
+ */
+template<SupportShape A, SupportShape B>
+NOVA_FUNC GjkOutput GjkSolve(const A& a, const B& b, GjkCache* cache, bool earlyOut)
+{
+    GjkOutput out;
+    auto& s = out.simplex;
+
+    if (cache && cache->count > 0) {
+        for (u32 i = 0; i < cache->count; ++i) {
+            const auto sv = MinkowskiSupport(a, b, cache->directions[i]);
+
+            bool duplicate = false;
+            for (u32 k = 0; k < s.count; ++k)
+                duplicate |= all_eq(s.v[k].w, sv.w);
+
+            if (!duplicate)
+                s.v[s.count++] = sv;
+        }
+    }
+    else {
+        auto dir = a.centroid() - b.centroid();
+        if (LengthSqr(dir) <= 0.f)
+            dir = float3{1.f, 0.f, 0.f};
+        s.v[0]  = MinkowskiSupport(a, b, dir);
+        s.count = 1;
+    }
+
+    const auto margin = a.margin() + b.margin();
+    f32 prevDist      = kInfinity;
+    Simplex prev;
+
+    for (; out.iterations < kGjkMaxIterations; ++out.iterations) {
+        SolveSimplex(s);
+
+        if (s.count == 4) {
+            out.overlap = true;
+            break;
+        }
+
+        const auto v    = s.point();
+        const auto dist = LengthSqr(v);
+
+        f32 scale = 0.f;
+        for (u32 i = 0; i < s.count; ++i)
+            scale = Max(scale, LengthSqr(s.v[i].w));
+
+        // 原点落在单纯形上：两个核心接触
+        if (dist <= kGjkRelativeTolerance * kGjkRelativeTolerance * scale) {
+            out.overlap = true;
+            break;
+        }
+
+        // 距离不再严格减小说明已达到浮点精度的极限，退回上一次的单纯形
+        if (dist >= prevDist) {
+            s = prev;
+            break;
+        }
+        prevDist = dist;
+
+        const auto sv = MinkowskiSupport(a, b, -v);
+
+        // 支撑平面已将原点与外扩后的 Minkowski 差分开
+        const auto vw = Dot(v, sv.w);
+        if (earlyOut && vw > 0.f && vw * vw > margin * margin * dist) {
+            out.separated = true;
+            break;
+        }
+
+        // 收敛：支撑点在 v 方向上不能再使距离明显减小
+        if (dist - vw <= kGjkRelativeTolerance * dist)
+            break;
+
+        bool duplicate = false;
+        for (u32 k = 0; k < s.count; ++k)
+            duplicate |= all_eq(s.v[k].w, sv.w);
+        if (duplicate)
+            break;
+
+        prev           = s;
+        s.v[s.count++] = sv;
+    }
+
+    if (cache) {
+        cache->count = s.count;
+        for (u32 i = 0; i < s.count; ++i)
+            cache->directions[i] = s.v[i].dir;
+    }
+
+    s.witness(out.pointA, out.pointB);
+    out.distance = out.overlap ? 0.f : Length(out.pointA - out.pointB);
+    return out;
+}
+
+/**
+ * @brief 将包含原点的低维单纯形扩充为四面体，作为 EPA 的初始多面体。形状本身退化时返回 false。
+ */
+template<SupportShape A, SupportShape B>
+NOVA_FUNC bool ExpandToTetrahedron(const A& a, const B& b, Simplex& s)
+{
+    constexpr f32 kEps = 1e-10f;
+
+    if (s.count == 1) {
+        constexpr float3 kAxes[6] = {
+            { 1.f,  0.f,  0.f},
+            {-1.f,  0.f,  0.f},
+            { 0.f,  1.f,  0.f},
+            { 0.f, -1.f,  0.f},
+            { 0.f,  0.f,  1.f},
+            { 0.f,  0.f, -1.f}
+        };
+
+        for (const auto& dir : kAxes) {
+            const auto sv = MinkowskiSupport(a, b, dir);
+            if (LengthSqr(sv.w - s.v[0].w) > kEps) {
+                s.v[s.count++] = sv;
+                break;
+            }
+        }
+        if (s.count < 2)
+            return false;
+    }
+
+    if (s.count == 2) {
+        const auto ab = s.v[1].w - s.v[0].w;
+
+        float3 u, t;
+        CoordinateSystem(Normalize(ab), u, t);
+
+        for (const auto& dir : {u, t, -u, -t}) {
+            const auto sv = MinkowskiSupport(a, b, dir);
+            if (LengthSqr(Cross(ab, sv.w - s.v[0].w)) > kEps * LengthSqr(ab)) {
+                s.v[s.count++] = sv;
+                break;
+            }
+        }
+        if (s.count < 3)
+            return false;
+    }
+
+    if (s.count == 3) {
+        const auto n = Cross(s.v[1].w - s.v[0].w, s.v[2].w - s.v[0].w);
+
+        for (const auto& dir : {n, -n}) {
+            const auto sv = MinkowskiSupport(a, b, dir);
+            if (Abs(Dot(n, sv.w - s.v[0].w)) > kEps * Length(n)) {
+                s.v[s.count++] = sv;
+                break;
+            }
+        }
+        if (s.count < 4)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief EPA 的多面体：面记录三条边各自的相邻面，删除可见面时沿邻接关系扩散，保证地平线是一个闭合环。
+ */
+struct EpaPolytope
+{
+    struct Face
+    {
+        std::array<u32, 3> i;   ///< 顶点，从外侧看为逆时针
+        std::array<u32, 3> adj; ///< adj[e] 为共享边 (i[e], i[e + 1]) 的面
+        float3 n;
+        f32 dist;
+        bool alive;
+    };
+
+    struct HorizonEdge
+    {
+        u32 a, b;
+        u32 outside; ///< 地平线外侧保留下来的面
+    };
+
+    std::array<SimplexVertex, kEpaMaxVertices> verts;
+    std::array<Face, kEpaMaxFaces> faces;
+    std::array<u32, kEpaMaxFaces> freeFaces;
+    std::array<u32, kEpaMaxFaces> stack;
+    std::array<HorizonEdge, kEpaMaxFaces> horizon;
+    u32 vertCount = 0, faceCount = 0, freeCount = 0, horizonCount = 0;
+
+    NOVA_FUNC u32 capacity() const { return kEpaMaxFaces - faceCount + freeCount; }
+
+    NOVA_FUNC u32 addFace(u32 i0, u32 i1, u32 i2)
+    {
+        const auto idx = freeCount > 0 ? freeFaces[--freeCount] : faceCount++;
+        auto& f        = faces[idx];
+
+        f.i     = {i0, i1, i2};
+        f.adj   = {~0u, ~0u, ~0u};
+        f.alive = true;
+
+        const auto n   = Cross(verts[i1].w - verts[i0].w, verts[i2].w - verts[i0].w);
+        const auto len = Length(n);
+        f.n            = len > 0.f ? n / len : float3{0.f};
+        f.dist         = len > 0.f ? Max(Dot(f.n, verts[i0].w), 0.f) : kInfinity; // 退化的面不会被选为最近面
+        return idx;
+    }
+
+    NOVA_FUNC bool visible(u32 f, const float3& p) const { return Dot(faces[f].n, p - verts[faces[f].i[0]].w) > 0.f; }
+
+    /**
+     * @brief 从 seed 出发删除所有对 p 可见的相连面，并收集地平线。
+     */
+    NOVA_FUNC void carve(u32 seed, const float3& p)
+    {
+        horizonCount      = 0;
+        u32 top           = 0;
+        stack[top++]      = seed;
+        faces[seed].alive = false;
+
+        while (top > 0) {
+            const auto f           = stack[--top];
+            freeFaces[freeCount++] = f;
+
+            for (u32 e = 0; e < 3; ++e) {
+                const auto g = faces[f].adj[e];
+                if (!faces[g].alive)
+                    continue;
+
+                if (visible(g, p)) {
+                    faces[g].alive = false;
+                    stack[top++]   = g;
+                }
+                else {
+                    horizon[horizonCount++] = {faces[f].i[e], faces[f].i[(e + 1) % 3], g};
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 用新顶点与地平线上的边构成新的面，并恢复邻接关系。
+     */
+    NOVA_FUNC void stitch(u32 vertex)
+    {
+        std::array<u32, kEpaMaxFaces> created;
+
+        for (u32 k = 0; k < horizonCount; ++k) {
+            const auto& h = horizon[k];
+            const auto nf = addFace(h.a, h.b, vertex);
+            created[k]    = nf;
+
+            auto& outside = faces[h.outside];
+            for (u32 e = 0; e < 3; ++e) {
+                if (outside.i[e] == h.b && outside.i[(e + 1) % 3] == h.a)
+                    outside.adj[e] = nf;
+            }
+            faces[nf].adj[0] = h.outside;
+        }
+
+        // 新面 (a, b, v) 的边 (b, v) 与以 b 为起点的新面相邻，边 (v, a) 与以 a 为终点的新面相邻
+        for (u32 k = 0; k < horizonCount; ++k) {
+            for (u32 j = 0; j < horizonCount; ++j) {
+                if (horizon[j].a == horizon[k].b)
+                    faces[created[k]].adj[1] = created[j];
+                if (horizon[j].b == horizon[k].a)
+                    faces[created[k]].adj[2] = created[j];
+            }
+        }
+    }
+};
+
+/**
+ * @brief EPA：从包含原点的单纯形出发扩张多面体，求 Minkowski 差边界上距原点最近的点。
+ *
+ * 成功时写入 out 的 distance (负的穿透深度)、normal 与两个形状上的接触点。
+ */
+template<SupportShape A, SupportShape B>
+NOVA_FUNC bool EpaSolve(const A& a, const B& b, Simplex s, ContactResult& out)
+{
+    if (!ExpandToTetrahedron(a, b, s))
+        return false;
+
+    EpaPolytope poly;
+    for (u32 i = 0; i < 4; ++i)
+        poly.verts[poly.vertCount++] = s.v[i];
+
+    // 调整初始四面体的顶点顺序，使各面从外侧看为逆时针
+    const auto& w = poly.verts;
+    if (Dot(Cross(w[1].w - w[0].w, w[2].w - w[0].w), w[3].w - w[0].w) > 0.f)
+        std::swap(poly.verts[1], poly.verts[2]);
+
+    poly.addFace(0, 1, 2);
+    poly.addFace(0, 3, 1);
+    poly.addFace(0, 2, 3);
+    poly.addFace(1, 3, 2);
+
+    for (u32 f = 0; f < 4; ++f) {
+        for (u32 e = 0; e < 3; ++e) {
+            const auto ea = poly.faces[f].i[e], eb = poly.faces[f].i[(e + 1) % 3];
+            for (u32 g = 0; g < 4; ++g) {
+                for (u32 k = 0; k < 3; ++k) {
+                    if (poly.faces[g].i[k] == eb && poly.faces[g].i[(k + 1) % 3] == ea)
+                        poly.faces[f].adj[e] = g;
+                }
+            }
+        }
+    }
+
+    auto face = poly.faces[0];
+    for (u32 iter = 0; iter < kEpaMaxIterations; ++iter) {
+        u32 best = ~0u;
+        for (u32 f = 0; f < poly.faceCount; ++f) {
+            if (poly.faces[f].alive && (best == ~0u || poly.faces[f].dist < poly.faces[best].dist))
+                best = f;
+        }
+
+        face = poly.faces[best];
+        if (face.dist == kInfinity)
+            return false;
+
+        const auto sv  = MinkowskiSupport(a, b, face.n);
+        const auto gap = Dot(sv.w, face.n) - face.dist;
+        if (gap <= kEpaRelativeTolerance * Max(face.dist, 1e-3f) || poly.vertCount == kEpaMaxVertices)
+            break;
+
+        poly.carve(best, sv.w);
+
+        // 容量不足时以当前最近面作为结果
+        if (poly.horizonCount > poly.capacity())
+            break;
+
+        poly.verts[poly.vertCount] = sv;
+        poly.stitch(poly.vertCount++);
+    }
+
+    // 最近点 n * dist 在面上的重心坐标
+    const auto& v  = poly.verts;
+    const auto p   = face.n * face.dist;
+    const auto e0  = v[face.i[1]].w - v[face.i[0]].w;
+    const auto e1  = v[face.i[2]].w - v[face.i[0]].w;
+    const auto e2  = p - v[face.i[0]].w;
+
+    const auto d00 = Dot(e0, e0), d01 = Dot(e0, e1), d11 = Dot(e1, e1);
+    const auto d20 = Dot(e2, e0), d21 = Dot(e2, e1);
+    const auto denom = d00 * d11 - d01 * d01;
+
+    f32 bv = 0.f, bw = 0.f;
+    if (denom > 0.f) {
+        bv = Clamp((d11 * d20 - d01 * d21) / denom, 0.f, 1.f);
+        bw = Clamp((d00 * d21 - d01 * d20) / denom, 0.f, 1.f - bv);
+    }
+    const auto bu = 1.f - bv - bw;
+
+    out.pointA   = v[face.i[0]].a * bu + v[face.i[1]].a * bv + v[face.i[2]].a * bw;
+    out.pointB   = v[face.i[0]].b * bu + v[face.i[1]].b * bv + v[face.i[2]].b * bw;
+    out.normal   = face.n;
+    out.distance = -face.dist;
+    return true;
+}
+
+/**
+ * @brief 把外扩半径并入支撑函数，用于核心退化 (点、线段) 时的 EPA。
+ */
+template<SupportShape S> struct InflatedShape
+{
+    const S& shape;
+
+    NOVA_FUNC float3 support(const float3& dir) const
+    {
+        const auto len = Length(dir);
+        const auto p   = shape.support(dir);
+        return len > 0.f ? p + dir * (shape.margin() / len) : p;
+    }
+
+    NOVA_FUNC f32 margin() const { return 0.f; }
+
+    NOVA_FUNC float3 centroid() const { return shape.centroid(); }
+};
+
+} // namespace internal
+
+// -------------------------
+// 查询
+// -------------------------
+
+/**
+ * @brief 计算两个凸形状之间的有符号距离、法线与最近点 (GJK + EPA)。
+ *
+ * 分离时由 GJK 得到最近距离；核心相交时用 EPA 求穿透深度。
+ * cache 非空时从中热启动，并在返回前写入本次的单纯形。
+ */
+template<SupportShape A, SupportShape B>
+NOVA_FUNC ContactResult ConvexContact(const A& a, const B& b, GjkCache* cache = nullptr)
+{
+    ContactResult result;
+
+    const auto ra   = a.margin();
+    const auto rb   = b.margin();
+    const auto core = internal::GjkSolve(a, b, cache, false);
+
+    result.iterations = core.iterations;
+
+    if (!core.overlap && core.distance > internal::kGjkContactDistance) {
+        const auto n = (core.pointB - core.pointA) / core.distance;
+
+        result.normal   = n;
+        result.distance = core.distance - ra - rb;
+        result.pointA   = core.pointA + n * ra;
+        result.pointB   = core.pointB - n * rb;
+        return result;
+    }
+
+    // 核心恰好接触时同样交给 EPA；凸集外扩 r 后，内部点到边界的距离也恰好增加 r，因此核心的穿透深度加上外扩半径即为结果
+    if (internal::EpaSolve(a, b, core.simplex, result)) {
+        result.distance -= ra + rb;
+        result.pointA   += result.normal * ra;
+        result.pointB   -= result.normal * rb;
+        return result;
+    }
+
+    // 核心退化为点或线段时，在外扩后的形状上重新求解
+    if (ra + rb > 0.f) {
+        const internal::InflatedShape<A> ia{a};
+        const internal::InflatedShape<B> ib{b};
+
+        const auto full = internal::GjkSolve(ia, ib, nullptr, false);
+        if (full.overlap && internal::EpaSolve(ia, ib, full.simplex, result))
+            return result;
+    }
+
+    // 两个形状都退化且相互接触，法线保持默认值
+    result.distance = 0.f;
+    result.pointA   = core.pointA;
+    result.pointB   = core.pointB;
+    return result;
+}
+
+/**
+ * @brief 判断两个凸形状是否相交。
+ *
+ * 找到分离方向后立即返回，且不运行 EPA，比 ConvexContact 开销更小。
+ */
+template<SupportShape A, SupportShape B>
+NOVA_FUNC bool ConvexIntersect(const A& a, const B& b, GjkCache* cache = nullptr)
+{
+    const auto core = internal::GjkSolve(a, b, cache, true);
+    if (core.separated)
+        return false;
+
+    return core.overlap || core.distance <= a.margin() + b.margin();
+}
+
+} // namespace nova
@@ -0,0 +1,262 @@
+/**
+ * @File Obb.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include "./Bounds.hpp"
+#include "../Quaternion.hpp"
+
+namespace nova {
+
+/**
+ * @brief 有向包围盒。
+ *
+ * axes 的三列为包围盒的局部坐标轴 (单位正交)，halfExtents 为沿各轴的半长。
+ */
+struct obb
+{
+    float3 center{0.f};
+    float3x3 axes{1.f};
+    float3 halfExtents{0.f};
+
+    NOVA_FUNC obb() = default;
+
+    NOVA_FUNC obb(const float3& c, const float3x3& r, const float3& e) : center(c), axes(r), halfExtents(e) { }
+
+    NOVA_FUNC obb(const float3& c, const quat<f32>& q, const float3& e) : center(c), axes(Mat3Cast(q)), halfExtents(e) { }
+
+    NOVA_FUNC explicit obb(const aabb& b) : center(b.center()), axes(1.f), halfExtents(b.extent() * 0.5f) { }
+
+    /// 世界坐标转换到包围盒的局部坐标
+    NOVA_FUNC float3 toLocal(const float3& p) const
+    {
+        const auto d = p - center;
+        return {Dot(d, axes[0]), Dot(d, axes[1]), Dot(d, axes[2])};
+    }
+
+    NOVA_FUNC float3 toWorld(const float3& local) const
+    {
+        return center + axes[0] * local.x + axes[1] * local.y + axes[2] * local.z;
+    }
+
+    /// 第 i 个角点，i 的第 0、1、2 位分别选择沿对应轴的正 / 负方向 (与 bounds::corner 的约定相同)
+    NOVA_FUNC float3 corner(i32 i) const
+    {
+        return toWorld({(i & 1) ? halfExtents.x : -halfExtents.x,
+                        (i & 2) ? halfExtents.y : -halfExtents.y,
+                        (i & 4) ? halfExtents.z : -halfExtents.z});
+    }
+
+    NOVA_FUNC bool contains(const float3& p) const
+    {
+        const auto local = toLocal(p);
+        return Abs(local.x) <= halfExtents.x && Abs(local.y) <= halfExtents.y && Abs(local.z) <= halfExtents.z;
+    }
+};
+
+NOVA_FUNC f32 Volume(const obb& b) { return 8.f * b.halfExtents.x * b.halfExtents.y * b.halfExtents.z; }
+
+/**
+ * @brief 包含 obb 的最小 aabb：沿每个世界坐标轴的半长为 |R| * halfExtents。
+ */
+NOVA_FUNC aabb ToAABB(const obb& b)
+{
+    float3 r{0.f};
+    for (i32 i = 0; i < 3; ++i)
+        r += Abs(b.axes[i]) * b.halfExtents[i];
+    return {b.center - r, b.center + r};
+}
+
+/**
+ * @brief 两个 obb 是否相交 (分离轴定理，Ericson, Real-Time Collision Detection 4.4.1)。
+ *
+ * 依次检查两个盒子的 6 个面法线与 9 个棱方向的叉积，任意一个轴上投影不重叠即可提前返回。
+ * 两条棱接近平行时叉积接近 0，|R| 加上一个小量避免把这种情况误判为分离。
+ */
+NOVA_FUNC bool Overlaps(const obb& a, const obb& b)
+{
+    constexpr f32 kEpsilon = 1e-6f;
+
+    // b 的各轴在 a 的局部坐标下的表示，R[i][j] = a.axes[i] · b.axes[j]
+    f32 R[3][3], absR[3][3];
+    for (i32 i = 0; i < 3; ++i) {
+        for (i32 j = 0; j < 3; ++j) {
+            R[i][j]    = Dot(a.axes[i], b.axes[j]);
+            absR[i][j] = Abs(R[i][j]) + kEpsilon;
+        }
+    }
+
+    const auto t   = a.toLocal(b.center);
+    const auto& ea = a.halfExtents;
+    const auto& eb = b.halfExtents;
+
+    // a 的面法线
+    for (i32 i = 0; i < 3; ++i) {
+        const auto rb = eb[0] * absR[i][0] + eb[1] * absR[i][1] + eb[2] * absR[i][2];
+        if (Abs(t[i]) > ea[i] + rb)
+            return false;
+    }
+
+    // b 的面法线
+    for (i32 j = 0; j < 3; ++j) {
+        const auto ra = ea[0] * absR[0][j] + ea[1] * absR[1][j] + ea[2] * absR[2][j];
+        if (Abs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > ra + eb[j])
+            return false;
+    }
+
+    // a 的第 i 条棱与 b 的第 j 条棱的叉积
+    for (i32 i = 0; i < 3; ++i) {
+        const auto i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+        for (i32 j = 0; j < 3; ++j) {
+            const auto j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+
+            const auto ra = ea[i1] * absR[i2][j] + ea[i2] * absR[i1][j];
+            const auto rb = eb[j1] * absR[i][j2] + eb[j2] * absR[i][j1];
+            if (Abs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief 射线与 obb 求交：将射线变换到盒子的局部坐标后做 slab 测试，距离与世界坐标下的一致。
+ */
+NOVA_FUNC bool RayIntersect(const obb& b, const Ray& r, Float& nearT, Float& farT)
+{
+    const auto d = r.dir;
+    const Ray local(b.toLocal(r.origin), float3{Dot(d, b.axes[0]), Dot(d, b.axes[1]), Dot(d, b.axes[2])}, r.tMin, r.tMax);
+    return RayIntersect(aabb(-b.halfExtents, b.halfExtents), local, nearT, farT);
+}
+
+NOVA_FUNC bool RayIntersect(const obb& b, const Ray& r)
+{
+    Float nearT, farT;
+    return RayIntersect(b, r, nearT, farT);
+}
+
+namespace internal {
+
+/**
+ * @brief 对称 3x3 矩阵的特征分解 (循环 Jacobi 旋转)，特征向量按列存放在 vectors 中。
+ */
+NOVA_FUNC void SymmetricEigen(const f64 (&m)[3][3], f64 (&vectors)[3][3], f64 (&values)[3])
+{
+    f64 a[3][3];
+    for (i32 i = 0; i < 3; ++i) {
+        for (i32 j = 0; j < 3; ++j) {
+            a[i][j]       = m[i][j];
+            vectors[i][j] = i == j ? 1.0 : 0.0;
+        }
+    }
+
+    for (i32 sweep = 0; sweep < 32; ++sweep) {
+        const auto off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        if (off <= 1e-30 * (a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2]) || off == 0)
+            break;
+
+        for (i32 p = 0; p < 2; ++p) {
+            for (i32 q = p + 1; q < 3; ++q) {
+                if (a[p][q] == 0)
+                    continue;
+
+                // 选择使 a[p][q] 归零的旋转角 (Numerical Recipes 11.1)
+                const auto theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                const auto t     = (theta >= 0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                const auto c     = 1.0 / std::sqrt(t * t + 1.0);
+                const auto s     = t * c;
+
+                for (i32 k = 0; k < 3; ++k) {
+                    const auto akp = a[k][p], akq = a[k][q];
+                    a[k][p]        = c * akp - s * akq;
+                    a[k][q]        = s * akp + c * akq;
+                }
+                for (i32 k = 0; k < 3; ++k) {
+                    const auto apk = a[p][k], aqk = a[q][k];
+                    a[p][k]        = c * apk - s * aqk;
+                    a[q][k]        = s * apk + c * aqk;
+                }
+                for (i32 k = 0; k < 3; ++k) {
+                    const auto vkp = vectors[k][p], vkq = vectors[k][q];
+                    vectors[k][p]  = c * vkp - s * vkq;
+                    vectors[k][q]  = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    for (i32 i = 0; i < 3; ++i)
+        values[i] = a[i][i];
+}
+
+/// 以给定的单位正交轴包住所有点的最小 obb
+NOVA_FUNC obb FitToAxes(std::span<const float3> points, const float3x3& axes)
+{
+    float3 lo{kInfinity}, hi{-kInfinity};
+    for (const auto& p : points) {
+        const float3 local{Dot(p, axes[0]), Dot(p, axes[1]), Dot(p, axes[2])};
+        lo = Min(lo, local);
+        hi = Max(hi, local);
+    }
+
+    const auto mid = (lo + hi) * 0.5f;
+    return {axes[0] * mid.x + axes[1] * mid.y + axes[2] * mid.z, axes, (hi - lo) * 0.5f};
+}
+
+} // namespace internal
+
+/**
+ * @brief 用主成分分析拟合点集的 obb。
+ *
+ * 以点集协方差矩阵的特征向量作为盒子的轴，再沿各轴投影求出范围。PCA 对分布不均匀的点集不一定给出最紧的盒子，
+ * 因此同时与世界坐标轴对齐的盒子比较，返回体积较小的一个。points 为空时返回默认的 obb。
+ */
+NOVA_FUNC obb FitOBB(std::span<const float3> points)
+{
+    if (points.empty())
+        return {};
+
+    f64 mean[3] = {0, 0, 0};
+    for (const auto& p : points) {
+        for (i32 i = 0; i < 3; ++i)
+            mean[i] += p[i];
+    }
+    for (auto& m : mean)
+        m /= f64(points.size());
+
+    f64 cov[3][3] = {};
+    for (const auto& p : points) {
+        const f64 d[3] = {p.x - mean[0], p.y - mean[1], p.z - mean[2]};
+        for (i32 i = 0; i < 3; ++i) {
+            for (i32 j = i; j < 3; ++j)
+                cov[i][j] += d[i] * d[j];
+        }
+    }
+    for (i32 i = 0; i < 3; ++i) {
+        for (i32 j = 0; j < i; ++j)
+            cov[i][j] = cov[j][i];
+    }
+
+    f64 vectors[3][3], values[3];
+    internal::SymmetricEigen(cov, vectors, values);
+
+    float3x3 axes{1.f};
+    for (i32 i = 0; i < 3; ++i)
+        axes[i] = Normalize(float3(f32(vectors[0][i]), f32(vectors[1][i]), f32(vectors[2][i])));
+
+    // 重新正交化并保证右手系
+    axes[1] = Normalize(axes[1] - axes[0] * Dot(axes[0], axes[1]));
+    axes[2] = Cross(axes[0], axes[1]);
+
+    const auto pca     = internal::FitToAxes(points, axes);
+    const auto aligned = internal::FitToAxes(points, float3x3{1.f});
+    return Volume(pca) < Volume(aligned) ? pca : aligned;
+}
+
+} // namespace nova
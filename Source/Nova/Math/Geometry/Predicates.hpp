@@ -0,0 +1,284 @@
+/**
+ * @File Predicates.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <array>
+#include "../Interval.hpp"
+#include "../Vector.hpp"
+
+namespace nova {
+
+namespace internal {
+
+// -------------------------
+// Shewchuk, Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates
+//
+// 单精度输入转换到双精度后用浮点展开 (若干个互不重叠、按绝对值递增的双精度数之和) 精确计算行列式。
+// -------------------------
+
+/**
+ * @brief 容量为 N 的浮点展开，各项按绝对值递增且不含 0，最后一项的符号即为整个展开的符号。
+ */
+template<size N> struct Expansion
+{
+    std::array<f64, N> terms;
+    size count = 0;
+
+    NOVA_FUNC f64 mostSignificant() const { return count == 0 ? 0.0 : terms[count - 1]; }
+
+    NOVA_FUNC void push(f64 v)
+    {
+        NOVA_ASSERT(count < N);
+        terms[count++] = v;
+    }
+};
+
+NOVA_FUNC void FastTwoSum(f64 a, f64 b, f64& x, f64& y)
+{
+    x               = a + b;
+    const auto bvir = x - a;
+    y               = b - bvir;
+}
+
+NOVA_FUNC void TwoSum(f64 a, f64 b, f64& x, f64& y)
+{
+    x               = a + b;
+    const auto bvir = x - a;
+    const auto avir = x - bvir;
+    y               = (a - avir) + (b - bvir);
+}
+
+NOVA_FUNC void TwoProduct(f64 a, f64 b, f64& x, f64& y)
+{
+    x = a * b;
+    y = Fma(a, b, -x);
+}
+
+/// a - b 的精确展开
+NOVA_FUNC Expansion<2> ExactDiff(f64 a, f64 b)
+{
+    Expansion<2> e;
+    f64 x, y;
+    TwoSum(a, -b, x, y);
+    if (y != 0)
+        e.push(y);
+    if (x != 0)
+        e.push(x);
+    return e;
+}
+
+/// 两个展开的和：按绝对值归并后依次累加 (fast_expansion_sum_zeroelim，每步都用精确的 TwoSum)
+template<size R, size N, size M> NOVA_FUNC Expansion<R> ExpansionSum(const Expansion<N>& e, const Expansion<M>& f)
+{
+    // 容量由调用者保证：结果的项数不超过两个展开的项数之和
+    Expansion<R> h;
+    if (e.count == 0 || f.count == 0) {
+        const auto& src = e.count == 0 ? f.terms.data() : e.terms.data();
+        const auto n    = e.count == 0 ? f.count : e.count;
+        for (size i = 0; i < n; ++i)
+            h.push(src[i]);
+        return h;
+    }
+
+    size ei = 0, fi = 0;
+    const auto next = [&](f64& v) {
+        const auto fromE = fi == f.count || (ei < e.count && ((f.terms[fi] > e.terms[ei]) == (f.terms[fi] > -e.terms[ei])));
+        v                = fromE ? e.terms[ei++] : f.terms[fi++];
+    };
+
+    f64 q, qNew, hh, v;
+    next(q);
+    while (ei < e.count || fi < f.count) {
+        next(v);
+        TwoSum(q, v, qNew, hh);
+        q = qNew;
+        if (hh != 0)
+            h.push(hh);
+    }
+
+    if (q != 0 || h.count == 0)
+        h.push(q);
+    return h;
+}
+
+/// 展开乘以一个双精度数 (scale_expansion_zeroelim)
+template<size N> NOVA_FUNC Expansion<2 * N> ExpansionScale(const Expansion<N>& e, f64 b)
+{
+    Expansion<2 * N> h;
+    if (e.count == 0)
+        return h;
+
+    f64 q, hh;
+    TwoProduct(e.terms[0], b, q, hh);
+    if (hh != 0)
+        h.push(hh);
+
+    for (size i = 1; i < e.count; ++i) {
+        f64 p1, p0, sum;
+        TwoProduct(e.terms[i], b, p1, p0);
+        TwoSum(q, p0, sum, hh);
+        if (hh != 0)
+            h.push(hh);
+        FastTwoSum(p1, sum, q, hh);
+        if (hh != 0)
+            h.push(hh);
+    }
+
+    if (q != 0 || h.count == 0)
+        h.push(q);
+    return h;
+}
+
+template<size N, size M> NOVA_FUNC Expansion<2 * N * M> ExpansionProduct(const Expansion<N>& e, const Expansion<M>& f)
+{
+    Expansion<2 * N * M> acc;
+    for (size i = 0; i < f.count; ++i)
+        acc = ExpansionSum<2 * N * M>(acc, ExpansionScale(e, f.terms[i]));
+    return acc;
+}
+
+template<size N> NOVA_FUNC Expansion<N> ExpansionNegate(Expansion<N> e)
+{
+    for (size i = 0; i < e.count; ++i)
+        e.terms[i] = -e.terms[i];
+    return e;
+}
+
+/// ab - cd
+template<size N> NOVA_FUNC Expansion<4 * N * N> ExactCross(const Expansion<N>& a, const Expansion<N>& b, const Expansion<N>& c, const Expansion<N>& d)
+{
+    return ExpansionSum<4 * N * N>(ExpansionProduct(a, b), ExpansionNegate(ExpansionProduct(c, d)));
+}
+
+// -------------------------
+// 行列式的直接求值，T 为 Interval 时得到包含精确值的区间，为 f64 时得到近似值
+// -------------------------
+
+template<typename T> NOVA_FUNC T Orient2DDet(const float2& a, const float2& b, const float2& c)
+{
+    const auto acx = T(a.x) - T(c.x), acy = T(a.y) - T(c.y);
+    const auto bcx = T(b.x) - T(c.x), bcy = T(b.y) - T(c.y);
+    return acx * bcy - acy * bcx;
+}
+
+template<typename T> NOVA_FUNC T Orient3DDet(const float3& a, const float3& b, const float3& c, const float3& d)
+{
+    const auto adx = T(a.x) - T(d.x), ady = T(a.y) - T(d.y), adz = T(a.z) - T(d.z);
+    const auto bdx = T(b.x) - T(d.x), bdy = T(b.y) - T(d.y), bdz = T(b.z) - T(d.z);
+    const auto cdx = T(c.x) - T(d.x), cdy = T(c.y) - T(d.y), cdz = T(c.z) - T(d.z);
+    return adz * (bdx * cdy - cdx * bdy) + bdz * (cdx * ady - adx * cdy) + cdz * (adx * bdy - bdx * ady);
+}
+
+template<typename T> NOVA_FUNC T InCircleDet(const float2& a, const float2& b, const float2& c, const float2& d)
+{
+    const auto adx = T(a.x) - T(d.x), ady = T(a.y) - T(d.y);
+    const auto bdx = T(b.x) - T(d.x), bdy = T(b.y) - T(d.y);
+    const auto cdx = T(c.x) - T(d.x), cdy = T(c.y) - T(d.y);
+
+    const auto alift = adx * adx + ady * ady;
+    const auto blift = bdx * bdx + bdy * bdy;
+    const auto clift = cdx * cdx + cdy * cdy;
+    return alift * (bdx * cdy - cdx * bdy) + blift * (cdx * ady - adx * cdy) + clift * (adx * bdy - bdx * ady);
+}
+
+// -------------------------
+// 精确求值
+// -------------------------
+
+NOVA_FUNC f64 Orient2DExact(const float2& a, const float2& b, const float2& c)
+{
+    const auto acx = ExactDiff(a.x, c.x), acy = ExactDiff(a.y, c.y);
+    const auto bcx = ExactDiff(b.x, c.x), bcy = ExactDiff(b.y, c.y);
+    return ExactCross(acx, bcy, acy, bcx).mostSignificant();
+}
+
+NOVA_FUNC f64 Orient3DExact(const float3& a, const float3& b, const float3& c, const float3& d)
+{
+    const auto adx = ExactDiff(a.x, d.x), ady = ExactDiff(a.y, d.y), adz = ExactDiff(a.z, d.z);
+    const auto bdx = ExactDiff(b.x, d.x), bdy = ExactDiff(b.y, d.y), bdz = ExactDiff(b.z, d.z);
+    const auto cdx = ExactDiff(c.x, d.x), cdy = ExactDiff(c.y, d.y), cdz = ExactDiff(c.z, d.z);
+
+    const auto ta = ExpansionProduct(adz, ExactCross(bdx, cdy, cdx, bdy));
+    const auto tb = ExpansionProduct(bdz, ExactCross(cdx, ady, adx, cdy));
+    const auto tc = ExpansionProduct(cdz, ExactCross(adx, bdy, bdx, ady));
+
+    return ExpansionSum<192>(ExpansionSum<128>(ta, tb), tc).mostSignificant();
+}
+
+NOVA_FUNC f64 InCircleExact(const float2& a, const float2& b, const float2& c, const float2& d)
+{
+    const auto adx = ExactDiff(a.x, d.x), ady = ExactDiff(a.y, d.y);
+    const auto bdx = ExactDiff(b.x, d.x), bdy = ExactDiff(b.y, d.y);
+    const auto cdx = ExactDiff(c.x, d.x), cdy = ExactDiff(c.y, d.y);
+
+    const auto lift = [](const Expansion<2>& x, const Expansion<2>& y) {
+        return ExpansionSum<16>(ExpansionProduct(x, x), ExpansionProduct(y, y));
+    };
+
+    const auto ta = ExpansionProduct(lift(adx, ady), ExactCross(bdx, cdy, cdx, bdy));
+    const auto tb = ExpansionProduct(lift(bdx, bdy), ExactCross(cdx, ady, adx, cdy));
+    const auto tc = ExpansionProduct(lift(cdx, cdy), ExactCross(adx, bdy, bdx, ady));
+
+    return ExpansionSum<1536>(ExpansionSum<1024>(ta, tb), tc).mostSignificant();
+}
+
+/**
+ * @brief 自适应求值：区间不含 0 时符号已确定，返回双精度的近似值 (与区间符号一致时)；否则精确计算。
+ */
+template<typename Filter, typename Approx, typename Exact>
+NOVA_FUNC f64 AdaptiveDet(Filter&& filter, Approx&& approx, Exact&& exact)
+{
+    const Interval det = filter();
+    if (const auto sign = det.sign(); sign != 0) {
+        const f64 v = approx();
+        if (Sign(v) == f64(sign))
+            return v;
+    }
+    return exact();
+}
+
+} // namespace internal
+
+/**
+ * @brief 二维朝向判定：a、b、c 逆时针排列 (c 在有向直线 ab 左侧) 时为正，顺时针为负，共线时恰为 0。
+ *
+ * 先用区间算术计算行列式，区间不含 0 时符号已经确定，返回双精度下的行列式 (两倍有向面积)；
+ * 只有近似共线时才退回浮点展开做精确计算。返回值的符号总是正确的。
+ */
+NOVA_FUNC f64 Orient2D(const float2& a, const float2& b, const float2& c)
+{
+    return internal::AdaptiveDet([&] { return internal::Orient2DDet<Interval>(a, b, c); },
+                                 [&] { return internal::Orient2DDet<f64>(a, b, c); },
+                                 [&] { return internal::Orient2DExact(a, b, c); });
+}
+
+/**
+ * @brief 三维朝向判定：d 位于平面 abc 下方 (从上方看 a、b、c 为逆时针) 时为正，上方为负，四点共面时恰为 0。
+ *
+ * 即行列式 det[a - d, b - d, c - d]，与 Shewchuk 的 orient3d 符号约定一致。过滤与回退策略同 Orient2D。
+ */
+NOVA_FUNC f64 Orient3D(const float3& a, const float3& b, const float3& c, const float3& d)
+{
+    return internal::AdaptiveDet([&] { return internal::Orient3DDet<Interval>(a, b, c, d); },
+                                 [&] { return internal::Orient3DDet<f64>(a, b, c, d); },
+                                 [&] { return internal::Orient3DExact(a, b, c, d); });
+}
+
+/**
+ * @brief 圆内判定：a、b、c 逆时针排列时，d 在其外接圆内为正，圆外为负，四点共圆时恰为 0。
+ *
+ * a、b、c 顺时针排列时符号相反。过滤与回退策略同 Orient2D。
+ */
+NOVA_FUNC f64 InCircle(const float2& a, const float2& b, const float2& c, const float2& d)
+{
+    return internal::AdaptiveDet([&] { return internal::InCircleDet<Interval>(a, b, c, d); },
+                                 [&] { return internal::InCircleDet<f64>(a, b, c, d); },
+                                 [&] { return internal::InCircleExact(a, b, c, d); });
+}
+
+} // namespace nova
@@ -0,0 +1,57 @@
+/**
+ * @File SoA.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <type_traits>
+#include "../Vector.hpp"
+
+namespace nova {
+
+/**
+ * @brief 以结构数组 (SoA) 形式存放的一组三维向量，不拥有数据。
+ *
+ * 批量几何查询以 SoA 为输入输出，每个分量连续存放，按分量处理时没有跨步读取。
+ * T 为 const f32 时只读，为 f32 时可写。
+ */
+template<typename T = const f32> struct Float3SoA
+{
+    static_assert(std::is_same_v<std::remove_const_t<T>, f32>);
+
+    std::span<T> x;
+    std::span<T> y;
+    std::span<T> z;
+
+    NOVA_FUNC Float3SoA() = default;
+
+    NOVA_FUNC Float3SoA(std::span<T> xs, std::span<T> ys, std::span<T> zs) : x(xs), y(ys), z(zs)
+    {
+        NOVA_CHECK(xs.size() == ys.size() && xs.size() == zs.size());
+    }
+
+    /// 可写的 SoA 可以隐式转换为只读的 SoA
+    template<typename U>
+        requires(std::is_const_v<T> && !std::is_const_v<U>)
+    NOVA_FUNC Float3SoA(const Float3SoA<U>& o) : x(o.x), y(o.y), z(o.z)
+    {
+    }
+
+    NOVA_FUNC size count() const { return x.size(); }
+
+    NOVA_FUNC float3 operator[](size i) const { return {x[i], y[i], z[i]}; }
+
+    NOVA_FUNC void store(size i, const float3& v) const
+        requires(!std::is_const_v<T>)
+    {
+        x[i] = v.x;
+        y[i] = v.y;
+        z[i] = v.z;
+    }
+};
+
+} // namespace nova
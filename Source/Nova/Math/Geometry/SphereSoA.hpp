@@ -0,0 +1,218 @@
+/**
+ * @File SphereSoA.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include "./Ray.hpp"
+#include "../Constants.hpp"
+
+#ifdef NOVA_HAS_AVX2
+#  include <immintrin.h>
+#endif
+
+namespace nova {
+
+/**
+ * @brief 射线与球的交点，t 为沿单位化方向的距离 (与 Ray::at 一致)。
+ */
+struct RaySphereHit
+{
+    f32 t     = kInfinity;
+    u32 index = ~0u; ///< 球的编号，没有相交时为 ~0u
+
+    NOVA_FUNC bool valid() const { return index != ~0u; }
+};
+
+/**
+ * @brief 以结构数组形式存放的一组球，用于射线拾取大量粒子。
+ *
+ * 球心与半径逐分量连续存放，按 kBlock 个球一组求交：组内先无分支地算出所有交点距离写入栈上的小数组，
+ * 再统一挑选结果。支持 AVX2 时前一步每次计算 8 个球，不足 8 个的尾部逐个计算。
+ * 与 Intersect.hpp 中的 IntersectRaySphere 不同，这里不需要 epsilon：起点附近的交点由射线的 tMin 排除，
+ * 起点在球内时返回离开球的交点。一组射线并行求交见 Parallel/SphereSoA.hpp。
+ */
+class SphereSoA
+{
+public:
+    static constexpr size kBlock = 16;
+
+    SphereSoA() = default;
+
+    SphereSoA(std::span<const float3> centers, std::span<const f32> radii)
+    {
+        NOVA_CHECK(centers.size() == radii.size());
+
+        reserve(centers.size());
+        for (size i = 0; i < centers.size(); ++i)
+            push(centers[i], radii[i]);
+    }
+
+    NOVA_FUNC size count() const { return _x.size(); }
+
+    void clear()
+    {
+        _x.clear();
+        _y.clear();
+        _z.clear();
+        _r.clear();
+    }
+
+    void reserve(size n)
+    {
+        _x.reserve(n);
+        _y.reserve(n);
+        _z.reserve(n);
+        _r.reserve(n);
+    }
+
+    void push(const float3& center, f32 radius)
+    {
+        _x.push_back(center.x);
+        _y.push_back(center.y);
+        _z.push_back(center.z);
+        _r.push_back(radius);
+    }
+
+    /// 粒子移动后原地更新
+    NOVA_FUNC void set(size i, const float3& center, f32 radius)
+    {
+        _x[i] = center.x;
+        _y[i] = center.y;
+        _z[i] = center.z;
+        _r[i] = radius;
+    }
+
+    NOVA_FUNC float3 center(size i) const { return {_x[i], _y[i], _z[i]}; }
+
+    NOVA_FUNC f32 radius(size i) const { return _r[i]; }
+
+    /**
+     * @brief 求射线在 [tMin, tMax) 内最近的交点。距离相同时取编号较小的球。
+     */
+    RaySphereHit intersect(const Ray& ray) const
+    {
+        RaySphereHit hit;
+        hit.t = ray.tMax;
+
+        const auto dir = Normalize(ray.dir);
+        std::array<f32, kBlock> t;
+
+        for (size base = 0; base < count(); base += kBlock) {
+            const auto n = Min(kBlock, count() - base);
+            intersectBlock(ray.origin, dir, ray.tMin, base, n, t);
+
+            for (size k = 0; k < n; ++k) {
+                if (t[k] < hit.t) {
+                    hit.t     = t[k];
+                    hit.index = u32(base + k);
+                }
+            }
+        }
+
+        // 没有交点时保持默认值，而不是 tMax
+        return hit.valid() ? hit : RaySphereHit{};
+    }
+
+    /**
+     * @brief 求射线在 [tMin, tMax) 内与所有球的交点，按球的编号顺序写入 out。
+     *
+     * @return 交点的总数。超过 out.size() 时多出的部分不写入，调用者可以据此扩大缓冲区后重新查询。
+     */
+    size intersectAll(const Ray& ray, std::span<RaySphereHit> out) const
+    {
+        const auto dir = Normalize(ray.dir);
+        std::array<f32, kBlock> t;
+
+        size hits = 0;
+        for (size base = 0; base < count(); base += kBlock) {
+            const auto n = Min(kBlock, count() - base);
+            intersectBlock(ray.origin, dir, ray.tMin, base, n, t);
+
+            for (size k = 0; k < n; ++k) {
+                if (t[k] >= ray.tMax)
+                    continue;
+                if (hits < out.size())
+                    out[hits] = {t[k], u32(base + k)};
+                ++hits;
+            }
+        }
+        return hits;
+    }
+
+private:
+    /**
+     * @brief 求单位方向的射线与 [base, base + n) 中每个球的交点距离，没有交点 (或交点都小于 tMin) 时为 kInfinity。
+     *
+     * 用球心到射线的垂足计算判别式 (Ray Tracing Gems 第 7 章)，远处的小球不会因为相减抵消而丢失精度。
+     */
+    NOVA_FUNC void
+    intersectBlock(const float3& o, const float3& d, f32 tMin, size base, size n, std::array<f32, kBlock>& out) const
+    {
+        const auto* px = _x.data() + base;
+        const auto* py = _y.data() + base;
+        const auto* pz = _z.data() + base;
+        const auto* pr = _r.data() + base;
+
+        size k = 0;
+#ifdef NOVA_HAS_AVX2
+        // 与下面的逐个计算相同，比较的结果用作掩码选择 t0/t1 与 kInfinity
+        const auto ox   = _mm256_set1_ps(o.x), oy = _mm256_set1_ps(o.y), oz = _mm256_set1_ps(o.z);
+        const auto dx   = _mm256_set1_ps(d.x), dy = _mm256_set1_ps(d.y), dz = _mm256_set1_ps(d.z);
+        const auto lo   = _mm256_set1_ps(tMin);
+        const auto zero = _mm256_setzero_ps();
+        const auto inf  = _mm256_set1_ps(kInfinity);
+
+        for (; k + 8 <= n; k += 8) {
+            const auto fx = _mm256_sub_ps(_mm256_loadu_ps(px + k), ox);
+            const auto fy = _mm256_sub_ps(_mm256_loadu_ps(py + k), oy);
+            const auto fz = _mm256_sub_ps(_mm256_loadu_ps(pz + k), oz);
+            const auto b  = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(fx, dx), _mm256_mul_ps(fy, dy)),
+                                          _mm256_mul_ps(fz, dz));
+
+            const auto lx   = _mm256_sub_ps(fx, _mm256_mul_ps(b, dx));
+            const auto ly   = _mm256_sub_ps(fy, _mm256_mul_ps(b, dy));
+            const auto lz   = _mm256_sub_ps(fz, _mm256_mul_ps(b, dz));
+            const auto l2   = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(lx, lx), _mm256_mul_ps(ly, ly)),
+                                            _mm256_mul_ps(lz, lz));
+            const auto r    = _mm256_loadu_ps(pr + k);
+            const auto disc = _mm256_sub_ps(_mm256_mul_ps(r, r), l2);
+            const auto s    = _mm256_sqrt_ps(_mm256_max_ps(disc, zero));
+
+            const auto t0  = _mm256_sub_ps(b, s), t1 = _mm256_add_ps(b, s);
+            const auto t   = _mm256_blendv_ps(t1, t0, _mm256_cmp_ps(t0, lo, _CMP_GE_OQ));
+            const auto hit = _mm256_and_ps(_mm256_cmp_ps(disc, zero, _CMP_GE_OQ), _mm256_cmp_ps(t, lo, _CMP_GE_OQ));
+            _mm256_storeu_ps(out.data() + k, _mm256_blendv_ps(inf, t, hit));
+        }
+#endif
+
+        for (; k < n; ++k) {
+            const auto fx = px[k] - o.x, fy = py[k] - o.y, fz = pz[k] - o.z;
+            const auto b  = fx * d.x + fy * d.y + fz * d.z;
+
+            const auto lx = fx - b * d.x, ly = fy - b * d.y, lz = fz - b * d.z;
+            const auto disc = pr[k] * pr[k] - (lx * lx + ly * ly + lz * lz);
+            const auto s    = Sqrt(Max(disc, 0.f));
+
+            // 用按位与代替 &&，避免短路求值在循环中引入分支
+            const auto t0  = b - s, t1 = b + s;
+            const auto t   = t0 >= tMin ? t0 : t1;
+            const bool hit = (disc >= 0.f) & (t >= tMin);
+            out[k]         = hit ? t : kInfinity;
+        }
+    }
+
+    std::vector<f32> _x;
+    std::vector<f32> _y;
+    std::vector<f32> _z;
+    std::vector<f32> _r;
+};
+
+} // namespace nova
@@ -0,0 +1,287 @@
+/**
+ * @File SweepAndPrune.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <span>
+#include <vector>
+
+#include "./Bounds.hpp"
+
+namespace nova {
+
+/**
+ * @brief 一对包围盒相互重叠的代理，满足 a < b。
+ */
+struct BroadphasePair
+{
+    u32 a;
+    u32 b;
+
+    NOVA_FUNC bool operator==(const BroadphasePair&) const = default;
+
+    NOVA_FUNC u64 key() const { return (u64(a) << 32) | b; }
+};
+
+/**
+ * @brief 两次 commit 之间重叠对的变化。
+ */
+struct BroadphaseDelta
+{
+    std::vector<BroadphasePair> added;   ///< 新开始重叠的代理对
+    std::vector<BroadphasePair> removed; ///< 不再重叠 (或有一方被移除) 的代理对
+};
+
+/**
+ * @brief 持久化的扫描裁剪 (sweep and prune) 宽相位。
+ *
+ * 代理按包围盒在某一轴上的最小值排序，每次 commit 时对上一帧的顺序做插入排序：物体连续运动时顺序几乎不变，
+ * 排序接近线性。排序轴取包围盒中心方差最大的轴，使沿该轴的区间尽量分散。
+ * 沿排序轴扫描得到候选后，其余两个轴的重叠测试按块先算出掩码再收集结果，算掩码的循环能被自动向量化。
+ *
+ * add / remove / update 只记录修改，commit 统一处理并返回与上一次 commit 相比新增和消失的重叠对。
+ * 被移除代理的编号在 commit 之后才会被复用。
+ */
+class SweepAndPrune
+{
+public:
+    SweepAndPrune() = default;
+
+    /// 添加代理并返回其编号
+    u32 add(const aabb& box)
+    {
+        u32 id;
+        if (!_freeIds.empty()) {
+            id = _freeIds.back();
+            _freeIds.pop_back();
+            _boxes[id]  = box;
+            _states[id] = kAlive;
+        }
+        else {
+            id = cast_to<u32>(_boxes.size());
+            _boxes.push_back(box);
+            _states.push_back(kAlive);
+        }
+
+        _added.push_back(id);
+        ++_count;
+        return id;
+    }
+
+    void remove(u32 id)
+    {
+        NOVA_CHECK(id < _states.size() && _states[id] == kAlive);
+
+        _states[id] = kRemoved;
+        _removed.push_back(id);
+        --_count;
+    }
+
+    void update(u32 id, const aabb& box)
+    {
+        NOVA_CHECK(id < _states.size() && _states[id] == kAlive);
+        _boxes[id] = box;
+    }
+
+    NOVA_FUNC const aabb& box(u32 id) const { return _boxes[id]; }
+
+    /// 当前的代理数量
+    NOVA_FUNC size count() const { return _count; }
+
+    /// 当前的排序轴
+    NOVA_FUNC i32 axis() const { return _axis; }
+
+    /// 上一次 commit 时所有重叠的代理对，按 (a, b) 排序
+    NOVA_FUNC std::span<const BroadphasePair> pairs() const { return _pairs; }
+
+    /**
+     * @brief 处理自上一次 commit 以来的所有修改，返回重叠对的变化。
+     *
+     * 返回的引用在下一次 commit 之前有效。
+     */
+    const BroadphaseDelta& commit()
+    {
+        applyMembership();
+        chooseAxis();
+        sortAxis();
+        sweep();
+        diffPairs();
+
+        for (const auto id : _removed) {
+            _states[id] = kFree;
+            _freeIds.push_back(id);
+        }
+        _removed.clear();
+        _added.clear();
+
+        return _delta;
+    }
+
+private:
+    static constexpr u8 kFree    = 0;
+    static constexpr u8 kAlive   = 1;
+    static constexpr u8 kRemoved = 2;
+
+    /// 方差超过当前轴的该倍数时才切换排序轴，避免在两个轴之间反复切换
+    static constexpr Float kAxisHysteresis = 1.5f;
+
+    /// 将新增的代理追加到排序序列末尾，并去掉已移除的代理
+    void applyMembership()
+    {
+        if (!_removed.empty()) {
+            std::erase_if(_order, [this](u32 id) { return _states[id] != kAlive; });
+
+            // 同一帧内添加又移除的代理不会进入排序序列
+            std::erase_if(_added, [this](u32 id) { return _states[id] != kAlive; });
+        }
+
+        _order.insert(_order.end(), _added.begin(), _added.end());
+    }
+
+    void chooseAxis()
+    {
+        if (_order.empty())
+            return;
+
+        vec<3, Float> sum{0}, sumSq{0};
+        for (const auto id : _order) {
+            const auto c  = _boxes[id].center();
+            sum          += c;
+            sumSq        += c * c;
+        }
+
+        const auto n        = Float(_order.size());
+        const auto variance = sumSq / n - (sum / n) * (sum / n);
+
+        const auto best = MaxIndex(variance);
+        if (best != _axis && variance[best] > variance[_axis] * kAxisHysteresis) {
+            _axis = best;
+
+            // 换轴后上一帧的顺序不再有意义，直接完整排序
+            std::sort(_order.begin(), _order.end(), [this](u32 l, u32 r) {
+                return _boxes[l].minPoint[_axis] < _boxes[r].minPoint[_axis];
+            });
+        }
+    }
+
+    /// 在上一帧顺序的基础上做插入排序，同时按新顺序整理各轴区间的 SoA 数据
+    void sortAxis()
+    {
+        const auto n = _order.size();
+        _keys.resize(n);
+        for (size i = 0; i < n; ++i)
+            _keys[i] = _boxes[_order[i]].minPoint[_axis];
+
+        for (size i = 1; i < n; ++i) {
+            const auto key = _keys[i];
+            const auto id  = _order[i];
+
+            auto j = i;
+            for (; j > 0 && _keys[j - 1] > key; --j) {
+                _keys[j]  = _keys[j - 1];
+                _order[j] = _order[j - 1];
+            }
+            _keys[j]  = key;
+            _order[j] = id;
+        }
+
+        const auto axis1 = (_axis + 1) % 3;
+        const auto axis2 = (_axis + 2) % 3;
+
+        _maxKeys.resize(n);
+        for (auto& v : _others)
+            v.resize(n);
+
+        for (size i = 0; i < n; ++i) {
+            const auto& b = _boxes[_order[i]];
+            _maxKeys[i]   = b.maxPoint[_axis];
+            _others[0][i] = b.minPoint[axis1];
+            _others[1][i] = b.maxPoint[axis1];
+            _others[2][i] = b.minPoint[axis2];
+            _others[3][i] = b.maxPoint[axis2];
+        }
+    }
+
+    void sweep()
+    {
+        constexpr size kBlock = 16;
+
+        const auto n = _order.size();
+        _current.clear();
+
+        std::array<u8, kBlock> mask;
+
+        for (size i = 0; i < n; ++i) {
+            const auto maxA = _maxKeys[i];
+
+            // 排序轴上与 i 重叠的代理是 i 之后连续的一段
+            auto end = i + 1;
+            while (end < n && _keys[end] <= maxA)
+                ++end;
+
+            const auto min1 = _others[0][i], max1 = _others[1][i];
+            const auto min2 = _others[2][i], max2 = _others[3][i];
+
+            for (auto base = i + 1; base < end; base += kBlock) {
+                const auto count = Min(kBlock, end - base);
+
+                const auto* lo1 = _others[0].data() + base;
+                const auto* hi1 = _others[1].data() + base;
+                const auto* lo2 = _others[2].data() + base;
+                const auto* hi2 = _others[3].data() + base;
+
+                for (size k = 0; k < count; ++k)
+                    mask[k] = (lo1[k] <= max1) & (hi1[k] >= min1) & (lo2[k] <= max2) & (hi2[k] >= min2);
+
+                for (size k = 0; k < count; ++k) {
+                    if (mask[k]) {
+                        const auto a = _order[i], b = _order[base + k];
+                        _current.push_back(a < b ? BroadphasePair{a, b} : BroadphasePair{b, a});
+                    }
+                }
+            }
+        }
+
+        std::sort(_current.begin(), _current.end(), [](const auto& l, const auto& r) { return l.key() < r.key(); });
+    }
+
+    void diffPairs()
+    {
+        _delta.added.clear();
+        _delta.removed.clear();
+
+        const auto less = [](const BroadphasePair& l, const BroadphasePair& r) { return l.key() < r.key(); };
+        std::set_difference(_current.begin(), _current.end(), _pairs.begin(), _pairs.end(),
+                            std::back_inserter(_delta.added), less);
+        std::set_difference(_pairs.begin(), _pairs.end(), _current.begin(), _current.end(),
+                            std::back_inserter(_delta.removed), less);
+
+        std::swap(_pairs, _current);
+    }
+
+    std::vector<aabb> _boxes;
+    std::vector<u8> _states;
+    std::vector<u32> _freeIds;
+    std::vector<u32> _added;
+    std::vector<u32> _removed;
+    size _count = 0;
+
+    i32 _axis = 0;
+    std::vector<u32> _order;                   ///< 按排序轴最小值排序的代理编号
+    std::vector<Float> _keys;                  ///< 排序轴上的最小值
+    std::vector<Float> _maxKeys;               ///< 排序轴上的最大值
+    std::array<std::vector<Float>, 4> _others; ///< 其余两个轴的最小值与最大值
+
+    std::vector<BroadphasePair> _pairs;
+    std::vector<BroadphasePair> _current;
+    BroadphaseDelta _delta;
+};
+
+} // namespace nova
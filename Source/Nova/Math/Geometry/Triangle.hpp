@@ -7,20 +7,800 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory_resource>
+#include <set>
+#include <span>
+#include <vector>
+
+#include "./Predicates.hpp"
 #include "../Vector.hpp"
 
 namespace nova {
 
+/**
+ * @brief 二维多边形的只读视图。
+ *
+ * ringEnds 记录每个环在 points 中的结束位置：第一个环为外边界，其余为孔洞。
+ * ringEnds 为空时 points 整体视为一个没有孔洞的环。环的朝向任意，首尾不需要重复。
+ */
+struct Polygon2D
+{
+    std::span<const float2> points;
+    std::span<const u32> ringEnds;
+};
+
+/**
+ * @brief 多边形三角化。
+ *
+ * 先通过扫描线将多边形 (可带孔洞) 分解为 y 单调的子多边形，再用栈逐个三角化，整体复杂度 O(n log n)。
+ * 单调分解失败时退化为桥接孔洞后的耳切法，耳切法也失败时报告失败，而不是输出错误的三角形。
+ * 对象内部持有临时缓冲区，批量处理时应复用同一个对象；不同线程需使用不同的对象。
+ * 并行处理多个多边形见 Parallel/Triangle.hpp 中的 ParallelTriangulate。
+ */
 class Triangulate
 {
 public:
+    Triangulate() = default;
+
+    // 状态结构的比较器持有 this，因此不可复制
+    Triangulate(const Triangulate&)            = delete;
+    Triangulate& operator=(const Triangulate&) = delete;
+
     template<typename T>
     NOVA_FUNC vec3_t<T> ComputeNormal(const vec3_t<T>& p1, const vec3_t<T>& p2, const vec3_t<T>& p3)
     {
         return Normalize(Cross(p1 - p2, p1 - p3));
     }
 
-    // TODO: CheckInside, ComputeArea
+    /**
+     * @brief 二维朝向判定：c 在有向直线 ab 左侧时为正，右侧为负，共线为 0。
+     *
+     * 使用自适应精度的 Orient2D：一般情况下只做单精度区间运算，近似共线时才精确计算，符号总是可靠的。
+     */
+    NOVA_FUNC static f64 Orient(const float2& a, const float2& b, const float2& c) { return Orient2D(a, b, c); }
+
+    /// 三角形面积
+    template<typename T> NOVA_FUNC static T ComputeArea(const vec3_t<T>& p1, const vec3_t<T>& p2, const vec3_t<T>& p3)
+    {
+        return T(0.5) * Length(Cross(p2 - p1, p3 - p1));
+    }
+
+    /// 二维三角形的有向面积，逆时针为正
+    template<typename T> NOVA_FUNC static T ComputeArea(const vec2_t<T>& p1, const vec2_t<T>& p2, const vec2_t<T>& p3)
+    {
+        return T(0.5) * ((p2.x - p1.x) * (p3.y - p1.y) - (p3.x - p1.x) * (p2.y - p1.y));
+    }
+
+    /// 简单多边形的有向面积，逆时针为正
+    NOVA_FUNC static f64 ComputeArea(std::span<const float2> ring)
+    {
+        f64 area = 0;
+        for (size i = 0, j = ring.size() - 1; i < ring.size(); j = i++)
+            area += f64(ring[j].x) * f64(ring[i].y) - f64(ring[i].x) * f64(ring[j].y);
+        return area * 0.5;
+    }
+
+    /// 批量计算索引三角形的面积
+    NOVA_FUNC static void ComputeArea(std::span<const float3> positions, std::span<const u32> indices, std::span<f32> areas)
+    {
+        NOVA_CHECK(areas.size() >= indices.size() / 3);
+
+        const auto count = indices.size() / 3;
+        for (size i = 0; i < count; ++i) {
+            const auto& p1 = positions[indices[i * 3 + 0]];
+            const auto& p2 = positions[indices[i * 3 + 1]];
+            const auto& p3 = positions[indices[i * 3 + 2]];
+
+            const auto e1 = p2 - p1;
+            const auto e2 = p3 - p1;
+            const auto cx = e1.y * e2.z - e1.z * e2.y;
+            const auto cy = e1.z * e2.x - e1.x * e2.z;
+            const auto cz = e1.x * e2.y - e1.y * e2.x;
+            areas[i]      = 0.5f * std::sqrt(cx * cx + cy * cy + cz * cz);
+        }
+    }
+
+    /// 点 p 是否位于三角形 abc 内 (包括边界)，与三角形的朝向无关
+    NOVA_FUNC static bool CheckInside(const float2& p, const float2& a, const float2& b, const float2& c)
+    {
+        const auto d0 = Orient(a, b, p);
+        const auto d1 = Orient(b, c, p);
+        const auto d2 = Orient(c, a, p);
+        return (d0 >= 0 && d1 >= 0 && d2 >= 0) || (d0 <= 0 && d1 <= 0 && d2 <= 0);
+    }
+
+    /// 批量判断点是否位于三角形 abc 内，三个符号测试用按位运算合并，循环中没有分支
+    NOVA_FUNC static void
+    CheckInside(std::span<const float2> points, const float2& a, const float2& b, const float2& c, std::span<u8> inside)
+    {
+        NOVA_CHECK(inside.size() >= points.size());
+
+        const auto e0 = b - a;
+        const auto e1 = c - b;
+        const auto e2 = a - c;
+
+        for (size i = 0; i < points.size(); ++i) {
+            const auto& p = points[i];
+            const auto d0 = e0.x * (p.y - a.y) - e0.y * (p.x - a.x);
+            const auto d1 = e1.x * (p.y - b.y) - e1.y * (p.x - b.x);
+            const auto d2 = e2.x * (p.y - c.y) - e2.y * (p.x - c.x);
+
+            const auto pos = (d0 >= 0.f) & (d1 >= 0.f) & (d2 >= 0.f);
+            const auto neg = (d0 <= 0.f) & (d1 <= 0.f) & (d2 <= 0.f);
+            inside[i]      = u8(pos | neg);
+        }
+    }
+
+    /**
+     * @brief 三角化多边形，结果以逆时针三角形的形式追加到 indices，索引指向 polygon.points。
+     * @return 外边界退化，或自相交、孔洞不在外边界内部等导致无法正确三角化时返回 false，此时 indices 保持不变。
+     */
+    bool operator()(const Polygon2D& polygon, std::vector<u32>& indices)
+    {
+        if (!build(polygon))
+            return false;
+
+        const auto start = indices.size();
+        if (monotone(indices))
+            return true;
+
+        indices.resize(start);
+        if (earClip(indices))
+            return true;
+
+        indices.resize(start);
+        return false;
+    }
+
+private:
+    static constexpr u32 kInvalid = ~0u;
+
+    enum class VertexType : u8
+    {
+        Start,
+        End,
+        Split,
+        Merge,
+        Regular,
+    };
+
+    /// 在状态结构中按顶点查找时使用的键
+    struct VertexKey
+    {
+        u32 v;
+    };
+
+    /// 状态结构中的边按从左到右排序
+    struct EdgeOrder
+    {
+        using is_transparent = void;
+
+        const Triangulate* self;
+
+        bool operator()(u32 e, u32 f) const { return self->edgeLess(e, f); }
+
+        bool operator()(u32 e, VertexKey k) const { return self->side(e, k.v) > 0; }
+
+        bool operator()(VertexKey k, u32 e) const { return self->side(e, k.v) < 0; }
+    };
+
+    using StatusSet = std::pmr::set<u32, EdgeOrder>;
+
+    // 多边形顶点，环内通过 prev/next 相连
+    std::vector<float2> _pos;
+    std::vector<u32> _index;
+    std::vector<u32> _prev;
+    std::vector<u32> _next;
+    std::vector<u32> _ringFirst;
+
+    // 单调分解
+    std::vector<u32> _order;
+    std::vector<u32> _rank;
+    std::vector<VertexType> _types;
+    std::pmr::monotonic_buffer_resource _arena;
+    StatusSet _status{EdgeOrder{this}, &_arena};
+    std::vector<StatusSet::iterator> _statusIt;
+    std::vector<u32> _helper;
+    std::vector<std::pair<u32, u32>> _diagonals;
+
+    // 子多边形提取与三角化
+    std::vector<u32> _outOffsets;
+    std::vector<u32> _outTargets;
+    std::vector<u8> _visited;
+    std::vector<u32> _face;
+    std::vector<u32> _sorted;
+    std::vector<u8> _isLeft;
+    std::vector<u32> _stack;
+
+    /// 收集有效的环并统一朝向：外边界逆时针，孔洞顺时针
+    bool build(const Polygon2D& polygon)
+    {
+        _pos.clear();
+        _index.clear();
+        _prev.clear();
+        _next.clear();
+        _ringFirst.clear();
+
+        const auto ringCount = polygon.ringEnds.empty() ? size(1) : polygon.ringEnds.size();
+
+        u32 ringBegin = 0;
+        for (size r = 0; r < ringCount; ++r) {
+            const auto ringEnd = polygon.ringEnds.empty() ? cast_to<u32>(polygon.points.size()) : polygon.ringEnds[r];
+            const auto first   = cast_to<u32>(_pos.size());
+
+            // 去除连续重复的点
+            for (auto i = ringBegin; i < ringEnd; ++i) {
+                const auto& p = polygon.points[i];
+                if (_pos.size() > first && all_eq(_pos.back(), p))
+                    continue;
+                _pos.push_back(p);
+                _index.push_back(i);
+            }
+            while (_pos.size() > first + 1 && all_eq(_pos.back(), _pos[first])) {
+                _pos.pop_back();
+                _index.pop_back();
+            }
+
+            ringBegin = ringEnd;
+
+            const auto count = cast_to<u32>(_pos.size()) - first;
+            const auto area  = count >= 3 ? ComputeArea(std::span<const float2>(_pos.data() + first, count)) : 0.0;
+            if (area == 0) {
+                _pos.resize(first);
+                _index.resize(first);
+
+                if (r == 0)
+                    return false;
+                continue;
+            }
+
+            if ((r == 0) != (area > 0)) {
+                std::reverse(_pos.begin() + first, _pos.end());
+                std::reverse(_index.begin() + first, _index.end());
+            }
+
+            for (u32 i = 0; i < count; ++i) {
+                _prev.push_back(first + (i + count - 1) % count);
+                _next.push_back(first + (i + 1) % count);
+            }
+            _ringFirst.push_back(first);
+        }
+
+        return true;
+    }
+
+    /// 按扫描顺序 (y 从大到小，x 从小到大) 比较两个顶点
+    bool above(u32 a, u32 b) const
+    {
+        const auto& pa = _pos[a];
+        const auto& pb = _pos[b];
+        return pa.y > pb.y || (pa.y == pb.y && (pa.x < pb.x || (pa.x == pb.x && a < b)));
+    }
+
+    f64 orient(u32 a, u32 b, u32 c) const { return Orient(_pos[a], _pos[b], _pos[c]); }
+
+    u32 upper(u32 e) const { return _rank[e] < _rank[_next[e]] ? e : _next[e]; }
+
+    u32 lower(u32 e) const { return _rank[e] < _rank[_next[e]] ? _next[e] : e; }
+
+    /// 边 e 是否位于边 f 的左侧；状态结构中的边互不相交，因此只需比较较晚开始的边的端点
+    bool edgeLess(u32 e, u32 f) const
+    {
+        if (e == f)
+            return false;
+
+        const auto eu = upper(e), el = lower(e);
+        const auto fu = upper(f), fl = lower(f);
+
+        if (_rank[eu] >= _rank[fu]) {
+            auto s = orient(fu, fl, eu);
+            if (s == 0)
+                s = orient(fu, fl, el);
+            return s < 0;
+        }
+
+        auto s = orient(eu, el, fu);
+        if (s == 0)
+            s = orient(eu, el, fl);
+        return s > 0;
+    }
+
+    /// 顶点 v 相对于边 e 的位置：在右侧时为正
+    f64 side(u32 e, u32 v) const { return orient(upper(e), lower(e), v); }
+
+    void insertEdge(u32 e, u32 helper)
+    {
+        _statusIt[e] = _status.insert(e).first;
+        _helper[e]   = helper;
+    }
+
+    bool removeEdge(u32 e)
+    {
+        if (_helper[e] == kInvalid || _statusIt[e] == _status.end())
+            return false;
+
+        _status.erase(_statusIt[e]);
+        _statusIt[e] = _status.end();
+        return true;
+    }
+
+    /// 状态结构中位于顶点 v 正左侧的边
+    u32 edgeLeftOf(u32 v) const
+    {
+        const auto it = _status.lower_bound(VertexKey{v});
+        return it == _status.begin() ? kInvalid : *std::prev(it);
+    }
+
+    void connectToHelper(u32 v, u32 e, bool onlyMerge)
+    {
+        const auto h = _helper[e];
+        if (!onlyMerge || _types[h] == VertexType::Merge)
+            _diagonals.emplace_back(v, h);
+    }
+
+    bool monotone(std::vector<u32>& indices)
+    {
+        const auto n = cast_to<u32>(_pos.size());
+
+        _order.resize(n);
+        for (u32 i = 0; i < n; ++i)
+            _order[i] = i;
+        std::sort(_order.begin(), _order.end(), [&](u32 a, u32 b) { return above(a, b); });
+
+        _rank.resize(n);
+        for (u32 i = 0; i < n; ++i)
+            _rank[_order[i]] = i;
+
+        _types.resize(n);
+        for (u32 v = 0; v < n; ++v) {
+            const auto prevBelow = _rank[_prev[v]] > _rank[v];
+            const auto nextBelow = _rank[_next[v]] > _rank[v];
+            const auto convex    = orient(_prev[v], v, _next[v]) > 0;
+
+            if (prevBelow && nextBelow)
+                _types[v] = convex ? VertexType::Start : VertexType::Split;
+            else if (!prevBelow && !nextBelow)
+                _types[v] = convex ? VertexType::End : VertexType::Merge;
+            else
+                _types[v] = VertexType::Regular;
+        }
+
+        // 扫描线：边 e 指顶点 e 到 next[e] 的边，状态结构中只保存内部位于其右侧的边
+        _status.clear();
+        _arena.release();
+        _statusIt.assign(n, _status.end());
+        _helper.assign(n, kInvalid);
+        _diagonals.clear();
+
+        for (const auto v : _order) {
+            const auto ePrev = _prev[v];
+
+            switch (_types[v]) {
+            case VertexType::Start: insertEdge(v, v); break;
+
+            case VertexType::End:
+                if (_helper[ePrev] == kInvalid)
+                    return false;
+                connectToHelper(v, ePrev, true);
+                if (!removeEdge(ePrev))
+                    return false;
+                break;
+
+            case VertexType::Split: {
+                const auto e = edgeLeftOf(v);
+                if (e == kInvalid)
+                    return false;
+                connectToHelper(v, e, false);
+                _helper[e] = v;
+                insertEdge(v, v);
+            } break;
+
+            case VertexType::Merge: {
+                if (_helper[ePrev] == kInvalid)
+                    return false;
+                connectToHelper(v, ePrev, true);
+                if (!removeEdge(ePrev))
+                    return false;
+
+                const auto e = edgeLeftOf(v);
+                if (e == kInvalid)
+                    return false;
+                connectToHelper(v, e, true);
+                _helper[e] = v;
+            } break;
+
+            case VertexType::Regular:
+                // 下一个顶点在下方：位于左链上，内部在右侧
+                if (_rank[_next[v]] > _rank[v]) {
+                    if (_helper[ePrev] == kInvalid)
+                        return false;
+                    connectToHelper(v, ePrev, true);
+                    if (!removeEdge(ePrev))
+                        return false;
+                    insertEdge(v, v);
+                }
+                else {
+                    const auto e = edgeLeftOf(v);
+                    if (e == kInvalid)
+                        return false;
+                    connectToHelper(v, e, true);
+                    _helper[e] = v;
+                }
+                break;
+            }
+        }
+
+        if (!_status.empty())
+            return false;
+
+        return triangulateFaces(indices);
+    }
+
+    /// 沿多边形边与对角线提取各个单调子多边形，并逐个三角化
+    bool triangulateFaces(std::vector<u32>& indices)
+    {
+        const auto n = cast_to<u32>(_pos.size());
+
+        // 每个顶点的出边：多边形边 v -> next[v]，以及对角线的两个方向
+        _outOffsets.assign(n + 1, 0);
+        for (u32 v = 0; v < n; ++v)
+            _outOffsets[v + 1] = 1;
+        for (const auto& [a, b] : _diagonals) {
+            _outOffsets[a + 1]++;
+            _outOffsets[b + 1]++;
+        }
+        for (u32 v = 0; v < n; ++v)
+            _outOffsets[v + 1] += _outOffsets[v];
+
+        const auto halfEdgeCount = _outOffsets[n];
+        _outTargets.resize(halfEdgeCount);
+        {
+            std::vector<u32>& cursor = _sorted;
+            cursor.assign(_outOffsets.begin(), _outOffsets.end() - 1);
+            for (u32 v = 0; v < n; ++v)
+                _outTargets[cursor[v]++] = _next[v];
+            for (const auto& [a, b] : _diagonals) {
+                _outTargets[cursor[a]++] = b;
+                _outTargets[cursor[b]++] = a;
+            }
+        }
+
+        _visited.assign(halfEdgeCount, 0);
+
+        const auto expected = indices.size() + 3 * (size(n) + 2 * _ringFirst.size() - 4);
+
+        for (u32 start = 0; start < n; ++start) {
+            for (auto h = _outOffsets[start]; h < _outOffsets[start + 1]; ++h) {
+                if (_visited[h])
+                    continue;
+
+                _face.clear();
+
+                auto from = start;
+                auto edge = h;
+                while (!_visited[edge]) {
+                    _visited[edge] = 1;
+                    _face.push_back(from);
+
+                    const auto to = _outTargets[edge];
+                    edge          = nextHalfEdge(from, to);
+                    from          = to;
+
+                    if (_face.size() > n)
+                        return false;
+                }
+
+                if (edge != h || _face.size() < 3)
+                    return false;
+
+                triangulateMonotone(indices);
+            }
+        }
+
+        return indices.size() == expected;
+    }
+
+    /**
+     * @brief 从 o -> back 顺时针旋转到 o -> t 的角度所在的区间：0 为右侧半平面，1 恰为反方向，2 为左侧半平面，
+     * 3 与 back 同向。
+     */
+    u32 turnClass(u32 o, u32 back, u32 t) const
+    {
+        const auto side = orient(o, back, t);
+        if (side != 0)
+            return side < 0 ? 0 : 2;
+
+        // 共线时按坐标的比较判断方向，不需要做减法
+        const auto sign  = [](f32 x, f32 y) { return i32(x > y) - i32(x < y); };
+        const auto& p    = _pos[o];
+        const bool sameX = sign(_pos[t].x, p.x) == sign(_pos[back].x, p.x);
+        const bool sameY = sign(_pos[t].y, p.y) == sign(_pos[back].y, p.y);
+        return sameX && sameY ? 3 : 1;
+    }
+
+    /**
+     * @brief 到达 to 之后，取从反方向 (to -> from) 顺时针旋转遇到的第一条出边。
+     *
+     * 角度的比较全部由 Orient2D 完成：先比较所在的半平面，同一半平面内的两条边夹角小于 pi，
+     * 其中一条在另一条的顺时针方向即说明它更晚被遇到。近似共线的扇形边也能得到正确的顺序。
+     */
+    u32 nextHalfEdge(u32 from, u32 to) const
+    {
+        const auto begin = _outOffsets[to];
+        const auto end   = _outOffsets[to + 1];
+        if (end - begin == 1)
+            return begin;
+
+        auto best     = end;
+        u32 bestClass = 0;
+        for (auto h = begin; h < end; ++h) {
+            const auto t = _outTargets[h];
+            if (t == from)
+                continue;
+
+            const auto c = turnClass(to, from, t);
+            if (best == end || c < bestClass ||
+                (c == bestClass && (c == 0 || c == 2) && orient(to, t, _outTargets[best]) < 0)) {
+                best      = h;
+                bestClass = c;
+            }
+        }
+
+        return best == end ? begin : best;
+    }
+
+    void emit(std::vector<u32>& indices, u32 a, u32 b, u32 c) const
+    {
+        if (orient(a, b, c) < 0)
+            std::swap(b, c);
+        indices.insert(indices.end(), {_index[a], _index[b], _index[c]});
+    }
+
+    /// 对逆时针的 y 单调多边形 _face 进行栈式三角化
+    void triangulateMonotone(std::vector<u32>& indices)
+    {
+        const auto k = cast_to<u32>(_face.size());
+        if (k == 3) {
+            emit(indices, _face[0], _face[1], _face[2]);
+            return;
+        }
+
+        u32 top = 0, bottom = 0;
+        for (u32 i = 1; i < k; ++i) {
+            if (_rank[_face[i]] < _rank[_face[top]])
+                top = i;
+            if (_rank[_face[i]] > _rank[_face[bottom]])
+                bottom = i;
+        }
+
+        // 从最高点沿逆时针方向向下的是左链，沿顺时针方向向下的是右链，合并两条链得到扫描顺序
+        _sorted.clear();
+        _isLeft.clear();
+        _sorted.push_back(_face[top]);
+        _isLeft.push_back(1);
+
+        auto l = (top + 1) % k;
+        auto r = (top + k - 1) % k;
+        while (_sorted.size() < k) {
+            if (l != bottom && (r == bottom || _rank[_face[l]] < _rank[_face[r]])) {
+                _sorted.push_back(_face[l]);
+                _isLeft.push_back(1);
+                l = (l + 1) % k;
+            }
+            else if (r != bottom) {
+                _sorted.push_back(_face[r]);
+                _isLeft.push_back(0);
+                r = (r + k - 1) % k;
+            }
+            else {
+                _sorted.push_back(_face[bottom]);
+                _isLeft.push_back(0);
+            }
+        }
+
+        // _stack 中保存 _sorted 的下标
+        _stack.clear();
+        _stack.push_back(0);
+        _stack.push_back(1);
+
+        for (u32 j = 2; j + 1 < k; ++j) {
+            const auto uj = _sorted[j];
+
+            if (_isLeft[j] != _isLeft[_stack.back()]) {
+                for (size s = 0; s + 1 < _stack.size(); ++s)
+                    emit(indices, uj, _sorted[_stack[s]], _sorted[_stack[s + 1]]);
+
+                _stack.clear();
+                _stack.push_back(j - 1);
+                _stack.push_back(j);
+            }
+            else {
+                auto last = _stack.back();
+                _stack.pop_back();
+
+                while (!_stack.empty()) {
+                    const auto o     = orient(_sorted[_stack.back()], _sorted[last], uj);
+                    const auto valid = _isLeft[j] ? o > 0 : o < 0;
+                    if (!valid)
+                        break;
+
+                    emit(indices, _sorted[_stack.back()], _sorted[last], uj);
+                    last = _stack.back();
+                    _stack.pop_back();
+                }
+
+                _stack.push_back(last);
+                _stack.push_back(j);
+            }
+        }
+
+        const auto un = _sorted[k - 1];
+        for (size s = 0; s + 1 < _stack.size(); ++s)
+            emit(indices, un, _sorted[_stack[s]], _sorted[_stack[s + 1]]);
+    }
+
+    // -------------------------
+    // 耳切法：先通过桥接边把孔洞并入外边界，再逐个切除凸顶点
+    // -------------------------
+
+    /// 点 p 是否位于逆时针三角形 abc 内 (包括边界)
+    bool insideTriangle(u32 a, u32 b, u32 c, u32 p) const
+    {
+        return orient(a, b, p) >= 0 && orient(b, c, p) >= 0 && orient(c, a, p) >= 0;
+    }
+
+    /// 复制顶点 v，用于构造桥接边
+    u32 cloneVertex(u32 v)
+    {
+        const auto id = cast_to<u32>(_pos.size());
+        _pos.push_back(_pos[v]);
+        _index.push_back(_index[v]);
+        _prev.push_back(kInvalid);
+        _next.push_back(kInvalid);
+        return id;
+    }
+
+    /// Eberly 的孔洞桥接：从孔洞最右侧的顶点 m 向 +x 发射射线，寻找外边界上可见的顶点
+    u32 findBridge(u32 outer, u32 m) const
+    {
+        const auto& pm = _pos[m];
+
+        auto hitEdge = kInvalid;
+        f64 hitX     = kInfinity;
+
+        auto v = outer;
+        do {
+            const auto& a = _pos[v];
+            const auto& b = _pos[_next[v]];
+
+            // 逆时针外边界上，从内部向 +x 方向只能击中向上的边
+            if (a.y <= pm.y && pm.y <= b.y && a.y < b.y) {
+                const auto x = f64(a.x) + (f64(pm.y) - a.y) * (f64(b.x) - a.x) / (f64(b.y) - a.y);
+                if (x >= pm.x && x < hitX) {
+                    hitX    = x;
+                    hitEdge = v;
+                }
+            }
+            v = _next[v];
+        } while (v != outer);
+
+        if (hitEdge == kInvalid)
+            return kInvalid;
+
+        const auto a = hitEdge;
+        const auto b = _next[hitEdge];
+        if (f64(_pos[a].x) == hitX && _pos[a].y == pm.y)
+            return a;
+        if (f64(_pos[b].x) == hitX && _pos[b].y == pm.y)
+            return b;
+
+        auto candidate = _pos[a].x > _pos[b].x ? a : b;
+
+        // 三角形 (m, 交点, candidate) 内的顶点会遮挡 candidate，改为选择其中与射线夹角最小的顶点
+        const float2 hit(f32(hitX), pm.y);
+        const auto& pc = _pos[candidate];
+
+        f64 bestTan  = kInfinity;
+        f64 bestDist = kInfinity;
+
+        v = outer;
+        do {
+            const auto& p = _pos[v];
+            if (v != candidate && p.x >= pm.x && !all_eq(p, pm) && CheckInside(p, pm, hit, pc)) {
+                const auto dx  = f64(p.x) - pm.x;
+                const auto tan = dx > 0 ? Abs(f64(p.y) - pm.y) / dx : f64(kInfinity);
+                const auto d2  = Sqr(dx) + Sqr(f64(p.y) - pm.y);
+                if (tan < bestTan || (tan == bestTan && d2 < bestDist)) {
+                    bestTan   = tan;
+                    bestDist  = d2;
+                    candidate = v;
+                }
+            }
+            v = _next[v];
+        } while (v != outer);
+
+        return candidate;
+    }
+
+    bool earClip(std::vector<u32>& indices)
+    {
+        const auto outer = _ringFirst[0];
+
+        // 按孔洞最右侧顶点的 x 从大到小依次桥接
+        std::vector<u32>& holes = _sorted;
+        holes.clear();
+        for (size r = 1; r < _ringFirst.size(); ++r) {
+            const auto first = _ringFirst[r];
+            auto right       = first;
+            for (auto v = _next[first]; v != first; v = _next[v]) {
+                if (_pos[v].x > _pos[right].x)
+                    right = v;
+            }
+            holes.push_back(right);
+        }
+        std::sort(holes.begin(), holes.end(), [&](u32 a, u32 b) { return _pos[a].x > _pos[b].x; });
+
+        for (const auto m : holes) {
+            // 孔洞位于外边界之外或与之相交时找不到可见的桥接顶点
+            const auto p = findBridge(outer, m);
+            if (p == kInvalid)
+                return false;
+
+            // p -> m -> ... (孔洞) ... -> m' -> p' -> next(p)
+            const auto m2    = cloneVertex(m);
+            const auto p2    = cloneVertex(p);
+            const auto pNext = _next[p];
+            const auto mPrev = _prev[m];
+
+            _next[p]     = m;
+            _prev[m]     = p;
+            _next[mPrev] = m2;
+            _prev[m2]    = mPrev;
+            _next[m2]    = p2;
+            _prev[p2]    = m2;
+            _next[p2]    = pNext;
+            _prev[pNext] = p2;
+        }
+
+        u32 count = 1;
+        for (auto v = _next[outer]; v != outer; v = _next[v])
+            ++count;
+
+        auto ear  = outer;
+        auto stop = ear;
+        while (count > 3) {
+            const auto a = _prev[ear];
+            const auto b = _next[ear];
+
+            auto isEar = orient(a, ear, b) > 0;
+            for (auto v = _next[b]; isEar && v != a; v = _next[v]) {
+                if (!all_eq(_pos[v], _pos[a]) && !all_eq(_pos[v], _pos[ear]) && !all_eq(_pos[v], _pos[b]) &&
+                    insideTriangle(a, ear, b, v))
+                    isEar = false;
+            }
+
+            if (isEar) {
+                emit(indices, a, ear, b);
+                _next[a] = b;
+                _prev[b] = a;
+                --count;
+
+                ear  = b;
+                stop = b;
+                continue;
+            }
+
+            // 转完一整圈都没有找到耳朵 (输入自相交等)，强行切除会产生翻转或重叠的三角形
+            if (_next[ear] == stop)
+                return false;
+
+            ear = _next[ear];
+        }
+
+        emit(indices, _prev[ear], ear, _next[ear]);
+        return true;
+    }
 };
 
 } // namespace nova
@@ -0,0 +1,324 @@
+/**
+ * @File Warp.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+#include "./Frame.hpp"
+#include "./SoA.hpp"
+#include "../Constants.hpp"
+
+namespace nova {
+
+// -------------------------
+// 把 [0, 1)^2 上的均匀样本变换到各种常用的分布上，方向都在局部坐标系 (z 轴朝上) 中给出，
+// 需要世界坐标时用 Frame::fromLocal 转换。所有函数都不含分支与 libm 调用 (三角函数用多项式近似)，
+// 批量版本以 SoA 为输入输出，按块计算。
+// -------------------------
+
+namespace internal {
+
+/**
+ * @brief sin(2πt) 与 cos(2πt)，t 以周为单位且不小于 -0.5。
+ *
+ * 先把 t 归约到 [-0.5, 0.5]，再利用 sin(π - x) = sin(x)、cos(π - x) = -cos(x) 归约到 [-π/2, π/2]，
+ * 最后用 Taylor 多项式求值，绝对误差在 1e-7 左右。
+ */
+NOVA_FUNC void SinCos2Pi(f32 t, f32& s, f32& c)
+{
+    t -= f32(i32(t + 0.5f));
+
+    const auto half = t >= 0 ? 0.5f : -0.5f;
+    const bool flip = Abs(t) > 0.25f;
+    const auto x    = kTwoPi * (flip ? half - t : t);
+    const auto x2   = x * x;
+
+    s = x * (1.f + x2 * (-1.f / 6 + x2 * (1.f / 120 + x2 * (-1.f / 5040 + x2 * (1.f / 362880 + x2 * (-1.f / 39916800))))));
+    c = 1.f + x2 * (-0.5f + x2 * (1.f / 24 + x2 * (-1.f / 720 + x2 * (1.f / 40320 + x2 * (-1.f / 3628800 + x2 * (1.f / 479001600))))));
+    c = flip ? -c : c;
+}
+
+} // namespace internal
+
+// -------------------------
+// 单个样本
+// -------------------------
+
+/**
+ * @brief 同心映射 (Shirley & Chiu) 到单位圆盘，保持样本的分层且面积畸变小。概率密度为 1 / π。
+ */
+NOVA_FUNC float2 SampleUniformDiskConcentric(const float2& u)
+{
+    const auto x = 2.f * u.x - 1.f, y = 2.f * u.y - 1.f;
+
+    // 两个分支的角度都以周为单位：|x| > |y| 时为 (y / x) / 8，否则为 1/4 - (x / y) / 8
+    const bool useX = Abs(x) > Abs(y);
+    const auto r    = useX ? x : y;
+    const auto num  = useX ? y : x;
+    const auto den  = r == 0 ? 1.f : r;
+    const auto q    = num / den * 0.125f;
+
+    f32 s, c;
+    internal::SinCos2Pi(useX ? q : 0.25f - q, s, c);
+    return {r * c, r * s};
+}
+
+NOVA_FUNC constexpr f32 UniformDiskPdf() { return kInvPi; }
+
+/**
+ * @brief 余弦加权的半球方向 (Malley 方法：圆盘上的均匀样本投影到半球)，概率密度为 cosθ / π。
+ */
+NOVA_FUNC float3 SampleCosineHemisphere(const float2& u)
+{
+    const auto d = SampleUniformDiskConcentric(u);
+    return {d.x, d.y, Sqrt(Max(0.f, 1.f - d.x * d.x - d.y * d.y))};
+}
+
+NOVA_FUNC f32 CosineHemispherePdf(f32 cosTheta) { return Max(cosTheta, 0.f) * kInvPi; }
+
+/// 单位球面上的均匀方向，概率密度为 1 / 4π
+NOVA_FUNC float3 SampleUniformSphere(const float2& u)
+{
+    const auto z = 1.f - 2.f * u.x;
+    const auto r = Sqrt(Max(0.f, 1.f - z * z));
+
+    f32 s, c;
+    internal::SinCos2Pi(u.y, s, c);
+    return {r * c, r * s, z};
+}
+
+NOVA_FUNC constexpr f32 UniformSpherePdf() { return kInv4Pi; }
+
+/// 以 z 轴为中心、半角余弦为 cosThetaMax 的圆锥内的均匀方向
+NOVA_FUNC float3 SampleUniformCone(const float2& u, f32 cosThetaMax)
+{
+    const auto cosTheta = (1.f - u.x) + u.x * cosThetaMax;
+    const auto sinTheta = Sqrt(Max(0.f, 1.f - cosTheta * cosTheta));
+
+    f32 s, c;
+    internal::SinCos2Pi(u.y, s, c);
+    return {sinTheta * c, sinTheta * s, cosTheta};
+}
+
+NOVA_FUNC f32 UniformConePdf(f32 cosThetaMax) { return 1.f / (kTwoPi * (1.f - cosThetaMax)); }
+
+/**
+ * @brief 三角形上均匀分布的重心坐标 (b0, b1, b2)，不需要开方 (Heitz, A Low-Distortion Map Between Triangle and Square)。
+ *
+ * 对应的点为 a * b0 + b * b1 + c * b2，面积上的概率密度为 1 / 三角形面积。
+ */
+NOVA_FUNC float3 SampleUniformTriangle(const float2& u)
+{
+    const bool lower = u.x < u.y;
+    const auto b0    = lower ? u.x * 0.5f : u.x - u.y * 0.5f;
+    const auto b1    = lower ? u.y - u.x * 0.5f : u.y * 0.5f;
+    return {b0, b1, 1.f - b0 - b1};
+}
+
+NOVA_FUNC f32 UniformTrianglePdf(f32 area) { return 1.f / area; }
+
+// -------------------------
+// GGX (Trowbridge-Reitz) 微表面分布，alpha 为 x、y 方向的粗糙度
+// -------------------------
+
+/// 法线分布函数 D(wm)
+NOVA_FUNC f32 GGXD(const float3& wm, const float2& alpha)
+{
+    const auto x = wm.x / alpha.x, y = wm.y / alpha.y;
+    const auto t = x * x + y * y + wm.z * wm.z;
+    return wm.z > 0 ? 1.f / (kPi * alpha.x * alpha.y * t * t) : 0.f;
+}
+
+/// Smith 遮蔽函数的辅助函数 Λ(w)
+NOVA_FUNC f32 GGXLambda(const float3& w, const float2& alpha)
+{
+    const auto ax = alpha.x * w.x, ay = alpha.y * w.y;
+    const auto z2 = Max(w.z * w.z, kFloatMin);
+    return 0.5f * (Sqrt(1.f + (ax * ax + ay * ay) / z2) - 1.f);
+}
+
+NOVA_FUNC f32 GGXG1(const float3& w, const float2& alpha) { return 1.f / (1.f + GGXLambda(w, alpha)); }
+
+/**
+ * @brief 从 wo 方向可见的法线分布中抽取微表面法线 (Heitz, Sampling the GGX Distribution of Visible Normals)。
+ *
+ * wo 需要位于上半球。对应的概率密度为 GGXVisibleNormalPdf。
+ */
+NOVA_FUNC float3 SampleGGXVisibleNormal(const float3& wo, const float2& alpha, const float2& u)
+{
+    // 拉伸到 alpha = 1 的半球上
+    const auto vh = Normalize(float3(alpha.x * wo.x, alpha.y * wo.y, wo.z));
+
+    const auto lenSqr  = vh.x * vh.x + vh.y * vh.y;
+    const auto invLen  = lenSqr > 0 ? 1.f / Sqrt(lenSqr) : 0.f;
+    const auto t1Basis = lenSqr > 0 ? float3(-vh.y * invLen, vh.x * invLen, 0.f) : float3(1.f, 0.f, 0.f);
+    const auto t2Basis = Cross(vh, t1Basis);
+
+    // 在投影后的圆盘上均匀抽样，按 vh 的倾斜程度压缩下半部分
+    const auto r = Sqrt(u.x);
+    f32 s, c;
+    internal::SinCos2Pi(u.y, s, c);
+
+    const auto t1 = r * c;
+    const auto h  = Sqrt(Max(0.f, 1.f - t1 * t1));
+    const auto k  = 0.5f * (1.f + vh.z);
+    const auto t2 = (1.f - k) * h + k * r * s;
+
+    const auto nh = t1 * t1Basis + t2 * t2Basis + Sqrt(Max(0.f, 1.f - t1 * t1 - t2 * t2)) * vh;
+
+    // 变换回原来的粗糙度
+    return Normalize(float3(alpha.x * nh.x, alpha.y * nh.y, Max(1e-6f, nh.z)));
+}
+
+/// 可见法线分布 D_wo(wm) = G1(wo) max(0, wo·wm) D(wm) / cosθo
+NOVA_FUNC f32 GGXVisibleNormalPdf(const float3& wo, const float3& wm, const float2& alpha)
+{
+    const auto cosO = Max(wo.z, kFloatMin);
+    return GGXG1(wo, alpha) * Max(0.f, Dot(wo, wm)) * GGXD(wm, alpha) / cosO;
+}
+
+// -------------------------
+// 批量版本：u0、u1 为各样本的两个随机数，结果经 frame 变换后写入 out，概率密度写入 pdf (可以为空)
+// -------------------------
+
+namespace internal {
+
+inline constexpr size kWarpBlock = 64;
+
+/**
+ * @brief 按 kWarpBlock 个样本一组计算，结果先写入栈上的小数组再复制到输出。
+ *
+ * 计算时写入的栈上数组不会与输入重叠，输出按分量整段复制，不需要在每个样本上分别写入三到四个输出流。
+ * compute(first, n, x, y, z, pdf) 计算 [first, first + n) 的样本。
+ */
+template<typename Compute> NOVA_FUNC void WarpBlocks(size count, Float3SoA<f32> out, std::span<f32> pdf, Compute&& compute)
+{
+    NOVA_CHECK(out.count() >= count && (pdf.empty() || pdf.size() >= count));
+
+    std::array<f32, kWarpBlock> x, y, z, p;
+    for (size first = 0; first < count; first += kWarpBlock) {
+        const auto n = Min(kWarpBlock, count - first);
+        compute(first, n, x, y, z, p);
+
+        std::copy_n(x.data(), n, out.x.data() + first);
+        std::copy_n(y.data(), n, out.y.data() + first);
+        std::copy_n(z.data(), n, out.z.data() + first);
+        if (!pdf.empty())
+            std::copy_n(p.data(), n, pdf.data() + first);
+    }
+}
+
+/// warp(u, pdf) 返回局部坐标系中的方向，经 frame 变换后输出
+template<typename Warp>
+NOVA_FUNC void WarpBatch(std::span<const f32> u0, std::span<const f32> u1, const Frame<f32>& frame, Float3SoA<f32> out, std::span<f32> pdf, Warp&& warp)
+{
+    NOVA_CHECK(u0.size() == u1.size());
+
+    const auto f = frame;
+    WarpBlocks(u0.size(), out, pdf, [&](size first, size n, auto& x, auto& y, auto& z, auto& p) {
+        const auto* pu0 = u0.data() + first;
+        const auto* pu1 = u1.data() + first;
+        for (size k = 0; k < n; ++k) {
+            const auto w = f.fromLocal(warp(float2(pu0[k], pu1[k]), p[k]));
+            x[k]         = w.x;
+            y[k]         = w.y;
+            z[k]         = w.z;
+        }
+    });
+}
+
+} // namespace internal
+
+NOVA_FUNC void SampleCosineHemisphere(std::span<const f32> u0, std::span<const f32> u1, const Frame<f32>& frame, Float3SoA<f32> out, std::span<f32> pdf = {})
+{
+    internal::WarpBatch(u0, u1, frame, out, pdf, [](const float2& u, f32& p) {
+        const auto w = SampleCosineHemisphere(u);
+        p            = CosineHemispherePdf(w.z);
+        return w;
+    });
+}
+
+NOVA_FUNC void SampleUniformSphere(std::span<const f32> u0, std::span<const f32> u1, const Frame<f32>& frame, Float3SoA<f32> out, std::span<f32> pdf = {})
+{
+    internal::WarpBatch(u0, u1, frame, out, pdf, [](const float2& u, f32& p) {
+        p = UniformSpherePdf();
+        return SampleUniformSphere(u);
+    });
+}
+
+NOVA_FUNC void SampleUniformCone(std::span<const f32> u0, std::span<const f32> u1, f32 cosThetaMax, const Frame<f32>& frame, Float3SoA<f32> out, std::span<f32> pdf = {})
+{
+    const auto conePdf = UniformConePdf(cosThetaMax);
+    internal::WarpBatch(u0, u1, frame, out, pdf, [&](const float2& u, f32& p) {
+        p = conePdf;
+        return SampleUniformCone(u, cosThetaMax);
+    });
+}
+
+/// 圆盘上的点写入 x、y，不需要旋转
+NOVA_FUNC void SampleUniformDiskConcentric(std::span<const f32> u0, std::span<const f32> u1, std::span<f32> x, std::span<f32> y)
+{
+    NOVA_CHECK(u0.size() == u1.size() && x.size() >= u0.size() && y.size() >= u0.size());
+
+    const auto* pu0 = u0.data();
+    const auto* pu1 = u1.data();
+    auto* ox        = x.data();
+    auto* oy        = y.data();
+
+    for (size i = 0; i < u0.size(); ++i) {
+        const auto d = SampleUniformDiskConcentric(float2(pu0[i], pu1[i]));
+        ox[i]        = d.x;
+        oy[i]        = d.y;
+    }
+}
+
+/// 重心坐标写入 out 的三个分量
+NOVA_FUNC void SampleUniformTriangle(std::span<const f32> u0, std::span<const f32> u1, Float3SoA<f32> out)
+{
+    NOVA_CHECK(u0.size() == u1.size() && out.count() >= u0.size());
+
+    const auto* pu0 = u0.data();
+    const auto* pu1 = u1.data();
+    auto* ox        = out.x.data();
+    auto* oy        = out.y.data();
+    auto* oz        = out.z.data();
+
+    for (size i = 0; i < u0.size(); ++i) {
+        const auto b = SampleUniformTriangle(float2(pu0[i], pu1[i]));
+        ox[i]        = b.x;
+        oy[i]        = b.y;
+        oz[i]        = b.z;
+    }
+}
+
+/// 每个样本有自己的出射方向 wo (局部坐标)，得到的法线同样在局部坐标系中
+NOVA_FUNC void SampleGGXVisibleNormal(Float3SoA<const f32> wo, const float2& alpha, std::span<const f32> u0, std::span<const f32> u1, Float3SoA<f32> out, std::span<f32> pdf = {})
+{
+    NOVA_CHECK(wo.count() == u0.size() && u0.size() == u1.size());
+
+    const auto a = alpha;
+    internal::WarpBlocks(u0.size(), out, pdf, [&](size first, size n, auto& x, auto& y, auto& z, auto& p) {
+        const auto* wx  = wo.x.data() + first;
+        const auto* wy  = wo.y.data() + first;
+        const auto* wz  = wo.z.data() + first;
+        const auto* pu0 = u0.data() + first;
+        const auto* pu1 = u1.data() + first;
+        for (size k = 0; k < n; ++k) {
+            const float3 w(wx[k], wy[k], wz[k]);
+            const auto wm = SampleGGXVisibleNormal(w, a, float2(pu0[k], pu1[k]));
+            x[k]          = wm.x;
+            y[k]          = wm.y;
+            z[k]          = wm.z;
+            p[k]          = GGXVisibleNormalPdf(w, wm, a);
+        }
+    });
+}
+
+} // namespace nova
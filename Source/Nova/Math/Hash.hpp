@@ -8,6 +8,7 @@
 #pragma once
 
 #include "./Common.hpp"
+#include "../Base/StringHash.hpp"
 
 namespace nova {
 
@@ -76,97 +77,16 @@ NOVA_FUNC u64 MixBits(u64 v)
 // -------------------------
 // wyhash
 // https://github.com/wangyi-fudan/wyhash
+// 字节处理、默认密钥与 HashString 位于 Base/StringHash.hpp
 // -------------------------
-namespace internal {
-
-NOVA_FUNC constexpr u64 wyRot(u64 x)
-{
-    return (x >> 32) | (x << 32);
-}
-
-NOVA_FUNC constexpr void wyMum(u64* A, u64* B)
-{
-    u64 ha = *A >> 32, hb = *B >> 32, la = (uint32_t)*A, lb = (uint32_t)*B, hi, lo;
-    u64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
-    lo  = t + (rm1 << 32);
-    c  += lo < t;
-    hi  = rh + (rm0 >> 32) + (rm1 >> 32) + c;
-    *A ^= lo;
-    *B ^= hi;
-}
-
-NOVA_FUNC constexpr u64 wyMix(u64 A, u64 B)
-{
-    wyMum(&A, &B);
-    return A ^ B;
-}
-
-NOVA_FUNC constexpr u64 wyR8(const u8* p)
-{
-    u64 v;
-    Memcpy(&v, p, 8);
-    return (((v >> 56) & 0xff) | ((v >> 40) & 0xff00) | ((v >> 24) & 0xff0000) | ((v >> 8) & 0xff000000) |
-            ((v << 8) & 0xff00000000) | ((v << 24) & 0xff0000000000) | ((v << 40) & 0xff000000000000) |
-            ((v << 56) & 0xff00000000000000));
-}
-
-NOVA_FUNC constexpr u64 wyR4(const u8* p)
-{
-    uint32_t v;
-    Memcpy(&v, p, 4);
-    return (((v >> 24) & 0xff) | ((v >> 8) & 0xff00) | ((v << 8) & 0xff0000) | ((v << 24) & 0xff000000));
-}
-
-NOVA_FUNC constexpr u64 wyR3(const u8* p, size_t k)
+NOVA_FUNC constexpr u64 wyHash(const void* key, size_t len, u64 seed, const u64* secret)
 {
-    return (((u64)p[0]) << 16) | (((u64)p[k >> 1]) << 8) | p[k - 1];
+    return internal::wyHashBytes(static_cast<const u8*>(key), len, seed, secret);
 }
 
-} // namespace internal
-
-NOVA_FUNC constexpr u64 wyHash(const void* key, size_t len, u64 seed, const u64* secret)
+NOVA_FUNC constexpr u64 wyHash(const void* key, size_t len, u64 seed = 0)
 {
-    const u8* p  = (const u8*)key;
-    seed        ^= internal::wyMix(seed ^ secret[0], secret[1]);
-    u64 a, b;
-    if (len <= 16) {
-        if (len >= 4) {
-            a = (internal::wyR4(p) << 32) | internal::wyR4(p + ((len >> 3) << 2));
-            b = (internal::wyR4(p + len - 4) << 32) | internal::wyR4(p + len - 4 - ((len >> 3) << 2));
-        }
-        else if (len > 0) {
-            a = internal::wyR3(p, len);
-            b = 0;
-        }
-        else
-            a = b = 0;
-    }
-    else {
-        size_t i = len;
-        if (i > 48) {
-            u64 see1 = seed, see2 = seed;
-            do {
-                seed  = internal::wyMix(internal::wyR8(p) ^ secret[1], internal::wyR8(p + 8) ^ seed);
-                see1  = internal::wyMix(internal::wyR8(p + 16) ^ secret[2], internal::wyR8(p + 24) ^ see1);
-                see2  = internal::wyMix(internal::wyR8(p + 32) ^ secret[3], internal::wyR8(p + 40) ^ see2);
-                p    += 48;
-                i    -= 48;
-            } while (i > 48);
-            seed ^= see1 ^ see2;
-        }
-        while (i > 16) {
-            seed  = internal::wyMix(internal::wyR8(p) ^ secret[1], internal::wyR8(p + 8) ^ seed);
-            i    -= 16;
-            p    += 16;
-        }
-
-        a = internal::wyR8(p + i - 16);
-        b = internal::wyR8(p + i - 8);
-    }
-    a ^= secret[1];
-    b ^= seed;
-    internal::wyMum(&a, &b);
-    return internal::wyMix(a ^ secret[0] ^ len, b ^ secret[1]);
+    return wyHash(key, len, seed, kWySecret);
 }
 
 NOVA_FUNC constexpr uint64_t wyHash64(uint64_t A, uint64_t B)
@@ -0,0 +1,160 @@
+/**
+ * @File Interval.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include "./Float.hpp"
+
+namespace nova {
+
+namespace internal {
+
+/// NextFloatDown 对 0 返回 NaN，区间下界需要的是 0 以下最近的浮点数
+NOVA_FUNC Float RoundDownBound(Float v)
+{
+    return v == 0 ? -std::numeric_limits<Float>::denorm_min() : NextFloatDown(v);
+}
+
+} // namespace internal
+
+/**
+ * @brief 浮点区间，真实值保证落在 [lowerBound(), upperBound()] 内。
+ *
+ * 每次运算都用 Float.hpp 中的向上 / 向下舍入函数把结果向外扩展一个 ulp，因此区间总能包住精确结果。
+ * 用于几何谓词的浮点过滤：区间不含 0 时符号确定，否则才需要更高的精度。
+ */
+class Interval
+{
+public:
+    NOVA_FUNC Interval() = default;
+
+    NOVA_FUNC explicit Interval(Float v) : _low(v), _high(v) { }
+
+    NOVA_FUNC Interval(Float lo, Float hi) : _low(Min(lo, hi)), _high(Max(lo, hi)) { }
+
+    NOVA_FUNC static Interval FromValueAndError(Float v, Float err)
+    {
+        return err == 0 ? Interval(v) : Interval(internal::RoundDownBound(v - err), AddRoundUp(v, err));
+    }
+
+    NOVA_FUNC Float lowerBound() const { return _low; }
+
+    NOVA_FUNC Float upperBound() const { return _high; }
+
+    NOVA_FUNC Float midpoint() const { return (_low + _high) / 2; }
+
+    NOVA_FUNC Float width() const { return _high - _low; }
+
+    NOVA_FUNC explicit operator Float() const { return midpoint(); }
+
+    NOVA_FUNC bool exactly(Float v) const { return _low == v && _high == v; }
+
+    NOVA_FUNC bool inRange(Float v) const { return v >= _low && v <= _high; }
+
+    /// 区间的符号：整个区间在 0 之上为 1，之下为 -1，包含 0 时为 0
+    NOVA_FUNC i32 sign() const { return _low > 0 ? 1 : (_high < 0 ? -1 : 0); }
+
+    NOVA_FUNC Interval operator-() const { return {-_high, -_low}; }
+
+    NOVA_FUNC Interval operator+(const Interval& i) const
+    {
+        return {internal::RoundDownBound(_low + i._low), AddRoundUp(_high, i._high)};
+    }
+
+    NOVA_FUNC Interval operator-(const Interval& i) const
+    {
+        return {internal::RoundDownBound(_low - i._high), SubRoundUp(_high, i._low)};
+    }
+
+    NOVA_FUNC Interval operator*(const Interval& i) const
+    {
+        const Float lp[4] = {_low * i._low, _high * i._low, _low * i._high, _high * i._high};
+        const Float hp[4] = {MulRoundUp(_low, i._low), MulRoundUp(_high, i._low), MulRoundUp(_low, i._high), MulRoundUp(_high, i._high)};
+        return {internal::RoundDownBound(Min(lp[0], lp[1], lp[2], lp[3])), Max(hp[0], hp[1], hp[2], hp[3])};
+    }
+
+    /// 除数区间包含 0 时结果为整个实数轴
+    NOVA_FUNC Interval operator/(const Interval& i) const
+    {
+        if (i.inRange(0))
+            return {-std::numeric_limits<Float>::infinity(), std::numeric_limits<Float>::infinity()};
+
+        const Float lq[4] = {_low / i._low, _high / i._low, _low / i._high, _high / i._high};
+        const Float hq[4] = {DivRoundUp(_low, i._low), DivRoundUp(_high, i._low), DivRoundUp(_low, i._high), DivRoundUp(_high, i._high)};
+        return {internal::RoundDownBound(Min(lq[0], lq[1], lq[2], lq[3])), Max(hq[0], hq[1], hq[2], hq[3])};
+    }
+
+    NOVA_FUNC Interval operator+(Float f) const { return *this + Interval(f); }
+
+    NOVA_FUNC Interval operator-(Float f) const { return *this - Interval(f); }
+
+    NOVA_FUNC Interval operator*(Float f) const { return *this * Interval(f); }
+
+    NOVA_FUNC Interval operator/(Float f) const { return *this / Interval(f); }
+
+    NOVA_FUNC Interval& operator+=(const Interval& i) { return *this = *this + i; }
+
+    NOVA_FUNC Interval& operator-=(const Interval& i) { return *this = *this - i; }
+
+    NOVA_FUNC Interval& operator*=(const Interval& i) { return *this = *this * i; }
+
+    NOVA_FUNC Interval& operator/=(const Interval& i) { return *this = *this / i; }
+
+    NOVA_FUNC bool operator==(Float f) const { return exactly(f); }
+
+private:
+    Float _low  = 0;
+    Float _high = 0;
+};
+
+NOVA_FUNC Interval operator+(Float f, const Interval& i) { return Interval(f) + i; }
+
+NOVA_FUNC Interval operator-(Float f, const Interval& i) { return Interval(f) - i; }
+
+NOVA_FUNC Interval operator*(Float f, const Interval& i) { return Interval(f) * i; }
+
+NOVA_FUNC Interval operator/(Float f, const Interval& i) { return Interval(f) / i; }
+
+NOVA_FUNC Interval Abs(const Interval& i)
+{
+    if (i.lowerBound() >= 0)
+        return i;
+    if (i.upperBound() <= 0)
+        return -i;
+    return {0, Max(-i.lowerBound(), i.upperBound())};
+}
+
+/// 平方比 i * i 更紧：结果不会小于 0
+NOVA_FUNC Interval Sqr(const Interval& i)
+{
+    const auto lo = Abs(i.lowerBound()), hi = Abs(i.upperBound());
+    if (i.inRange(0))
+        return {0, MulRoundUp(Max(lo, hi), Max(lo, hi))};
+
+    const auto mn = Min(lo, hi), mx = Max(lo, hi);
+    return {internal::RoundDownBound(mn * mn), MulRoundUp(mx, mx)};
+}
+
+NOVA_FUNC Interval Sqrt(const Interval& i)
+{
+    return {SqrtRoundDown(Max<Float>(0, i.lowerBound())), SqrtRoundUp(Max<Float>(0, i.upperBound()))};
+}
+
+/// a * b + c，每个端点只产生一次舍入
+NOVA_FUNC Interval Fma(const Interval& a, const Interval& b, const Interval& c)
+{
+    Float lo = std::numeric_limits<Float>::infinity(), hi = -lo;
+    for (const auto x : {a.lowerBound(), a.upperBound()}) {
+        for (const auto y : {b.lowerBound(), b.upperBound()}) {
+            lo = Min(lo, Fma(x, y, c.lowerBound()));
+            hi = Max(hi, FmaRoundUp(x, y, c.upperBound()));
+        }
+    }
+    return {internal::RoundDownBound(lo), hi};
+}
+
+} // namespace nova
@@ -0,0 +1,462 @@
+/**
+ * @File LowDiscrepancy.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <span>
+#include <vector>
+
+#include "./Constants.hpp"
+#include "./Random.hpp"
+
+#ifdef NOVA_HAS_AVX2
+#  include <immintrin.h>
+#endif
+
+namespace nova {
+
+/// Sobol 序列支持的维数
+static constexpr u32 kSobolDimensions = 64;
+
+/// Halton 序列支持的维数，第 i 维以第 i 个素数为底
+static constexpr u32 kHaltonDimensions = 64;
+
+namespace internal {
+
+// -------------------------
+// Joe & Kuo, Constructing Sobol sequences with better two-dimensional projections (new-joe-kuo-6.21201)
+//
+// 每一维由一个本原多项式与初始方向数 m_1 .. m_s 决定，poly 含最高项与常数项，s 为多项式的次数。
+// 第 0 维是 van der Corput 序列，不在表中。
+// -------------------------
+
+struct SobolPolynomial
+{
+    u32 poly;
+    std::array<u32, 9> m;
+};
+
+static constexpr std::array<SobolPolynomial, kSobolDimensions - 1> kSobolPolynomials = {{
+    {3, {1}},
+    {7, {1, 3}},
+    {11, {1, 3, 1}},
+    {13, {1, 1, 1}},
+    {19, {1, 1, 3, 3}},
+    {25, {1, 3, 5, 13}},
+    {37, {1, 1, 5, 5, 17}},
+    {41, {1, 1, 5, 5, 5}},
+    {47, {1, 1, 7, 11, 19}},
+    {55, {1, 1, 5, 1, 1}},
+    {59, {1, 1, 1, 3, 11}},
+    {61, {1, 3, 5, 5, 31}},
+    {67, {1, 3, 3, 9, 7, 49}},
+    {91, {1, 1, 1, 15, 21, 21}},
+    {97, {1, 3, 1, 13, 27, 49}},
+    {103, {1, 1, 1, 15, 7, 5}},
+    {109, {1, 3, 1, 15, 13, 25}},
+    {115, {1, 1, 5, 5, 19, 61}},
+    {131, {1, 3, 7, 11, 23, 15, 103}},
+    {137, {1, 3, 7, 13, 13, 15, 69}},
+    {143, {1, 1, 3, 13, 7, 35, 63}},
+    {145, {1, 3, 5, 9, 1, 25, 53}},
+    {157, {1, 3, 1, 13, 9, 35, 107}},
+    {167, {1, 3, 1, 5, 27, 61, 31}},
+    {171, {1, 1, 5, 11, 19, 41, 61}},
+    {185, {1, 3, 5, 3, 3, 13, 69}},
+    {191, {1, 1, 7, 13, 1, 19, 1}},
+    {193, {1, 3, 7, 5, 13, 19, 59}},
+    {203, {1, 1, 3, 9, 25, 29, 41}},
+    {211, {1, 3, 5, 13, 23, 1, 55}},
+    {213, {1, 3, 7, 3, 13, 59, 17}},
+    {229, {1, 3, 1, 3, 5, 53, 69}},
+    {239, {1, 1, 5, 5, 23, 33, 13}},
+    {241, {1, 1, 7, 7, 1, 61, 123}},
+    {247, {1, 1, 7, 9, 13, 61, 49}},
+    {253, {1, 3, 3, 5, 3, 55, 33}},
+    {285, {1, 3, 1, 15, 31, 13, 49, 245}},
+    {299, {1, 3, 5, 15, 31, 59, 63, 97}},
+    {301, {1, 3, 1, 11, 11, 11, 77, 249}},
+    {333, {1, 3, 1, 11, 27, 43, 71, 9}},
+    {351, {1, 1, 7, 15, 21, 11, 81, 45}},
+    {355, {1, 3, 7, 3, 25, 31, 65, 79}},
+    {357, {1, 3, 1, 1, 19, 11, 3, 205}},
+    {361, {1, 1, 5, 9, 19, 21, 29, 157}},
+    {369, {1, 3, 7, 11, 1, 33, 89, 185}},
+    {391, {1, 3, 3, 3, 15, 9, 79, 71}},
+    {397, {1, 3, 7, 11, 15, 39, 119, 27}},
+    {425, {1, 1, 3, 1, 11, 31, 97, 225}},
+    {451, {1, 1, 1, 3, 23, 43, 57, 177}},
+    {463, {1, 3, 7, 7, 17, 17, 37, 71}},
+    {487, {1, 3, 1, 5, 27, 63, 123, 213}},
+    {501, {1, 1, 3, 5, 11, 43, 53, 133}},
+    {529, {1, 3, 5, 5, 29, 17, 47, 173, 479}},
+    {539, {1, 3, 3, 11, 3, 1, 109, 9, 69}},
+    {545, {1, 1, 1, 5, 17, 39, 23, 5, 343}},
+    {557, {1, 3, 1, 5, 25, 15, 31, 103, 499}},
+    {563, {1, 1, 1, 11, 11, 17, 63, 105, 183}},
+    {601, {1, 1, 5, 11, 9, 29, 97, 231, 363}},
+    {607, {1, 1, 5, 15, 19, 45, 41, 7, 383}},
+    {617, {1, 3, 7, 7, 31, 19, 83, 137, 221}},
+    {623, {1, 1, 1, 3, 23, 15, 111, 223, 83}},
+    {631, {1, 1, 5, 13, 31, 15, 55, 25, 161}},
+    {637, {1, 1, 3, 13, 25, 47, 39, 87, 257}},
+}};
+
+/// 每一维的 32 个方向数 v_k (生成矩阵的第 k 列)，在编译期由递推 v_k = v_{k-s} ^ (v_{k-s} >> s) ^ Σ a_j v_{k-j} 得到
+NOVA_FUNC consteval std::array<std::array<u32, 32>, kSobolDimensions> MakeSobolMatrices()
+{
+    std::array<std::array<u32, 32>, kSobolDimensions> v{};
+    for (u32 k = 0; k < 32; ++k)
+        v[0][k] = 1u << (31 - k);
+
+    for (u32 d = 1; d < kSobolDimensions; ++d) {
+        const auto& p = kSobolPolynomials[d - 1];
+        const auto  s = u32(std::bit_width(p.poly) - 1);
+
+        for (u32 k = 0; k < 32; ++k) {
+            if (k < s) {
+                v[d][k] = p.m[k] << (31 - k);
+                continue;
+            }
+
+            auto x = v[d][k - s] ^ (v[d][k - s] >> s);
+            for (u32 j = 1; j < s; ++j) {
+                if ((p.poly >> (s - j)) & 1)
+                    x ^= v[d][k - j];
+            }
+            v[d][k] = x;
+        }
+    }
+    return v;
+}
+
+static constexpr auto kSobolMatrices = MakeSobolMatrices();
+
+static constexpr std::array<u32, kHaltonDimensions> kPrimes = {
+    2,   3,   5,   7,   11,  13,  17,  19,  23,  29,  31,  37,  41,  43,  47,  53,  59,  61,  67,  71,  73,  79,
+    83,  89,  97,  101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193,
+    197, 199, 211, 223, 227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311};
+
+/// [0, 2^32) 的整数映射到 [0, 1)，舍入后等于 1 的值取 1 以下最近的浮点数
+NOVA_FUNC f32 SobolToFloat(u32 v) { return Min(f32(v) * 0x1p-32f, kFloatOneMinusEpsilon); }
+
+/// 不同维度使用互不相关的扰乱种子
+NOVA_FUNC u32 SobolDimensionSeed(u32 seed, u32 dim) { return u32(MixBits((u64(dim) << 32) | seed)); }
+
+/// 块内偏移 0 .. kBlock-1 的 Sobol 值：利用 Sobol(i ^ j) = Sobol(i) ^ Sobol(j)，批量生成时每块只需要对块的起点做一次完整计算
+template<u32 kBlock> NOVA_FUNC std::array<u32, kBlock> SobolBlockTable(u32 dim)
+{
+    std::array<u32, kBlock> table{};
+    for (u32 j = 1; j < kBlock; ++j)
+        table[j] = table[j & (j - 1)] ^ kSobolMatrices[dim][std::countr_zero(j)];
+    return table;
+}
+
+} // namespace internal
+
+/**
+ * @brief 第 dim 维 Sobol 序列第 index 个点的整数表示 (32 位定点小数)。
+ *
+ * 生成矩阵为 32 x 32，index 只有低 32 位有效。
+ */
+NOVA_FUNC u32 SobolBits(u32 index, u32 dim)
+{
+    NOVA_ASSERT(dim < kSobolDimensions);
+
+    u32 v = 0;
+    for (u32 k = 0; index != 0; index >>= 1, ++k)
+        v ^= internal::kSobolMatrices[dim][k] & (0u - (index & 1u));
+    return v;
+}
+
+/// 第 dim 维 Sobol 序列的第 index 个点，位于 [0, 1)
+NOVA_FUNC f32 SobolSample(u32 index, u32 dim) { return internal::SobolToFloat(SobolBits(index, dim)); }
+
+/**
+ * @brief 基于哈希的快速 Owen 扰乱 (Burley, Practical Hash-based Owen Scrambling)。
+ *
+ * 在位反转后的值上做 Laine-Karras 风格的置换：每一位只受比它更高的位影响，等价于按层嵌套的随机置换，
+ * 因此保留了序列的分层性质，同时消除了 Sobol 维度之间的结构性相关。
+ */
+NOVA_FUNC u32 FastOwenScramble(u32 v, u32 seed)
+{
+    v = ReverseBits(v);
+    v ^= v * 0x3d20adeau;
+    v += seed;
+    v *= (seed >> 16) | 1u;
+    v ^= v * 0x05526c56u;
+    v ^= v * 0x53a22864u;
+    return ReverseBits(v);
+}
+
+/// Owen 扰乱后的 Sobol 点，seed 相同时各维仍使用不同的扰乱
+NOVA_FUNC f32 OwenScrambledSobolSample(u32 index, u32 dim, u32 seed)
+{
+    return internal::SobolToFloat(FastOwenScramble(SobolBits(index, dim), internal::SobolDimensionSeed(seed, dim)));
+}
+
+namespace internal {
+
+#ifdef NOVA_HAS_AVX2
+/// 8 个通道的 SobolToFloat：AVX2 只有有符号整数的转换，高低 16 位分别精确转换后相加，只舍入一次，与标量结果一致
+NOVA_FUNC __m256 SobolToFloat(__m256i v)
+{
+    const auto hi = _mm256_cvtepi32_ps(_mm256_srli_epi32(v, 16));
+    const auto lo = _mm256_cvtepi32_ps(_mm256_and_si256(v, _mm256_set1_epi32(0xFFFF)));
+    const auto x  = _mm256_add_ps(_mm256_mul_ps(hi, _mm256_set1_ps(0x1p16f)), lo);
+    return _mm256_min_ps(_mm256_mul_ps(x, _mm256_set1_ps(0x1p-32f)), _mm256_set1_ps(kFloatOneMinusEpsilon));
+}
+
+/// 每个 32 位通道内反转位顺序：先交换字节，再对每个字节的高低 4 位查表
+NOVA_FUNC __m256i ReverseBits(__m256i v)
+{
+    const auto bswap  = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                         3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const auto nibble = _mm256_setr_epi8(0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15,
+                                         0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15);
+    const auto mask   = _mm256_set1_epi8(0x0F);
+
+    v             = _mm256_shuffle_epi8(v, bswap);
+    const auto lo = _mm256_shuffle_epi8(nibble, _mm256_and_si256(v, mask));
+    const auto hi = _mm256_shuffle_epi8(nibble, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+    return _mm256_or_si256(_mm256_slli_epi16(lo, 4), hi);
+}
+
+/// 8 个通道的 FastOwenScramble
+NOVA_FUNC __m256i FastOwenScramble(__m256i v, u32 seed)
+{
+    const auto mulXor = [](__m256i x, u32 m) {
+        return _mm256_xor_si256(x, _mm256_mullo_epi32(x, _mm256_set1_epi32(i32(m))));
+    };
+
+    v = mulXor(ReverseBits(v), 0x3d20adeau);
+    v = _mm256_add_epi32(v, _mm256_set1_epi32(i32(seed)));
+    v = _mm256_mullo_epi32(v, _mm256_set1_epi32(i32((seed >> 16) | 1u)));
+    v = mulXor(v, 0x05526c56u);
+    v = mulXor(v, 0x53a22864u);
+    return ReverseBits(v);
+}
+#endif
+
+/**
+ * @brief 以 kBlock 对齐分块生成 Sobol 点，kScramble 为真时以 seed 做 Owen 扰乱。
+ *
+ * 块内只剩下一次异或、扰乱与转换。u32 到 f32 与扰乱中的位反转都不容易被自动向量化，
+ * 支持 AVX2 时块内每次显式计算 8 个点，其余部分逐个计算，两条路径的结果完全一致。
+ */
+template<bool kScramble> NOVA_FUNC void SobolFillImpl(u32 dim, u32 firstIndex, u32 seed, std::span<f32> out)
+{
+    constexpr u32 kBlock = 64;
+    const auto    table  = SobolBlockTable<kBlock>(dim);
+
+    for (size i = 0; i < out.size();) {
+        const auto index = u32(firstIndex + i);
+        const auto lo    = index & (kBlock - 1);
+        const auto n     = Min<size>(kBlock - lo, out.size() - i);
+        const auto base  = SobolBits(index - lo, dim);
+
+        size k = 0;
+#ifdef NOVA_HAS_AVX2
+        for (; k + 8 <= n; k += 8) {
+            auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table.data() + lo + k));
+            v      = _mm256_xor_si256(v, _mm256_set1_epi32(i32(base)));
+            if constexpr (kScramble)
+                v = FastOwenScramble(v, seed);
+            _mm256_storeu_ps(out.data() + i + k, SobolToFloat(v));
+        }
+#endif
+        for (; k < n; ++k) {
+            auto v = base ^ table[lo + k];
+            if constexpr (kScramble)
+                v = nova::FastOwenScramble(v, seed);
+            out[i + k] = SobolToFloat(v);
+        }
+        i += n;
+    }
+}
+
+} // namespace internal
+
+/// out[i] = SobolSample(firstIndex + i, dim)
+NOVA_FUNC void SobolFill(u32 dim, u32 firstIndex, std::span<f32> out)
+{
+    internal::SobolFillImpl<false>(dim, firstIndex, 0, out);
+}
+
+/// out[i] = OwenScrambledSobolSample(firstIndex + i, dim, seed)
+NOVA_FUNC void OwenScrambledSobolFill(u32 dim, u32 firstIndex, u32 seed, std::span<f32> out)
+{
+    internal::SobolFillImpl<true>(dim, firstIndex, internal::SobolDimensionSeed(seed, dim), out);
+}
+
+/**
+ * @brief 以第 baseIndex 个素数为底的根式逆 (radical inverse)：把 a 的各位数字镜像到小数点之后。
+ */
+NOVA_FUNC f32 RadicalInverse(u32 baseIndex, u64 a)
+{
+    NOVA_ASSERT(baseIndex < kHaltonDimensions);
+
+    const auto base    = u64(internal::kPrimes[baseIndex]);
+    const auto invBase = 1.f / f32(base);
+    const auto limit   = ~0ull / base - base;
+
+    u64 reversed = 0;
+    f32 invBaseM = 1;
+    while (a != 0 && reversed < limit) {
+        const auto next = a / base;
+        reversed        = reversed * base + (a - next * base);
+        invBaseM *= invBase;
+        a = next;
+    }
+    return Min(f32(reversed) * invBaseM, kFloatOneMinusEpsilon);
+}
+
+/**
+ * @brief Halton 序列，每一维可以带有预先计算好的随机数字置换 (random digit permutation)。
+ *
+ * 每一维在构造时确定参与计算的位数 n，使 base^-n 小于 f32 的精度，并为每一位准备一个 0 .. base-1 的置换。
+ * 置换作用于每一位数字 (包括 a 高位之外的 0)，保留了 Halton 序列的分层性质，又打破了高维下相邻两维之间的相关。
+ * 不带种子构造时所有置换都是恒等置换，结果即普通的 Halton 序列。
+ */
+class HaltonSequence
+{
+public:
+    explicit HaltonSequence(u32 dims) { init(dims, nullptr); }
+
+    HaltonSequence(u32 dims, u64 seed)
+    {
+        PCG32 rng(seed);
+        init(dims, &rng);
+    }
+
+    NOVA_FUNC u32 dimensions() const { return u32(_dims.size()); }
+
+    /// 第 dim 维的第 index 个点，位于 [0, 1)
+    NOVA_FUNC f32 sample(u64 index, u32 dim) const
+    {
+        const auto& d = _dims[dim];
+        return toFloat(d, f64(reversed(d, index, 0, d.digits)));
+    }
+
+    /**
+     * @brief out[i] = sample(firstIndex + i, dim)，结果与逐个调用 sample 完全一致。
+     *
+     * 把下标拆成 hi * base^m + lo，反转后的数字同样可以拆成两部分之和：低 m 位的贡献对一批输出预先算好，
+     * 每 base^m 个点只需要对 hi 做一次逐位计算，内层循环只剩一次查表、加法与乘法。
+     * 两部分都以 f64 保存：反转后的整数小于 2^53，求和与转换都是精确的，f64 到 f32 只舍入一次，
+     * 与 u64 直接转换的结果相同。AVX2 没有 64 位整数到浮点数的转换指令，改用 f64 后内层循环才能被自动向量化。
+     */
+    void fill(u32 dim, u64 firstIndex, std::span<f32> out) const
+    {
+        const auto& d = _dims[dim];
+        if (out.size() < d.block) {
+            for (size i = 0; i < out.size(); ++i)
+                out[i] = sample(firstIndex + i, dim);
+            return;
+        }
+
+        // 低位数字的贡献需要左移到第 n 位，乘以 base^(n - m)
+        u64 scale = 1;
+        for (auto k = d.lowDigits; k < d.digits; ++k)
+            scale *= d.base;
+
+        std::array<f64, kMaxBlock> low;
+        for (u32 lo = 0; lo < d.block; ++lo)
+            low[lo] = f64(reversed(d, lo, 0, d.lowDigits) * scale);
+
+        for (size i = 0; i < out.size();) {
+            const auto index = firstIndex + i;
+            const auto hi    = index / d.block;
+            const auto lo    = index - hi * d.block;
+            const auto n     = Min<size>(d.block - lo, out.size() - i);
+            const auto high  = f64(reversed(d, hi, d.lowDigits, d.digits));
+
+            for (size k = 0; k < n; ++k)
+                out[i + k] = toFloat(d, high + low[lo + k]);
+            i += n;
+        }
+    }
+
+private:
+    static constexpr u32 kMaxBlock = 512;
+
+    struct Dimension
+    {
+        u32 base;
+        u32 digits;    ///< 参与计算的位数 n
+        u32 lowDigits; ///< 批量生成时预先计算的低位数 m
+        u32 block;     ///< base^m
+        f32 invBaseM;  ///< base^-n
+        size offset;   ///< 置换在 _perms 中的起点，第 k 位的置换位于 offset + k * base
+    };
+
+    void init(u32 dims, PCG32* rng)
+    {
+        NOVA_CHECK(dims <= kHaltonDimensions);
+
+        _dims.resize(dims);
+        for (u32 i = 0; i < dims; ++i) {
+            auto& d = _dims[i];
+            d.base  = internal::kPrimes[i];
+
+            // 与 RadicalInverse 相同的终止条件：再多一位已经无法影响 f32 的结果
+            const auto invBase = 1.f / f32(d.base);
+            d.digits   = 0;
+            d.invBaseM = 1;
+            while (1 - f32(d.base - 1) * d.invBaseM < 1) {
+                d.invBaseM *= invBase;
+                ++d.digits;
+            }
+
+            d.lowDigits = 1;
+            d.block     = d.base;
+            while (d.lowDigits < d.digits && d.block * d.base <= kMaxBlock) {
+                d.block *= d.base;
+                ++d.lowDigits;
+            }
+
+            d.offset = _perms.size();
+            for (u32 k = 0; k < d.digits; ++k) {
+                const auto first = _perms.size();
+                for (u32 j = 0; j < d.base; ++j)
+                    _perms.push_back(u16(j));
+
+                // Fisher-Yates 洗牌
+                if (rng != nullptr) {
+                    for (u32 j = d.base - 1; j > 0; --j)
+                        std::swap(_perms[first + j], _perms[first + rng->gen(j + 1)]);
+                }
+            }
+        }
+    }
+
+    /// 依次取 a 的各位数字作为第 first .. last-1 位，经过置换后按反转的顺序拼成整数
+    NOVA_FUNC u64 reversed(const Dimension& d, u64 a, u32 first, u32 last) const
+    {
+        const auto* perm = _perms.data() + d.offset;
+
+        u64 r = 0;
+        for (auto k = first; k < last; ++k) {
+            const auto next = a / d.base;
+            r               = r * d.base + perm[k * d.base + (a - next * d.base)];
+            a               = next;
+        }
+        return r;
+    }
+
+    NOVA_FUNC static f32 toFloat(const Dimension& d, f64 reversed)
+    {
+        return Min(f32(reversed) * d.invBaseM, kFloatOneMinusEpsilon);
+    }
+
+    std::vector<Dimension> _dims;
+    std::vector<u16> _perms;
+};
+
+} // namespace nova
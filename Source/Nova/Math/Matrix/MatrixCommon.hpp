@@ -651,7 +651,7 @@ struct MatrixFuncUni<mat, 4, 4, Ret, T>
 
 } //namespace internal
 
-template<i32 C, i32 R, typename T> NOVA_FUNC mat<2, 2, T> Transpose(const mat<C, R, T>& m)
+template<i32 C, i32 R, typename T> NOVA_FUNC mat<R, C, T> Transpose(const mat<C, R, T>& m)
 {
     return internal::ComputeTranspose<C, R, T>::call(m);
 }
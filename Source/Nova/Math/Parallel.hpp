@@ -0,0 +1,19 @@
+/**
+ * @File Parallel.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+// 在全局任务执行器上运行的批量接口，依赖 Taskflow，因此与标量/SoA 接口分开存放
+
+#include "./Parallel/Bounds.hpp"
+#include "./Parallel/ClosestPoint.hpp"
+#include "./Parallel/Distribution.hpp"
+#include "./Parallel/Gjk.hpp"
+#include "./Parallel/Random.hpp"
+#include "./Parallel/Sketch.hpp"
+#include "./Parallel/SphereSoA.hpp"
+#include "./Parallel/Triangle.hpp"
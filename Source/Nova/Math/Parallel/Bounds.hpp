@@ -0,0 +1,85 @@
+/**
+ * @File Bounds.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "../Geometry/Bounds.hpp"
+#include "../../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+namespace internal {
+
+/// 并行时每个块的元素数，也是开启并行的阈值
+inline constexpr size kBoundsGrain = 1 << 15;
+
+/**
+ * @brief 把 items 划分为块，分别调用 reduce(subspan) 后合并各块的包围盒。
+ */
+template<typename Box, typename T, typename Reduce> Box ParallelReduceBounds(std::span<const T> items, Reduce&& reduce)
+{
+    if (items.size() <= kBoundsGrain)
+        return reduce(items);
+
+    std::vector<Box> partial((items.size() + kBoundsGrain - 1) / kBoundsGrain);
+    ParallelFor(0, partial.size(), 1, [&](size first, size last) {
+        for (auto c = first; c < last; ++c)
+            partial[c] = reduce(items.subspan(c * kBoundsGrain, Min(kBoundsGrain, items.size() - c * kBoundsGrain)));
+    });
+
+    return UnionBounds(std::span<const Box>(partial));
+}
+
+} // namespace internal
+
+/**
+ * @brief 与 ComputeBounds 相同，元素数量超过阈值时按块在全局执行器上并行。
+ */
+inline aabb ParallelComputeBounds(std::span<const float3> points)
+{
+    return internal::ParallelReduceBounds<aabb>(points, [](std::span<const float3> s) { return ComputeBounds(s); });
+}
+
+inline rect ParallelComputeBounds(std::span<const float2> points)
+{
+    return internal::ParallelReduceBounds<rect>(points, [](std::span<const float2> s) { return ComputeBounds(s); });
+}
+
+/**
+ * @brief 与 UnionBounds 相同，元素数量超过阈值时按块在全局执行器上并行。
+ */
+inline aabb ParallelUnionBounds(std::span<const aabb> boxes)
+{
+    return internal::ParallelReduceBounds<aabb>(boxes, [](std::span<const aabb> s) { return UnionBounds(s); });
+}
+
+inline rect ParallelUnionBounds(std::span<const rect> boxes)
+{
+    return internal::ParallelReduceBounds<rect>(boxes, [](std::span<const rect> s) { return UnionBounds(s); });
+}
+
+/**
+ * @brief 与 TransformAABBs 相同，元素数量超过阈值时按块在全局执行器上并行。out 可以与 boxes 是同一块内存。
+ */
+inline void ParallelTransformAABBs(const mat4x4_t<Float>& m, std::span<const aabb> boxes, std::span<aabb> out)
+{
+    NOVA_CHECK(out.size() >= boxes.size());
+
+    if (boxes.size() <= internal::kBoundsGrain) {
+        TransformAABBs(m, boxes, out);
+        return;
+    }
+
+    ParallelFor(0, boxes.size(), internal::kBoundsGrain, [&](size first, size last) {
+        TransformAABBs(m, boxes.subspan(first, last - first), out.subspan(first, last - first));
+    });
+}
+
+} // namespace nova
@@ -0,0 +1,107 @@
+/**
+ * @File ClosestPoint.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+
+#include "../Geometry/ClosestPoint.hpp"
+#include "../../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+// -------------------------
+// 批量查询
+//
+// 输入输出均为 SoA，按块在全局执行器上并行，块内逐个调用无分支的单点版本。
+// -------------------------
+
+/**
+ * @brief 逐个求 points[i] 到三角形 (a[i], b[i], c[i]) 的最近点。
+ */
+inline void
+ParallelClosestPointOnTriangle(Float3SoA<> points, Float3SoA<> a, Float3SoA<> b, Float3SoA<> c, Float3SoA<f32> out)
+{
+    const auto n = points.count();
+    NOVA_CHECK(a.count() == n && b.count() == n && c.count() == n && out.count() >= n);
+
+    ParallelFor(0, n, 1024, [&](size first, size last) {
+        for (auto i = first; i < last; ++i) {
+            const auto va = a[i];
+            out.store(i, internal::ClosestPointOnTriangleBranchless(points[i], va, b[i] - va, c[i] - va));
+        }
+    });
+}
+
+/**
+ * @brief 逐个求线段 (p1[i], q1[i]) 与线段 (p2[i], q2[i]) 之间的最近点对。
+ */
+inline void ParallelClosestPointsOnSegments(Float3SoA<> p1,
+                                            Float3SoA<> q1,
+                                            Float3SoA<> p2,
+                                            Float3SoA<> q2,
+                                            Float3SoA<f32> outA,
+                                            Float3SoA<f32> outB)
+{
+    const auto n = p1.count();
+    NOVA_CHECK(q1.count() == n && p2.count() == n && q2.count() == n);
+    NOVA_CHECK(outA.count() >= n && outB.count() >= n);
+
+    ParallelFor(0, n, 1024, [&](size first, size last) {
+        for (auto i = first; i < last; ++i) {
+            const auto a = p1[i], b = p2[i];
+            const auto d1 = q1[i] - a, d2 = q2[i] - b;
+
+            f32 s, t;
+            internal::SegmentSegmentParams(a, d1, b, d2, s, t);
+            outA.store(i, a + d1 * s);
+            outB.store(i, b + d2 * t);
+        }
+    });
+}
+
+/**
+ * @brief 求一组点到同一个有向包围盒的最近点。
+ */
+inline void ParallelClosestPoint(const obb& box, Float3SoA<> points, Float3SoA<f32> out)
+{
+    const auto n = points.count();
+    NOVA_CHECK(out.count() >= n);
+
+    ParallelFor(0, n, 2048, [&](size first, size last) {
+        for (auto i = first; i < last; ++i)
+            out.store(i, ClosestPoint(box, points[i]));
+    });
+}
+
+/**
+ * @brief 求一组点在同一个网格上的最近点。
+ *
+ * @param triangles 非空时写入最近点所在三角形的编号
+ * @param maxDistanceSqr 只考虑距离平方小于该值的三角形；没有找到时输出原点并将三角形编号记为 ~0u
+ */
+inline void ParallelClosestPointOnMesh(const TriangleSoA& mesh,
+                                       Float3SoA<> points,
+                                       Float3SoA<f32> out,
+                                       std::span<u32> triangles = {},
+                                       f32 maxDistanceSqr       = kInfinity)
+{
+    const auto n = points.count();
+    NOVA_CHECK(out.count() >= n);
+    NOVA_CHECK(triangles.empty() || triangles.size() >= n);
+
+    ParallelFor(0, n, 64, [&](size first, size last) {
+        for (auto i = first; i < last; ++i) {
+            const auto r = mesh.closestPoint(points[i], maxDistanceSqr);
+            out.store(i, r.point);
+            if (!triangles.empty())
+                triangles[i] = r.triangle;
+        }
+    });
+}
+
+} // namespace nova
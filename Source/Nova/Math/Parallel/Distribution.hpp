@@ -0,0 +1,37 @@
+/**
+ * @File Distribution.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include "../Distribution.hpp"
+#include "../../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+/**
+ * @brief 分布构建时的分块执行策略：块数大于 1 时在全局执行器上并行处理各块。
+ *
+ * 用法：AliasTable(weights, ParallelChunks{})。块的划分固定，结果与串行构建逐位相同。
+ */
+struct ParallelChunks
+{
+    template<typename Func> void operator()(size chunks, Func&& func) const
+    {
+        if (chunks <= 1) {
+            if (chunks == 1)
+                func(0);
+            return;
+        }
+
+        ParallelFor(0, chunks, 1, [&](size first, size last) {
+            for (auto c = first; c < last; ++c)
+                func(c);
+        });
+    }
+};
+
+} // namespace nova
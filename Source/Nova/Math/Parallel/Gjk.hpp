@@ -0,0 +1,63 @@
+/**
+ * @File Gjk.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <variant>
+
+#include "../Geometry/Gjk.hpp"
+#include "../../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+/**
+ * @brief 批量计算形状对的接触信息。
+ *
+ * 对每一对形状按具体类型分派到模板化的查询，内层循环没有虚函数调用；各形状对在全局执行器上并行处理。
+ * caches 为空时不热启动，否则需与 pairs 一一对应。
+ */
+inline void ParallelConvexContact(std::span<const ConvexShape> shapes,
+                                  std::span<const ShapePair> pairs,
+                                  std::span<ContactResult> results,
+                                  std::span<GjkCache> caches = {})
+{
+    NOVA_CHECK(results.size() >= pairs.size());
+    NOVA_CHECK(caches.empty() || caches.size() >= pairs.size());
+
+    ParallelFor(0, pairs.size(), 64, [&](size first, size last) {
+        for (auto i = first; i < last; ++i) {
+            auto* cache = caches.empty() ? nullptr : &caches[i];
+            results[i]  = std::visit([cache](const auto& a, const auto& b) { return ConvexContact(a, b, cache); },
+                                     shapes[pairs[i].a],
+                                     shapes[pairs[i].b]);
+        }
+    });
+}
+
+/**
+ * @brief 批量判断形状对是否相交，结果以 0/1 写入 results。
+ */
+inline void ParallelConvexIntersect(std::span<const ConvexShape> shapes,
+                                    std::span<const ShapePair> pairs,
+                                    std::span<u8> results,
+                                    std::span<GjkCache> caches = {})
+{
+    NOVA_CHECK(results.size() >= pairs.size());
+    NOVA_CHECK(caches.empty() || caches.size() >= pairs.size());
+
+    ParallelFor(0, pairs.size(), 128, [&](size first, size last) {
+        for (auto i = first; i < last; ++i) {
+            auto* cache = caches.empty() ? nullptr : &caches[i];
+            results[i]  = std::visit([cache](const auto& a, const auto& b) { return ConvexIntersect(a, b, cache); },
+                                     shapes[pairs[i].a],
+                                     shapes[pairs[i].b]) ? 1 : 0;
+        }
+    });
+}
+
+} // namespace nova
@@ -0,0 +1,52 @@
+/**
+ * @File Random.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+
+#include "../Random.hpp"
+#include "../../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+namespace internal {
+
+/// 并行生成时每个块的长度。块的划分只取决于输出长度，与线程数无关
+inline constexpr size kRandomFillGrain = 1 << 16;
+
+template<typename T> void ParallelFillImpl(PCG32& rng, std::span<T> out)
+{
+    const auto blocks = (out.size() + kRandomFillGrain - 1) / kRandomFillGrain;
+
+    ParallelFor(0, blocks, 1, [&](size first, size last) {
+        // 每个任务从 rng 的副本跳到自己第一个块的起点，之后的块是连续的，不需要再跳
+        auto local = rng;
+        local.advance(cast_to<i64>(first * kRandomFillGrain));
+
+        const auto end = Min(out.size(), last * kRandomFillGrain);
+        for (auto i = first * kRandomFillGrain; i < end; ++i)
+            out[i] = local.template gen<T>();
+    });
+
+    rng.advance(cast_to<i64>(out.size()));
+}
+
+} // namespace internal
+
+/**
+ * @brief 在全局执行器上并行填充 out，结果与依次调用 out.size() 次 rng.gen<u32>() 逐位相同，与线程数无关。
+ *
+ * 输出被划分为固定长度的块，各任务用 PCG32::advance 跳到所负责的块的起点。返回时 rng 前进了 out.size() 步，
+ * 与串行生成后的状态一致，因此可以与串行调用交替使用。
+ */
+inline void ParallelFill(PCG32& rng, std::span<u32> out) { internal::ParallelFillImpl(rng, out); }
+
+/// 与 ParallelFill(PCG32&, std::span<u32>) 相同，每个数等价于一次 rng.gen<f32>()
+inline void ParallelFill(PCG32& rng, std::span<f32> out) { internal::ParallelFillImpl(rng, out); }
+
+} // namespace nova
@@ -0,0 +1,49 @@
+/**
+ * @File Sketch.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <type_traits>
+
+#include "../../Utils/Sketch.hpp"
+#include "../../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+namespace internal {
+
+inline constexpr size kSketchGrain = 1 << 12;
+
+} // namespace internal
+
+/**
+ * @brief 在全局执行器上并行插入一组键。插入本身是原子的按位或，各任务之间不需要同步。
+ */
+template<typename K, typename Hash>
+inline void ParallelInsert(BloomFilter<K, Hash>& filter, std::type_identity_t<std::span<const K>> keys)
+{
+    ParallelFor(0, keys.size(), internal::kSketchGrain, [&](size first, size last) {
+        for (auto i = first; i < last; ++i)
+            filter.insert(keys[i]);
+    });
+}
+
+/// 在全局执行器上并行查询一组键，结果按顺序写入 out
+template<typename K, typename Hash>
+inline void
+ParallelContains(const BloomFilter<K, Hash>& filter, std::type_identity_t<std::span<const K>> keys, std::span<bool> out)
+{
+    NOVA_CHECK(out.size() >= keys.size());
+
+    ParallelFor(0, keys.size(), internal::kSketchGrain, [&](size first, size last) {
+        for (auto i = first; i < last; ++i)
+            out[i] = filter.contains(keys[i]);
+    });
+}
+
+} // namespace nova
@@ -0,0 +1,30 @@
+/**
+ * @File SphereSoA.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+
+#include "../Geometry/SphereSoA.hpp"
+#include "../../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+/**
+ * @brief 一组射线分别求与 spheres 最近的交点，射线之间在全局执行器上并行。
+ */
+inline void ParallelIntersect(const SphereSoA& spheres, std::span<const Ray> rays, std::span<RaySphereHit> out)
+{
+    NOVA_CHECK(out.size() >= rays.size());
+
+    ParallelFor(0, rays.size(), 4, [&](size first, size last) {
+        for (auto i = first; i < last; ++i)
+            out[i] = spheres.intersect(rays[i]);
+    });
+}
+
+} // namespace nova
@@ -0,0 +1,67 @@
+/**
+ * @File Triangle.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "../Geometry/Triangle.hpp"
+#include "../../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+/**
+ * @brief 并行三角化多个多边形。
+ *
+ * 第 i 个多边形的三角形位于 indices[offsets[i], offsets[i + 1]) 中，三角化失败的多边形对应的区间为空。
+ */
+inline void
+ParallelTriangulate(std::span<const Polygon2D> polygons, std::vector<u32>& indices, std::vector<u32>& offsets)
+{
+    constexpr size kGrainSize = 256;
+
+    const auto count = polygons.size();
+    offsets.assign(count + 1, 0);
+    indices.clear();
+    if (count == 0)
+        return;
+
+    // 每个区间先写入各自的缓冲区，再按多边形顺序拼接
+    const auto chunkCount = (count + kGrainSize - 1) / kGrainSize;
+    std::vector<std::vector<u32>> chunkIndices(chunkCount);
+
+    ParallelFor(0, chunkCount, 1, [&](size firstChunk, size lastChunk) {
+        Triangulate triangulate;
+        for (auto c = firstChunk; c < lastChunk; ++c) {
+            auto& out       = chunkIndices[c];
+            const auto last = Min((c + 1) * kGrainSize, count);
+            for (auto i = c * kGrainSize; i < last; ++i) {
+                triangulate(polygons[i], out);
+                offsets[i + 1] = cast_to<u32>(out.size());
+            }
+        }
+    });
+
+    std::vector<size> chunkStart(chunkCount + 1, 0);
+    for (size c = 0; c < chunkCount; ++c)
+        chunkStart[c + 1] = chunkStart[c] + chunkIndices[c].size();
+
+    indices.resize(chunkStart[chunkCount]);
+    ParallelFor(0, chunkCount, 1, [&](size firstChunk, size lastChunk) {
+        for (auto c = firstChunk; c < lastChunk; ++c) {
+            std::copy(chunkIndices[c].begin(), chunkIndices[c].end(), indices.begin() + chunkStart[c]);
+
+            const auto last = Min((c + 1) * kGrainSize, count);
+            for (auto i = c * kGrainSize; i < last; ++i)
+                offsets[i + 1] += cast_to<u32>(chunkStart[c]);
+        }
+    });
+}
+
+} // namespace nova
@@ -7,10 +7,17 @@
 
 #pragma once
 
+#include <array>
+#include <span>
+
 #include "./Bit.hpp"
 #include "./Common.hpp"
 #include "./Hash.hpp"
 
+#ifdef NOVA_HAS_AVX2
+#  include <immintrin.h>
+#endif
+
 namespace nova {
 
 #define PCG32_DEFAULT_STATE  0x853c49e6748fea9bULL
@@ -37,6 +44,8 @@ public:
     NOVA_FUNC constexpr i64 distance(const PCG32& other) const;
 
 private:
+    friend class PCG32x8;
+
     u64 _state = PCG32_DEFAULT_STATE, _inc = PCG32_DEFAULT_STREAM;
 };
 
@@ -158,6 +167,387 @@ NOVA_FUNC constexpr i64 PCG32::distance(const PCG32& other) const
     return cast_to<i64>(distance);
 }
 
+namespace internal {
+
+/// 与 PCG32::gen<f32> 相同的映射：取高 23 位作为 [1, 2) 内浮点数的尾数，再减去 1
+NOVA_FUNC constexpr f32 BitsToUnitFloat(u32 v) { return std::bit_cast<f32>((v >> 9) | 0x3F800000u) - 1.f; }
+
+#ifdef NOVA_HAS_AVX2
+/// 4 个 64 位整数乘法的低 64 位：lo(a) * lo(b) + ((lo(a) * hi(b) + hi(a) * lo(b)) << 32)
+NOVA_FUNC __m256i Mul64(__m256i a, __m256i b)
+{
+    const auto cross = _mm256_mullo_epi32(a, _mm256_shuffle_epi32(b, 0xB1));
+    const auto sum   = _mm256_add_epi32(cross, _mm256_srli_epi64(cross, 32));
+    return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(sum, 32));
+}
+
+NOVA_FUNC __m256 BitsToUnitFloat(__m256i v)
+{
+    const auto bits = _mm256_or_si256(_mm256_srli_epi32(v, 9), _mm256_set1_epi32(0x3F800000));
+    return _mm256_sub_ps(_mm256_castsi256_ps(bits), _mm256_set1_ps(1.f));
+}
+#endif
+
+} // namespace internal
+
+/**
+ * @brief 8 路并行的 PCG32，每次调用产生 8 个数。
+ *
+ * 8 个通道相互独立，第 i 个通道产生的序列与 PCG32(streams[i]) 完全相同。
+ * 支持 AVX2 时 8 个 64 位状态放在两个 256 位寄存器中，64 位乘法由 32 位乘法拼出；否则逐通道计算。
+ */
+class PCG32x8
+{
+public:
+    static constexpr size kLanes = 8;
+
+    NOVA_FUNC constexpr PCG32x8() : PCG32x8(0) { }
+
+    /// 第 i 个通道等价于 PCG32(firstStream + i)
+    NOVA_FUNC constexpr explicit PCG32x8(u64 firstStream)
+    {
+        for (size i = 0; i < kLanes; ++i)
+            setLane(i, PCG32(firstStream + i));
+    }
+
+    NOVA_FUNC constexpr explicit PCG32x8(const std::array<u64, kLanes>& streams)
+    {
+        for (size i = 0; i < kLanes; ++i)
+            setLane(i, PCG32(streams[i]));
+    }
+
+    NOVA_FUNC constexpr explicit PCG32x8(const std::array<PCG32, kLanes>& lanes)
+    {
+        for (size i = 0; i < kLanes; ++i)
+            setLane(i, lanes[i]);
+    }
+
+    /// 第 i 个通道当前的状态
+    NOVA_FUNC constexpr PCG32 lane(size i) const
+    {
+        PCG32 rng;
+        rng._state = _state[i];
+        rng._inc   = _inc[i];
+        return rng;
+    }
+
+    NOVA_FUNC constexpr void setLane(size i, const PCG32& rng)
+    {
+        _state[i] = rng._state;
+        _inc[i]   = rng._inc;
+    }
+
+    /// 每个通道各产生一个 u32
+    NOVA_FUNC std::array<u32, kLanes> gen()
+    {
+        std::array<u32, kLanes> out;
+        step(out.data());
+        return out;
+    }
+
+    /// 每个通道各产生一个 [0, 1) 内的 f32，与 PCG32::gen<f32> 的映射相同
+    NOVA_FUNC std::array<f32, kLanes> genFloat()
+    {
+        std::array<f32, kLanes> out;
+        stepFloat(out.data());
+        return out;
+    }
+
+    /**
+     * @brief 填满 out：out[8k + i] 为第 i 个通道产生的第 k 个数。
+     *
+     * out.size() 不是 8 的倍数时，最后一次调用中多出的通道产生的数被丢弃，但这些通道仍然前进了一步。
+     */
+    NOVA_FUNC void fill(std::span<u32> out)
+    {
+        const auto full = out.size() / kLanes * kLanes;
+        for (size i = 0; i < full; i += kLanes)
+            step(out.data() + i);
+
+        if (full < out.size()) {
+            const auto rest = gen();
+            for (size i = full; i < out.size(); ++i)
+                out[i] = rest[i - full];
+        }
+    }
+
+    NOVA_FUNC void fill(std::span<f32> out)
+    {
+        const auto full = out.size() / kLanes * kLanes;
+        for (size i = 0; i < full; i += kLanes)
+            stepFloat(out.data() + i);
+
+        if (full < out.size()) {
+            const auto rest = genFloat();
+            for (size i = full; i < out.size(); ++i)
+                out[i] = rest[i - full];
+        }
+    }
+
+    /// 所有通道同时前进 delta 步
+    NOVA_FUNC constexpr void advance(i64 delta)
+    {
+        for (size i = 0; i < kLanes; ++i) {
+            auto rng = lane(i);
+            rng.advance(delta);
+            setLane(i, rng);
+        }
+    }
+
+private:
+#ifdef NOVA_HAS_AVX2
+    /// 4 个通道前进一步，返回的每个 64 位元素的低 32 位为输出
+    NOVA_FUNC static __m256i Step4(u64* state, const u64* inc)
+    {
+        const auto old  = _mm256_load_si256(reinterpret_cast<const __m256i*>(state));
+        const auto next = _mm256_add_epi64(internal::Mul64(old, _mm256_set1_epi64x(i64(PCG32_MULT))),
+                                           _mm256_load_si256(reinterpret_cast<const __m256i*>(inc)));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state), next);
+
+        const auto x   = _mm256_srli_epi64(_mm256_xor_si256(_mm256_srli_epi64(old, 18), old), 27);
+        const auto rot = _mm256_srli_epi64(old, 59);
+        const auto inv = _mm256_and_si256(_mm256_sub_epi32(_mm256_setzero_si256(), rot), _mm256_set1_epi32(31));
+        return _mm256_or_si256(_mm256_srlv_epi32(x, rot), _mm256_sllv_epi32(x, inv));
+    }
+
+    NOVA_FUNC __m256i step8()
+    {
+        const auto a = Step4(_state.data(), _inc.data());
+        const auto b = Step4(_state.data() + 4, _inc.data() + 4);
+
+        // 取出每个 64 位元素的低 32 位，按通道顺序拼成 8 个 u32
+        const auto lows = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+        return _mm256_permute2x128_si256(_mm256_permutevar8x32_epi32(a, lows), _mm256_permutevar8x32_epi32(b, lows), 0x20);
+    }
+
+    NOVA_FUNC void step(u32* out) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), step8()); }
+
+    NOVA_FUNC void stepFloat(f32* out) { _mm256_storeu_ps(out, internal::BitsToUnitFloat(step8())); }
+#else
+    NOVA_FUNC void step(u32* out)
+    {
+        for (size i = 0; i < kLanes; ++i) {
+            const auto old = _state[i];
+            _state[i]      = old * PCG32_MULT + _inc[i];
+            out[i]         = RotRight<u32>(cast_to<u32>(((old >> 18u) ^ old) >> 27u), cast_to<i32>(old >> 59u));
+        }
+    }
+
+    NOVA_FUNC void stepFloat(f32* out)
+    {
+        std::array<u32, kLanes> bits;
+        step(bits.data());
+        for (size i = 0; i < kLanes; ++i)
+            out[i] = internal::BitsToUnitFloat(bits[i]);
+    }
+#endif
+
+    alignas(32) std::array<u64, kLanes> _state{};
+    alignas(32) std::array<u64, kLanes> _inc{};
+};
+
+/**
+ * @brief 基于计数器的 Philox4x32-10 (Salmon et al., Parallel Random Numbers: As Easy as 1, 2, 3)。
+ *
+ * random(key, counter) 是纯函数：同一个 (key, counter) 总是得到相同的 4 个 u32，不同的计数器之间没有状态依赖。
+ * 并行采样时每个线程 / 像素直接用自己的编号作为计数器，不需要保存与更新状态，也不存在伪共享。
+ * 结果与 Random123 的 philox4x32_10 一致。
+ */
+struct Philox4x32
+{
+    using Counter = std::array<u32, 4>;
+    using Key     = std::array<u32, 2>;
+
+    static constexpr u32 kMul0   = 0xD2511F53u;
+    static constexpr u32 kMul1   = 0xCD9E8D57u;
+    static constexpr u32 kWeyl0  = 0x9E3779B9u;
+    static constexpr u32 kWeyl1  = 0xBB67AE85u;
+    static constexpr i32 kRounds = 10;
+
+    NOVA_FUNC static constexpr Counter random(Key key, Counter ctr)
+    {
+        for (i32 r = 0; r < kRounds; ++r) {
+            if (r > 0) {
+                key[0] += kWeyl0;
+                key[1] += kWeyl1;
+            }
+
+            const auto p0 = u64(kMul0) * ctr[0];
+            const auto p1 = u64(kMul1) * ctr[2];
+            ctr           = {u32(p1 >> 32) ^ ctr[1] ^ key[0], u32(p1), u32(p0 >> 32) ^ ctr[3] ^ key[1], u32(p0)};
+        }
+        return ctr;
+    }
+
+    /// 64 位的键与计数器：计数器占低两个分量，高两个分量为 0
+    NOVA_FUNC static constexpr Counter random(u64 key, u64 counter)
+    {
+        return random(Key{u32(key), u32(key >> 32)}, Counter{u32(counter), u32(counter >> 32), 0u, 0u});
+    }
+
+    /**
+     * @brief 批量求值：out[4k + j] = random(key, firstCounter + k)[j]，out.size() 不必是 4 的倍数。
+     *
+     * 支持 AVX2 时每次计算 8 个计数器，各分量放在独立的寄存器中。
+     */
+    NOVA_FUNC static void fill(u64 key, u64 firstCounter, std::span<u32> out)
+    {
+        fillImpl(key, firstCounter, out.size(), [&](size i, u32 v) { out[i] = v; });
+    }
+
+    /// 与 fill(u64, u64, std::span<u32>) 相同，每个 u32 按 PCG32::gen<f32> 的方式映射到 [0, 1)
+    NOVA_FUNC static void fill(u64 key, u64 firstCounter, std::span<f32> out)
+    {
+        fillImpl(key, firstCounter, out.size(), [&](size i, u32 v) { out[i] = internal::BitsToUnitFloat(v); });
+    }
+
+private:
+    static constexpr size kBatch = 8;
+
+    template<typename Store> NOVA_FUNC static void fillImpl(u64 key, u64 firstCounter, size count, Store&& store)
+    {
+        // 每个计数器产生 4 个数，每批 kBatch 个计数器
+        alignas(32) std::array<std::array<u32, kBatch>, 4> lanes;
+
+        const auto counters = (count + 3) / 4;
+        for (size base = 0; base < counters; base += kBatch) {
+            batch(key, firstCounter + base, lanes);
+
+            const auto first = base * 4;
+            const auto n     = Min(kBatch * 4, count - first);
+            for (size i = 0; i < n; ++i)
+                store(first + i, lanes[i % 4][i / 4]);
+        }
+    }
+
+    /// 计数器 first .. first + 7 的结果，按分量存放：lanes[j][k] 为第 k 个计数器的第 j 个分量
+    NOVA_FUNC static void batch(u64 key, u64 first, std::array<std::array<u32, kBatch>, 4>& lanes)
+    {
+        for (size k = 0; k < kBatch; ++k) {
+            const auto c = first + k;
+            lanes[0][k]  = u32(c);
+            lanes[1][k]  = u32(c >> 32);
+            lanes[2][k]  = 0;
+            lanes[3][k]  = 0;
+        }
+
+        u32 k0 = u32(key), k1 = u32(key >> 32);
+
+#ifdef NOVA_HAS_AVX2
+        auto c0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[0].data()));
+        auto c1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[1].data()));
+        auto c2 = _mm256_setzero_si256();
+        auto c3 = _mm256_setzero_si256();
+
+        const auto m0 = _mm256_set1_epi64x(kMul0);
+        const auto m1 = _mm256_set1_epi64x(kMul1);
+
+        // 8 个 32 位数与常数相乘，分别取乘积的高、低 32 位：偶数与奇数通道各做一次 32x32 -> 64 位乘法再拼回去
+        const auto mulHiLo = [](__m256i a, __m256i m, __m256i& hi, __m256i& lo) {
+            const auto even = _mm256_mul_epu32(a, m);
+            const auto odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+            lo              = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+            hi              = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+        };
+
+        for (i32 r = 0; r < kRounds; ++r) {
+            if (r > 0) {
+                k0 += kWeyl0;
+                k1 += kWeyl1;
+            }
+
+            __m256i hi0, lo0, hi1, lo1;
+            mulHiLo(c0, m0, hi0, lo0);
+            mulHiLo(c2, m1, hi1, lo1);
+
+            c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), _mm256_set1_epi32(i32(k0)));
+            c1 = lo1;
+            c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), _mm256_set1_epi32(i32(k1)));
+            c3 = lo0;
+        }
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0].data()), c0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1].data()), c1);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2].data()), c2);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[3].data()), c3);
+#else
+        for (i32 r = 0; r < kRounds; ++r) {
+            if (r > 0) {
+                k0 += kWeyl0;
+                k1 += kWeyl1;
+            }
+
+            for (size k = 0; k < kBatch; ++k) {
+                const auto p0 = u64(kMul0) * lanes[0][k];
+                const auto p1 = u64(kMul1) * lanes[2][k];
+                const auto c1 = lanes[1][k], c3 = lanes[3][k];
+
+                lanes[0][k] = u32(p1 >> 32) ^ c1 ^ k0;
+                lanes[1][k] = u32(p1);
+                lanes[2][k] = u32(p0 >> 32) ^ c3 ^ k1;
+                lanes[3][k] = u32(p0);
+            }
+        }
+#endif
+    }
+};
+
+/**
+ * @brief 基于哈希的计数器随机数，比 Philox 便宜，每次产生一个 u64。
+ *
+ * random(key, counter) = MixBits(MixBits(key) + counter * γ)，即以 MixBits(key) 为种子的 SplitMix64 序列的第 counter 项，
+ * 对固定的 key 是计数器的双射。只用到 64 位乘法的低位，支持 AVX2 时批量求值每次计算 4 个。
+ */
+struct HashCounterRng
+{
+    static constexpr u64 kGamma = 0x9E3779B97F4A7C15ull;
+
+    NOVA_FUNC static u64 random(u64 key, u64 counter) { return MixBits(MixBits(key) + counter * kGamma); }
+
+    /// out[i] = random(key, firstCounter + i)
+    NOVA_FUNC static void fill(u64 key, u64 firstCounter, std::span<u64> out)
+    {
+        const auto seed = MixBits(key);
+        size i          = 0;
+
+#ifdef NOVA_HAS_AVX2
+        const auto gamma4 = _mm256_set1_epi64x(i64(kGamma * 4));
+        const auto mulA   = _mm256_set1_epi64x(i64(0x7fb5d329728ea185ull));
+        const auto mulB   = _mm256_set1_epi64x(i64(0x81dadef4bc2dd44dull));
+
+        // 4 个通道的 seed + counter * γ，每次整体加 4γ
+        auto x = _mm256_add_epi64(_mm256_set1_epi64x(i64(seed + firstCounter * kGamma)),
+                                  _mm256_setr_epi64x(0, i64(kGamma), i64(kGamma * 2), i64(kGamma * 3)));
+        for (; i + 4 <= out.size(); i += 4) {
+            auto v = _mm256_xor_si256(x, _mm256_srli_epi64(x, 31));
+            v      = internal::Mul64(v, mulA);
+            v      = _mm256_xor_si256(v, _mm256_srli_epi64(v, 27));
+            v      = internal::Mul64(v, mulB);
+            v      = _mm256_xor_si256(v, _mm256_srli_epi64(v, 33));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + i), v);
+            x = _mm256_add_epi64(x, gamma4);
+        }
+#endif
+
+        for (; i < out.size(); ++i)
+            out[i] = MixBits(seed + (firstCounter + i) * kGamma);
+    }
+
+    /// out[i] 为 random(key, firstCounter + i) 的高 32 位按 PCG32::gen<f32> 的方式映射到 [0, 1)
+    NOVA_FUNC static void fill(u64 key, u64 firstCounter, std::span<f32> out)
+    {
+        constexpr size kChunk = 256;
+        std::array<u64, kChunk> bits;
+
+        for (size base = 0; base < out.size(); base += kChunk) {
+            const auto n = Min(kChunk, out.size() - base);
+            fill(key, firstCounter + base, std::span(bits.data(), n));
+            for (size i = 0; i < n; ++i)
+                out[base + i] = internal::BitsToUnitFloat(u32(bits[i] >> 32));
+        }
+    }
+};
+
 struct WyRand
 {
     NOVA_FUNC static constexpr u64 gen1(u64& seed)
@@ -0,0 +1,291 @@
+/**
+ * @File StreamHash.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <span>
+
+#include "./Hash.hpp"
+
+#ifdef NOVA_HAS_AVX2
+#  include <immintrin.h>
+#endif
+
+namespace nova {
+
+namespace internal {
+
+/// 按小端序读取，x86 上就是一次普通的读取，不需要像 wyR8 那样交换字节
+NOVA_FUNC u64 ReadLE64(const u8* p)
+{
+    u64 v;
+    Memcpy(&v, p, 8);
+    if constexpr (std::endian::native == std::endian::big)
+        v = std::byteswap(v);
+    return v;
+}
+
+NOVA_FUNC u64 ReadLE32(const u8* p)
+{
+    u32 v;
+    Memcpy(&v, p, 4);
+    if constexpr (std::endian::native == std::endian::big)
+        v = std::byteswap(v);
+    return v;
+}
+
+} // namespace internal
+
+/**
+ * @brief 可以分块输入的 64 位哈希，用于对大文件做内容寻址。
+ *
+ * 结果只取决于完整的输入与种子，与 update 的分块方式无关，也与是否启用 AVX2 无关。
+ * - 总长度不超过 kBufferSize 时，所有数据都留在缓冲区中，digest 时用 wyhash 的结构计算 (按小端序读取)；
+ * - 更长的输入按 XXH3 的方式处理：每 64 字节为一条 (stripe)，累加到 8 个互相独立的 64 位累加器中，
+ *   每 16 条 (一块) 对累加器做一次扰乱；最后一条总是输入末尾的 64 字节 (可能与前一条重叠)，最后合并累加器。
+ *
+ * 累加器之间没有依赖，支持 AVX2 时一条只需要两次 256 位的读取、异或、32x32 位乘法与加法，可以达到内存带宽。
+ */
+class StreamHasher
+{
+public:
+    static constexpr size kStripe          = 64;
+    static constexpr size kStripesPerBlock = 16;
+    static constexpr size kBufferSize      = 4 * kStripe;
+    static constexpr size kLanes           = 8;
+
+    explicit StreamHasher(u64 seed = 0) : _seed(seed)
+    {
+        for (size i = 0; i < kSecretWords; ++i)
+            _secret[i] = MixBits(seed + (i + 1) * 0x9E3779B97F4A7C15ull);
+        reset();
+    }
+
+    /// 清空已输入的数据，种子不变
+    void reset()
+    {
+        _acc           = kInitAcc;
+        _total         = 0;
+        _buffered      = 0;
+        _stripeInBlock = 0;
+    }
+
+    void update(const void* data, size len)
+    {
+        // data 在 len 为 0 时可以为空，不能传给 Memcpy
+        if (len == 0)
+            return;
+
+        auto* p = static_cast<const u8*>(data);
+        _total += len;
+
+        if (_buffered + len <= kBufferSize) {
+            Memcpy(_buffer.data() + _buffered, p, len);
+            _buffered += len;
+            return;
+        }
+
+        // 缓冲区填满且后面还有数据，其中的所有条都不是最后一条，可以直接处理
+        if (_buffered > 0) {
+            const auto fill = kBufferSize - _buffered;
+            Memcpy(_buffer.data() + _buffered, p, fill);
+            p += fill;
+            len -= fill;
+
+            consume(_buffer.data(), kBufferSize / kStripe);
+            _buffered = 0;
+        }
+
+        // 直接处理输入中的整条，至少留下 1 字节，保证最后一条在 digest 时处理
+        if (len > kBufferSize) {
+            const auto stripes = (len - 1) / kStripe;
+            consume(p, stripes);
+            p += stripes * kStripe;
+            len -= stripes * kStripe;
+        }
+
+        Memcpy(_buffer.data(), p, len);
+        _buffered = len;
+    }
+
+    void update(std::span<const std::byte> data) { update(data.data(), data.size()); }
+
+    /// 当前输入的哈希值，不改变状态，之后可以继续 update
+    u64 digest() const
+    {
+        if (_total <= kBufferSize)
+            return shortHash(_buffer.data(), _buffered);
+
+        auto acc           = _acc;
+        auto stripeInBlock = _stripeInBlock;
+
+        // 缓冲区中除最后一条之外的整条
+        const auto stripes = (_buffered - 1) / kStripe;
+        Consume(acc, stripeInBlock, _secret, _buffer.data(), stripes);
+
+        // 最后一条为输入末尾的 64 字节，缓冲区不够时从上一次处理的数据中补齐
+        std::array<u8, kStripe> last;
+        if (_buffered >= kStripe) {
+            Memcpy(last.data(), _buffer.data() + _buffered - kStripe, kStripe);
+        }
+        else {
+            const auto missing = kStripe - _buffered;
+            Memcpy(last.data(), _lastStripe.data() + _buffered, missing);
+            Memcpy(last.data() + missing, _buffer.data(), _buffered);
+        }
+        Accumulate(acc, last.data(), _secret.data() + kLastStripeKey);
+
+        auto h = _total * 0x9E3779B185EBCA87ull;
+        for (size i = 0; i < kLanes; i += 2)
+            h += internal::wyMix(acc[i] ^ _secret[kMergeKey + i], acc[i + 1] ^ _secret[kMergeKey + i + 1]);
+        return MixBits(h);
+    }
+
+    NOVA_FUNC u64 seed() const { return _seed; }
+
+    /// 一次性计算，与用同样的种子逐块 update 后 digest 的结果相同
+    static u64 Hash(const void* data, size len, u64 seed = 0)
+    {
+        StreamHasher hasher(seed);
+        hasher.update(data, len);
+        return hasher.digest();
+    }
+
+private:
+    // 第 s 条使用 _secret[s, s + 8)，扰乱、最后一条、合并各自使用独立的 8 个字
+    static constexpr size kScrambleKey   = kStripesPerBlock;
+    static constexpr size kLastStripeKey = kScrambleKey + kLanes;
+    static constexpr size kMergeKey      = kLastStripeKey + kLanes;
+    static constexpr size kSecretWords   = kMergeKey + kLanes;
+
+    static constexpr u64 kPrime32 = 0x9E3779B1u;
+
+    // XXH3 的初始累加器
+    static constexpr std::array<u64, kLanes> kInitAcc = {0xC2B2AE3Dull,         0x9E3779B185EBCA87ull, 0xC2B2AE3D27D4EB4Full,
+                                                         0x165667B19E3779F9ull, 0x85EBCA77C2B2AE63ull, 0x85EBCA77ull,
+                                                         0x27D4EB2F165667C5ull, 0x9E3779B1ull};
+
+    using Accumulators = std::array<u64, kLanes>;
+    using Secret       = std::array<u64, kSecretWords>;
+
+    void consume(const u8* p, size stripes)
+    {
+        Consume(_acc, _stripeInBlock, _secret, p, stripes);
+        Memcpy(_lastStripe.data(), p + (stripes - 1) * kStripe, kStripe);
+    }
+
+    /// 处理连续的若干条，每凑满一块扰乱一次
+    static void Consume(Accumulators& acc, size& stripeInBlock, const Secret& secret, const u8* p, size stripes)
+    {
+        for (size s = 0; s < stripes; ++s, p += kStripe) {
+            Accumulate(acc, p, secret.data() + stripeInBlock);
+            if (++stripeInBlock == kStripesPerBlock) {
+                Scramble(acc, secret.data() + kScrambleKey);
+                stripeInBlock = 0;
+            }
+        }
+    }
+
+    /// acc[j ^ 1] += d[j]，acc[j] += lo32(d[j] ^ key[j]) * hi32(d[j] ^ key[j])
+    static void Accumulate(Accumulators& acc, const u8* stripe, const u64* key)
+    {
+#ifdef NOVA_HAS_AVX2
+        for (size h = 0; h < kLanes; h += 4) {
+            auto* a       = reinterpret_cast<__m256i*>(acc.data() + h);
+            const auto d  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe + h * 8));
+            const auto k  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + h));
+            const auto dk = _mm256_xor_si256(d, k);
+
+            const auto product = _mm256_mul_epu32(dk, _mm256_srli_epi64(dk, 32));
+            const auto swapped = _mm256_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+            _mm256_storeu_si256(a, _mm256_add_epi64(_mm256_loadu_si256(a), _mm256_add_epi64(product, swapped)));
+        }
+#else
+        for (size j = 0; j < kLanes; ++j) {
+            const auto d  = internal::ReadLE64(stripe + j * 8);
+            const auto dk = d ^ key[j];
+            acc[j ^ 1] += d;
+            acc[j] += (dk & 0xFFFFFFFFull) * (dk >> 32);
+        }
+#endif
+    }
+
+    static void Scramble(Accumulators& acc, const u64* key)
+    {
+#ifdef NOVA_HAS_AVX2
+        const auto prime = _mm256_set1_epi64x(i64(kPrime32));
+        for (size h = 0; h < kLanes; h += 4) {
+            auto* a = reinterpret_cast<__m256i*>(acc.data() + h);
+            auto v  = _mm256_loadu_si256(a);
+            v       = _mm256_xor_si256(v, _mm256_srli_epi64(v, 47));
+            v       = _mm256_xor_si256(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + h)));
+
+            // 与 32 位常数相乘：低 32 位与高 32 位分别相乘，高位的乘积左移 32 位
+            const auto lo = _mm256_mul_epu32(v, prime);
+            const auto hi = _mm256_mul_epu32(_mm256_srli_epi64(v, 32), prime);
+            _mm256_storeu_si256(a, _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32)));
+        }
+#else
+        for (size j = 0; j < kLanes; ++j) {
+            auto v = acc[j];
+            v ^= v >> 47;
+            v ^= key[j];
+            acc[j] = v * kPrime32;
+        }
+#endif
+    }
+
+    /// 不超过 kBufferSize 字节的输入：wyhash 的结构，按小端序读取
+    u64 shortHash(const u8* p, size len) const
+    {
+        const auto s0 = _secret[0], s1 = _secret[1];
+        auto seed     = internal::wyMix(_seed ^ s0, s1);
+
+        u64 a, b;
+        if (len <= 16) {
+            if (len >= 4) {
+                const auto mid = (len >> 3) << 2;
+                a              = (internal::ReadLE32(p) << 32) | internal::ReadLE32(p + mid);
+                b              = (internal::ReadLE32(p + len - 4) << 32) | internal::ReadLE32(p + len - 4 - mid);
+            }
+            else if (len > 0) {
+                a = internal::wyR3(p, len);
+                b = 0;
+            }
+            else {
+                a = b = 0;
+            }
+        }
+        else {
+            auto i = len;
+            for (; i > 16; i -= 16, p += 16)
+                seed = internal::wyMix(internal::ReadLE64(p) ^ s1, internal::ReadLE64(p + 8) ^ seed);
+
+            a = internal::ReadLE64(p + i - 16);
+            b = internal::ReadLE64(p + i - 8);
+        }
+
+        a ^= s1;
+        b ^= seed;
+        internal::wyMum(&a, &b);
+        return internal::wyMix(a ^ s0 ^ len, b ^ s1);
+    }
+
+    alignas(32) Accumulators _acc;
+    Secret _secret;
+    std::array<u8, kBufferSize> _buffer;
+    std::array<u8, kStripe> _lastStripe; ///< 最近一次直接处理的最后一条，最后一条需要回看时使用
+    u64 _seed;
+    u64 _total;
+    size _buffered;
+    size _stripeInBlock;
+};
+
+} // namespace nova
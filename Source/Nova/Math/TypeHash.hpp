@@ -1,5 +1,5 @@
 /**
- * @File type_hash.hpp
+ * @File TypeHash.hpp
  * @Author dfnzhc (https://github.com/dfnzhc)
  * @Date 2024/6/2
  * @Brief 
@@ -7,50 +7,86 @@
 
 #pragma once
 
-#include "./vector.hpp"
-#include "./matrix.hpp"
-#include "./quaternion.hpp"
-#include "./hash.hpp"
+#include <functional>
 
-namespace std {
+#include "./Vector.hpp"
+#include "./Matrix.hpp"
+#include "./Quaternion.hpp"
+#include "./Hash.hpp"
+
+namespace nova {
+
+namespace internal {
 
-template<int L, typename T>
-struct hash<::bee::vec<L, T>>
+template<ArithmeticType T> NOVA_FUNC u64 HashBits(T v)
 {
-    constexpr uint32_t operator()(const ::bee::vec<L, T>& v) const
-    {
-        size_t result = 0;
+    // 使 -0 与 +0 得到相同的哈希值
+    if constexpr (FloatType<T>)
+        v += T(0);
 
-        for (int i = 0; i < L; ++i)
-            result ^= std::hash<T>()(v[i]) + 0x9e3779b9 + (result << 6) + (result >> 2);
-        return static_cast<uint32_t>(result);
-    }
-};
+    if constexpr (sizeof(T) == 8)
+        return BitCast<u64>(v);
+    else if constexpr (sizeof(T) == 4)
+        return BitCast<u32>(v);
+    else if constexpr (sizeof(T) == 2)
+        return BitCast<u16>(v);
+    else
+        return BitCast<u8>(v);
+}
 
-template<typename T>
-struct hash<::bee::quat<T>>
+template<ArithmeticType T> NOVA_FUNC u64 HashComponents(const T* data, i32 count, u64 seed)
 {
-    constexpr uint32_t operator()(const ::bee::quat<T>& q) const
-    {
-        size_t result = 0;
+    i32 i = 0;
 
-        for (int i = 0; i < 4; ++i)
-            result ^= std::hash<T>()(q[i]) + 0x9e3779b9 + (result << 6) + (result >> 2);
-        return static_cast<uint32_t>(result);
+    // 不超过 32 位的分量两两打包，每次 wyHash64 处理 64 位
+    if constexpr (sizeof(T) <= 4) {
+        for (; i + 1 < count; i += 2)
+            seed = wyHash64(HashBits(data[i]) | (HashBits(data[i + 1]) << 32), seed);
     }
+
+    for (; i < count; ++i)
+        seed = wyHash64(HashBits(data[i]), seed);
+
+    return seed;
+}
+
+} // namespace internal
+
+template<i32 L, ArithmeticType T> NOVA_FUNC u64 Hash(const vec<L, T>& v, u64 seed = 0)
+{
+    return internal::HashComponents(&v.x, L, seed);
+}
+
+template<ArithmeticType T> NOVA_FUNC u64 Hash(const quat<T>& q, u64 seed = 0)
+{
+    return internal::HashComponents(&q.x, 4, seed);
+}
+
+template<i32 C, i32 R, ArithmeticType T> NOVA_FUNC u64 Hash(const mat<C, R, T>& m, u64 seed = 0)
+{
+    for (i32 i = 0; i < C; ++i)
+        seed = Hash(m[i], seed);
+
+    return seed;
+}
+
+} // namespace nova
+
+namespace std {
+
+template<int L, typename T> struct hash<::nova::vec<L, T>>
+{
+    size_t operator()(const ::nova::vec<L, T>& v) const noexcept { return static_cast<size_t>(::nova::Hash(v)); }
 };
 
-template<int C, int R, typename T>
-struct hash<::bee::mat<C, R, T>>
+template<typename T> struct hash<::nova::quat<T>>
 {
-    constexpr uint32_t operator()(const ::bee::mat<C, R, T>& m) const
-    {
-        size_t result = 0;
+    size_t operator()(const ::nova::quat<T>& q) const noexcept { return static_cast<size_t>(::nova::Hash(q)); }
+};
 
-        for (int i = 0; i < C; ++i)
-            result ^= std::hash<::bee::vec<C, T>>()(m[i]) + 0x9e3779b9 + (result << 6) + (result >> 2);
-        return static_cast<uint32_t>(result);
-    }
+template<int C, int R, typename T> struct hash<::nova::mat<C, R, T>>
+{
+    size_t operator()(const ::nova::mat<C, R, T>& m) const noexcept { return static_cast<size_t>(::nova::Hash(m)); }
 };
 
-} // namespace std
\ No newline at end of file
+} // namespace std
@@ -445,12 +445,12 @@ template<typename T> NOVA_FUNC constexpr bool operator!=(const vec3_t<T>& v1, co
                                                                                                                        \
     template<ValType T> NOVA_FUNC constexpr vec3_t<T> operator opName(T scalar, const vec3_t<T>& v)                    \
     {                                                                                                                  \
-        return vec3_t<T>(v) op scalar;                                                                                 \
+        return vec3_t<T>(scalar) op v;                                                                                 \
     }                                                                                                                  \
                                                                                                                        \
     template<ValType T> NOVA_FUNC constexpr vec3_t<T> operator opName(const vec1_t<T>& v1, const vec3_t<T>& v2)        \
     {                                                                                                                  \
-        return vec3_t<T>(v2) op v1;                                                                                    \
+        return vec3_t<T>(v1.x) op v2;                                                                                  \
     }                                                                                                                  \
                                                                                                                        \
     template<ValType T> NOVA_FUNC constexpr vec3_t<T> operator opName(const vec3_t<T>& v1, const vec3_t<T>& v2)        \
@@ -0,0 +1,427 @@
+/**
+ * @File ConvexHull.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include "./ConvexHull.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include "../Math/Geometry/Predicates.hpp"
+#include "../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+namespace {
+
+// -------------------------
+// Barber, Dobkin & Huhdanpaa, The Quickhull Algorithm for Convex Hulls
+// -------------------------
+
+using Vec3 = vec3_t<f64>;
+
+constexpr u32 kInvalid = ~0u;
+
+/// 并行处理时每个任务负责的最少点数
+constexpr size kPointGrain = 1 << 14;
+
+NOVA_FUNC Vec3 ToVec3(const float3& p) { return Vec3(p.x, p.y, p.z); }
+
+struct Plane
+{
+    Vec3 n{0};
+    f64 d = 0;
+
+    NOVA_FUNC f64 distance(const Vec3& p) const { return Dot(n, p) - d; }
+};
+
+NOVA_FUNC Plane MakePlane(const Vec3& a, const Vec3& b, const Vec3& c)
+{
+    const auto n   = Cross(b - a, c - a);
+    const auto len = Length(n);
+    if (len <= 0)
+        return {};
+
+    // 平面经过三点的重心，减小离该点较远的顶点带来的舍入误差
+    const auto unit = n / len;
+    return {unit, Dot(unit, (a + b + c) / 3.0)};
+}
+
+/**
+ * @brief 并行求 score(i) 最大的下标，得分相同时取最小的下标。
+ */
+template<typename Score> u32 ParallelArgMax(size count, Score&& score)
+{
+    const auto chunkCount = (count + kPointGrain - 1) / kPointGrain;
+
+    std::vector<f64> bestScore(chunkCount, -std::numeric_limits<f64>::infinity());
+    std::vector<u32> bestIndex(chunkCount, 0);
+
+    ParallelFor(0, chunkCount, 1, [&](size first, size last) {
+        for (auto c = first; c < last; ++c) {
+            const auto end = Min(count, (c + 1) * kPointGrain);
+            for (auto i = c * kPointGrain; i < end; ++i) {
+                const auto s = score(i);
+                if (s > bestScore[c]) {
+                    bestScore[c] = s;
+                    bestIndex[c] = cast_to<u32>(i);
+                }
+            }
+        }
+    });
+
+    size best = 0;
+    for (size c = 1; c < chunkCount; ++c) {
+        if (bestScore[c] > bestScore[best])
+            best = c;
+    }
+    return bestIndex[best];
+}
+
+struct Face
+{
+    std::array<u32, 3> v;   ///< 顶点，从外侧看为逆时针
+    std::array<u32, 3> adj; ///< adj[e] 为共享边 (v[e], v[e + 1]) 的面
+    Plane plane;
+
+    u32 head         = kInvalid; ///< 外侧点链表
+    u32 furthest     = kInvalid;
+    f64 furthestDist = 0;
+    u32 visit        = 0;
+    bool alive       = true;
+};
+
+struct HorizonEdge
+{
+    u32 a, b;
+    u32 outside; ///< 地平线外侧保留下来的面
+};
+
+struct QuickHull
+{
+    std::span<const float3> points;
+    f64 epsilon = 0;
+
+    std::vector<Face> faces;
+    std::vector<u32> next; ///< 各面外侧点链表中的下一个点
+
+    std::vector<u32> freeFaces;
+    std::vector<u32> pending;
+    std::vector<u32> visible;
+    std::vector<HorizonEdge> horizon;
+    std::vector<u32> created;
+    u32 visitStamp = 0;
+
+    std::vector<u32> orphans;
+    std::vector<u32> owner;
+    std::vector<f64> ownerDist;
+
+    QuickHull(std::span<const float3> pts, f32 eps) : points(pts)
+    {
+        if (eps > 0) {
+            epsilon = eps;
+            return;
+        }
+
+        // 与 qhull 相同的做法：容差与坐标的量级及输入的舍入误差成正比
+        Vec3 maxAbs{0};
+        for (const auto& p : points)
+            maxAbs = Max(maxAbs, Abs(ToVec3(p)));
+        epsilon = 3.0 * (maxAbs.x + maxAbs.y + maxAbs.z) * f64(std::numeric_limits<f32>::epsilon());
+    }
+
+    Vec3 point(u32 i) const { return ToVec3(points[i]); }
+
+    /// 点 p 严格位于面的外侧。用精确的 Orient3D 判定，面的顶点从外侧看为逆时针，外侧的点使行列式为负
+    bool above(const Face& f, u32 p) const
+    {
+        return Orient3D(points[f.v[0]], points[f.v[1]], points[f.v[2]], points[p]) < 0;
+    }
+
+    u32 addFace(u32 a, u32 b, u32 c)
+    {
+        Face f;
+        f.v     = {a, b, c};
+        f.adj   = {kInvalid, kInvalid, kInvalid};
+        f.plane = MakePlane(point(a), point(b), point(c));
+
+        if (!freeFaces.empty()) {
+            const auto idx = freeFaces.back();
+            freeFaces.pop_back();
+            faces[idx] = f;
+            return idx;
+        }
+
+        faces.push_back(f);
+        return cast_to<u32>(faces.size() - 1);
+    }
+
+    void assignPoint(u32 face, u32 p, f64 dist)
+    {
+        auto& f = faces[face];
+        next[p] = f.head;
+        f.head  = p;
+        if (f.furthest == kInvalid || dist > f.furthestDist) {
+            f.furthest     = p;
+            f.furthestDist = dist;
+        }
+    }
+
+    /// 选取相距最远的极值点对、离其连线最远的点与离三点平面最远的点构成初始四面体
+    bool buildInitialSimplex(std::array<u32, 4>& simplex)
+    {
+        const auto count = points.size();
+
+        std::array<u32, 6> extremes;
+        for (i32 axis = 0; axis < 3; ++axis) {
+            extremes[axis * 2 + 0] = ParallelArgMax(count, [&](size i) { return -f64(points[i][axis]); });
+            extremes[axis * 2 + 1] = ParallelArgMax(count, [&](size i) { return f64(points[i][axis]); });
+        }
+
+        f64 bestDist = -1;
+        for (u32 i = 0; i < 6; ++i) {
+            for (u32 j = i + 1; j < 6; ++j) {
+                const auto d = LengthSqr(point(extremes[i]) - point(extremes[j]));
+                if (d > bestDist) {
+                    bestDist   = d;
+                    simplex[0] = extremes[i];
+                    simplex[1] = extremes[j];
+                }
+            }
+        }
+        if (bestDist <= epsilon * epsilon)
+            return false;
+
+        const auto a   = point(simplex[0]);
+        const auto dir = Normalize(point(simplex[1]) - a);
+        simplex[2]     = ParallelArgMax(count, [&](size i) { return LengthSqr(Cross(ToVec3(points[i]) - a, dir)); });
+        if (LengthSqr(Cross(point(simplex[2]) - a, dir)) <= epsilon * epsilon)
+            return false;
+
+        const auto plane = MakePlane(a, point(simplex[1]), point(simplex[2]));
+        simplex[3]       = ParallelArgMax(count, [&](size i) { return Abs(plane.distance(ToVec3(points[i]))); });
+
+        const auto side = plane.distance(point(simplex[3]));
+        if (Abs(side) <= epsilon)
+            return false;
+
+        // 第四个点在前三点平面的外侧时翻转底面，使各面从外侧看为逆时针
+        if (side > 0)
+            std::swap(simplex[1], simplex[2]);
+
+        return true;
+    }
+
+    /**
+     * @brief 将 orphans 中的点分配到 candidates 中距离最远的面的外侧，不在任何面外侧的点被丢弃。
+     *
+     * 距离不超过 epsilon 的点视为在凸包上；超过时再用 Orient3D 确认点确实在面的外侧。距离的计算按点并行，结果再串行连接到各面的链表中，因此分配结果与线程数无关。
+     */
+    void distribute(std::span<const u32> orphans, std::span<const u32> candidates)
+    {
+        owner.resize(orphans.size());
+        ownerDist.resize(orphans.size());
+
+        ParallelFor(0, orphans.size(), kPointGrain, [&](size first, size last) {
+            for (auto i = first; i < last; ++i) {
+                const auto p = point(orphans[i]);
+
+                f64 best = epsilon;
+                u32 face = kInvalid;
+                for (const auto f : candidates) {
+                    const auto d = faces[f].plane.distance(p);
+                    if (d > best && above(faces[f], orphans[i])) {
+                        best = d;
+                        face = f;
+                    }
+                }
+
+                owner[i]     = face;
+                ownerDist[i] = best;
+            }
+        });
+
+        for (size i = 0; i < orphans.size(); ++i) {
+            if (owner[i] != kInvalid)
+                assignPoint(owner[i], orphans[i], ownerDist[i]);
+        }
+    }
+
+    /**
+     * @brief 从 seed 出发收集所有可见的相连面以及可见区域的边界。
+     *
+     * 可见性用 Orient3D 精确判定而不使用容差：略微可见的面也被删除，新面与地平线外侧的面之间不会形成凹折。
+     */
+    void findHorizon(u32 seed, u32 eye)
+    {
+        ++visitStamp;
+        visible.clear();
+        horizon.clear();
+
+        faces[seed].visit = visitStamp;
+        visible.push_back(seed);
+
+        for (size k = 0; k < visible.size(); ++k) {
+            const auto f = visible[k];
+            for (u32 e = 0; e < 3; ++e) {
+                const auto g = faces[f].adj[e];
+                if (faces[g].visit == visitStamp)
+                    continue;
+
+                if (above(faces[g], eye)) {
+                    faces[g].visit = visitStamp;
+                    visible.push_back(g);
+                }
+                else {
+                    horizon.push_back({faces[f].v[e], faces[f].v[(e + 1) % 3], g});
+                }
+            }
+        }
+    }
+
+    void expand(u32 seed)
+    {
+        const auto eye = faces[seed].furthest;
+
+        findHorizon(seed, eye);
+
+        // 取出可见面外侧的点后删除这些面，空出的位置留给新面
+        orphans.clear();
+        for (const auto f : visible) {
+            for (auto p = faces[f].head; p != kInvalid; p = next[p]) {
+                if (p != eye)
+                    orphans.push_back(p);
+            }
+
+            faces[f].alive = false;
+            faces[f].head  = kInvalid;
+            freeFaces.push_back(f);
+        }
+
+        // 用地平线上的边与新顶点构成新的面
+        created.clear();
+        for (const auto& h : horizon) {
+            const auto nf = addFace(h.a, h.b, eye);
+            created.push_back(nf);
+
+            auto& outside = faces[h.outside];
+            for (u32 e = 0; e < 3; ++e) {
+                if (outside.v[e] == h.b && outside.v[(e + 1) % 3] == h.a)
+                    outside.adj[e] = nf;
+            }
+            faces[nf].adj[0] = h.outside;
+        }
+
+        // 新面 (a, b, eye) 的边 (b, eye) 与以 b 为起点的新面相邻，边 (eye, a) 与以 a 为终点的新面相邻
+        for (size k = 0; k < horizon.size(); ++k) {
+            for (size j = 0; j < horizon.size(); ++j) {
+                if (horizon[j].a == horizon[k].b)
+                    faces[created[k]].adj[1] = created[j];
+                if (horizon[j].b == horizon[k].a)
+                    faces[created[k]].adj[2] = created[j];
+            }
+        }
+
+        // 不在任何新面外侧的点已位于凸包内部
+        distribute(orphans, created);
+
+        for (const auto nf : created) {
+            if (faces[nf].head != kInvalid)
+                pending.push_back(nf);
+        }
+    }
+
+    bool build()
+    {
+        if (points.size() < 4)
+            return false;
+
+        std::array<u32, 4> s;
+        if (!buildInitialSimplex(s))
+            return false;
+
+        next.assign(points.size(), kInvalid);
+
+        addFace(s[0], s[1], s[2]);
+        addFace(s[0], s[3], s[1]);
+        addFace(s[0], s[2], s[3]);
+        addFace(s[1], s[3], s[2]);
+
+        for (u32 f = 0; f < 4; ++f) {
+            for (u32 e = 0; e < 3; ++e) {
+                const auto a = faces[f].v[e], b = faces[f].v[(e + 1) % 3];
+                for (u32 g = 0; g < 4; ++g) {
+                    for (u32 k = 0; k < 3; ++k) {
+                        if (faces[g].v[k] == b && faces[g].v[(k + 1) % 3] == a)
+                            faces[f].adj[e] = g;
+                    }
+                }
+            }
+        }
+
+        // 初始划分：除四面体顶点外的所有点
+        for (u32 i = 0; i < points.size(); ++i) {
+            if (i != s[0] && i != s[1] && i != s[2] && i != s[3])
+                orphans.push_back(i);
+        }
+
+        const std::array<u32, 4> initial = {0, 1, 2, 3};
+        distribute(orphans, initial);
+
+        for (u32 f = 0; f < 4; ++f) {
+            if (faces[f].head != kInvalid)
+                pending.push_back(f);
+        }
+
+        while (!pending.empty()) {
+            const auto f = pending.back();
+            pending.pop_back();
+
+            if (faces[f].alive && faces[f].head != kInvalid)
+                expand(f);
+        }
+
+        return true;
+    }
+
+    ConvexHull extract() const
+    {
+        ConvexHull hull;
+
+        std::vector<u32> remap(points.size(), kInvalid);
+        for (const auto& f : faces) {
+            if (!f.alive)
+                continue;
+
+            for (const auto v : f.v) {
+                if (remap[v] == kInvalid) {
+                    remap[v] = cast_to<u32>(hull.positions.size());
+                    hull.positions.push_back(points[v]);
+                    hull.sourceIndices.push_back(v);
+                }
+                hull.indices.push_back(remap[v]);
+            }
+
+            const auto& pl = f.plane;
+            hull.planes.emplace_back(f32(pl.n.x), f32(pl.n.y), f32(pl.n.z), f32(-pl.d));
+        }
+
+        return hull;
+    }
+};
+
+} // namespace
+
+ConvexHull BuildConvexHull(std::span<const float3> points, f32 epsilon)
+{
+    QuickHull qh(points, epsilon);
+    if (!qh.build())
+        return {};
+
+    return qh.extract();
+}
+
+} // namespace nova
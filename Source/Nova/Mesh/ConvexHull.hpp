@@ -0,0 +1,43 @@
+/**
+ * @File ConvexHull.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include "../Math/Vector.hpp"
+
+namespace nova {
+
+/**
+ * @brief 以索引三角形网格表示的三维凸包。
+ */
+struct ConvexHull
+{
+    std::vector<float3> positions;  ///< 凸包顶点
+    std::vector<u32> sourceIndices; ///< 凸包顶点在输入点集中的下标
+    std::vector<u32> indices;       ///< 三角形，从外侧看为逆时针
+    std::vector<float4> planes;     ///< 每个三角形所在的平面 (n, -d)，Dot(plane, float4(p, 1)) 为有符号距离，外侧为正
+
+    NOVA_FUNC bool empty() const { return indices.empty(); }
+};
+
+/**
+ * @brief 用 Quickhull 构建三维点集的凸包。
+ *
+ * 点到面的划分使用容差：平面方程与距离在双精度下计算，与已有平面的距离不超过 epsilon 的点视为在凸包上或内部，
+ * 因此近似共面的点不会产生狭长的碎片三角形，这些点可能位于结果外侧不超过 epsilon 的距离内。
+ * 扩张时哪些面对新顶点可见则用精确的 Orient3D 判定，不受容差影响，所以结果的相邻面之间总是凸的或共面的。
+ * 初始单纯形的极值点搜索与点到面的划分 (包括每次扩张后的重新分配) 在点数较多时于全局执行器上并行进行，结果与线程数无关。
+ *
+ * 点集退化 (少于 4 个点，或全部共线、共面) 时返回空的凸包。
+ *
+ * @param epsilon 距离容差；不大于 0 时根据点集坐标的范围与单精度舍入误差自动确定。
+ */
+NOVA_API ConvexHull BuildConvexHull(std::span<const float3> points, f32 epsilon = 0);
+
+} // namespace nova
@@ -0,0 +1,50 @@
+/**
+ * @File MeshAdjacency.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include "../Math/Common.hpp"
+
+namespace nova::internal {
+
+/// 以 CSR 形式存储的 "顶点 -> 三角形" 邻接表
+struct TriangleAdjacency
+{
+    std::vector<u32> counts;
+    std::vector<u32> offsets;
+    std::vector<u32> triangles;
+
+    void build(std::span<const u32> indices, size vertexCount)
+    {
+        const auto faceCount = indices.size() / 3;
+
+        counts.assign(vertexCount, 0);
+        offsets.resize(vertexCount);
+        triangles.resize(indices.size());
+
+        for (const auto idx : indices)
+            counts[idx]++;
+
+        u32 offset = 0;
+        for (size i = 0; i < vertexCount; ++i) {
+            offsets[i]  = offset;
+            offset     += counts[i];
+        }
+
+        std::vector<u32> cursor = offsets;
+        for (size t = 0; t < faceCount; ++t) {
+            for (size k = 0; k < 3; ++k)
+                triangles[cursor[indices[t * 3 + k]]++] = cast_to<u32>(t);
+        }
+    }
+
+    std::span<const u32> operator[](u32 v) const { return {triangles.data() + offsets[v], counts[v]}; }
+};
+
+} // namespace nova::internal
@@ -0,0 +1,310 @@
+/**
+ * @File MeshOptimizer.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include "./MeshOptimizer.hpp"
+#include "./MeshAdjacency.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace nova {
+
+namespace {
+
+// -------------------------
+// Forsyth 顶点缓存优化
+// https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+// -------------------------
+
+constexpr u32 kCacheSize       = 32;
+constexpr u32 kMaxValence      = 64;
+constexpr f32 kCacheDecayPower = 1.5f;
+constexpr f32 kLastTriScore    = 0.75f;
+constexpr f32 kValenceScale    = 2.0f;
+constexpr f32 kValencePower    = 0.5f;
+
+struct ScoreTable
+{
+    std::array<f32, kCacheSize + 3> cache{};
+    std::array<f32, kMaxValence + 1> valence{};
+
+    ScoreTable()
+    {
+        for (u32 i = 0; i < kCacheSize + 3; ++i) {
+            if (i < 3)
+                cache[i] = kLastTriScore;
+            else if (i < kCacheSize) {
+                const auto s = 1.f - f32(i - 3) / f32(kCacheSize - 3);
+                cache[i]     = std::pow(s, kCacheDecayPower);
+            }
+        }
+
+        valence[0] = 0.f;
+        for (u32 i = 1; i <= kMaxValence; ++i)
+            valence[i] = kValenceScale * std::pow(f32(i), -kValencePower);
+    }
+};
+
+const ScoreTable& GetScoreTable()
+{
+    static const ScoreTable table;
+    return table;
+}
+
+NOVA_FUNC f32 VertexScore(const ScoreTable& table, i32 cachePos, u32 liveTris)
+{
+    // 没有剩余三角形的顶点不再参与排序
+    if (liveTris == 0)
+        return -1.f;
+
+    const auto cacheScore = cachePos < 0 ? 0.f : table.cache[cachePos];
+    return cacheScore + table.valence[Min(liveTris, kMaxValence)];
+}
+
+} // namespace
+
+void OptimizeVertexCache(std::span<u32> dst, std::span<const u32> indices, size vertexCount)
+{
+    NOVA_CHECK(indices.size() % 3 == 0);
+    NOVA_CHECK(dst.size() >= indices.size());
+
+    const auto faceCount = indices.size() / 3;
+    if (faceCount == 0)
+        return;
+
+    // 支持就地优化
+    std::vector<u32> inputCopy;
+    if (dst.data() == indices.data()) {
+        inputCopy.assign(indices.begin(), indices.end());
+        indices = inputCopy;
+    }
+
+    const auto& table = GetScoreTable();
+
+    internal::TriangleAdjacency adjacency;
+    adjacency.build(indices, vertexCount);
+
+    // 各顶点剩余的三角形数量保存在 adjacency.counts 中
+    auto& liveTris = adjacency.counts;
+
+    std::vector<i32> cachePos(vertexCount, -1);
+    std::vector<f32> vertexScore(vertexCount);
+    for (size i = 0; i < vertexCount; ++i)
+        vertexScore[i] = VertexScore(table, -1, liveTris[i]);
+
+    std::vector<f32> triScore(faceCount);
+    std::vector<u8> emitted(faceCount, 0);
+    for (size t = 0; t < faceCount; ++t) {
+        triScore[t] = vertexScore[indices[t * 3 + 0]] + vertexScore[indices[t * 3 + 1]] +
+                      vertexScore[indices[t * 3 + 2]];
+    }
+
+    std::array<u32, kCacheSize + 3> cache{};
+    std::array<u32, kCacheSize + 3> nextCache{};
+    u32 cacheCount = 0;
+
+    auto bestTri    = cast_to<u32>(std::max_element(triScore.begin(), triScore.end()) - triScore.begin());
+    size scanCursor = 0;
+
+    for (size out = 0; out < faceCount; ++out) {
+        // 缓存中没有可用的三角形时，按输入顺序选取下一个未输出的三角形
+        if (bestTri == ~0u) {
+            while (emitted[scanCursor])
+                ++scanCursor;
+            bestTri = cast_to<u32>(scanCursor);
+        }
+
+        const u32 a = indices[bestTri * 3 + 0];
+        const u32 b = indices[bestTri * 3 + 1];
+        const u32 c = indices[bestTri * 3 + 2];
+
+        dst[out * 3 + 0] = a;
+        dst[out * 3 + 1] = b;
+        dst[out * 3 + 2] = c;
+        emitted[bestTri] = 1;
+
+        // 将该三角形从三个顶点的邻接表中移除
+        for (const auto v : {a, b, c}) {
+            auto* tris        = adjacency.triangles.data() + adjacency.offsets[v];
+            const auto count  = liveTris[v];
+            for (u32 i = 0; i < count; ++i) {
+                if (tris[i] == bestTri) {
+                    tris[i] = tris[count - 1];
+                    break;
+                }
+            }
+            liveTris[v]--;
+        }
+
+        // 更新 LRU 缓存：新三角形的顶点放在最前面
+        u32 nextCount          = 0;
+        nextCache[nextCount++] = a;
+        nextCache[nextCount++] = b;
+        nextCache[nextCount++] = c;
+
+        for (u32 i = 0; i < cacheCount; ++i) {
+            const auto v = cache[i];
+            if (v == a || v == b || v == c)
+                continue;
+
+            if (nextCount < kCacheSize + 3)
+                nextCache[nextCount++] = v;
+            else
+                cachePos[v] = -1;
+        }
+
+        std::swap(cache, nextCache);
+        cacheCount = nextCount;
+
+        // 更新缓存中顶点的分数，并在其邻接三角形中寻找分数最高的三角形
+        bestTri       = ~0u;
+        f32 bestScore = -1.f;
+
+        for (u32 i = 0; i < cacheCount; ++i) {
+            const auto v   = cache[i];
+            const auto pos = i < kCacheSize ? cast_to<i32>(i) : -1;
+            cachePos[v]    = pos;
+
+            const auto score = VertexScore(table, pos, liveTris[v]);
+            const auto delta = score - vertexScore[v];
+            vertexScore[v]   = score;
+
+            const auto* tris = adjacency.triangles.data() + adjacency.offsets[v];
+            for (u32 k = 0; k < liveTris[v]; ++k) {
+                const auto t  = tris[k];
+                triScore[t]  += delta;
+
+                if (triScore[t] > bestScore) {
+                    bestScore = triScore[t];
+                    bestTri   = t;
+                }
+            }
+        }
+    }
+}
+
+size GenerateVertexFetchRemap(std::span<u32> remap, std::span<const u32> indices, size vertexCount)
+{
+    NOVA_CHECK(remap.size() >= vertexCount);
+
+    std::fill_n(remap.begin(), vertexCount, ~0u);
+
+    u32 next = 0;
+    for (const auto idx : indices) {
+        NOVA_CHECK_LT(idx, vertexCount);
+        if (remap[idx] == ~0u)
+            remap[idx] = next++;
+    }
+
+    return next;
+}
+
+void RemapIndexBuffer(std::span<u32> dst, std::span<const u32> indices, std::span<const u32> remap)
+{
+    NOVA_CHECK(dst.size() >= indices.size());
+
+    for (size i = 0; i < indices.size(); ++i)
+        dst[i] = remap[indices[i]];
+}
+
+void RemapVertexBuffer(void* dst, const void* vertices, size vertexCount, size vertexSize, std::span<const u32> remap)
+{
+    auto* out      = static_cast<u8*>(dst);
+    const auto* in = static_cast<const u8*>(vertices);
+
+    for (size i = 0; i < vertexCount; ++i) {
+        if (remap[i] != ~0u)
+            Memcpy(out + remap[i] * vertexSize, in + i * vertexSize, vertexSize);
+    }
+}
+
+size OptimizeVertexFetch(void* dst, std::span<u32> indices, const void* vertices, size vertexCount, size vertexSize)
+{
+    std::vector<u32> remap(vertexCount);
+    const auto uniqueCount = GenerateVertexFetchRemap(remap, indices, vertexCount);
+
+    RemapVertexBuffer(dst, vertices, vertexCount, vertexSize, remap);
+    RemapIndexBuffer(indices, indices, remap);
+
+    return uniqueCount;
+}
+
+VertexCacheStatistics AnalyzeVertexCache(std::span<const u32> indices, size vertexCount, u32 cacheSize)
+{
+    NOVA_CHECK(indices.size() % 3 == 0);
+    NOVA_CHECK_GT(cacheSize, 0u);
+
+    VertexCacheStatistics stats;
+    if (indices.empty())
+        return stats;
+
+    // FIFO 缓存：记录每个顶点进入缓存时的时间戳，时间戳过期即视为被逐出
+    std::vector<u32> timestamps(vertexCount, 0);
+    std::vector<u8> referenced(vertexCount, 0);
+    u32 time = cacheSize + 1;
+
+    for (const auto idx : indices) {
+        NOVA_CHECK_LT(idx, vertexCount);
+        referenced[idx] = 1;
+        if (time - timestamps[idx] > cacheSize) {
+            timestamps[idx] = time++;
+            stats.vertexTransforms++;
+        }
+    }
+
+    size uniqueCount = 0;
+    for (const auto r : referenced)
+        uniqueCount += r;
+
+    stats.acmr = f32(stats.vertexTransforms) / f32(indices.size() / 3);
+    stats.atvr = f32(stats.vertexTransforms) / f32(uniqueCount);
+
+    return stats;
+}
+
+VertexFetchStatistics AnalyzeVertexFetch(std::span<const u32> indices, size vertexCount, size vertexSize)
+{
+    NOVA_CHECK_GT(vertexSize, 0u);
+
+    constexpr size kLineSize  = 64;
+    constexpr size kLineCount = 256; // 16KB 直接映射缓存
+
+    VertexFetchStatistics stats;
+    if (indices.empty())
+        return stats;
+
+    std::vector<u8> referenced(vertexCount, 0);
+    std::array<size, kLineCount> lines;
+    lines.fill(~size(0));
+
+    for (const auto idx : indices) {
+        NOVA_CHECK_LT(idx, vertexCount);
+        referenced[idx] = 1;
+
+        const auto start = idx * vertexSize;
+        const auto end   = start + vertexSize;
+        for (auto line = start / kLineSize; line <= (end - 1) / kLineSize; ++line) {
+            auto& slot = lines[line % kLineCount];
+            if (slot != line) {
+                slot                = line;
+                stats.bytesFetched += kLineSize;
+            }
+        }
+    }
+
+    size uniqueCount = 0;
+    for (const auto r : referenced)
+        uniqueCount += r;
+
+    stats.overfetch = f32(stats.bytesFetched) / f32(uniqueCount * vertexSize);
+
+    return stats;
+}
+
+} // namespace nova
@@ -0,0 +1,85 @@
+/**
+ * @File MeshOptimizer.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include "../Base/Defines.hpp"
+
+namespace nova {
+
+/**
+ * 顶点缓存（Post-transform cache）的模拟统计结果
+ */
+struct VertexCacheStatistics
+{
+    u32 vertexTransforms = 0;   ///< 缓存未命中的次数，即顶点着色器的调用次数
+    f32 acmr             = 0.f; ///< 平均每个三角形的缓存未命中数 (Average Cache Miss Ratio)，范围 [0.5, 3]
+    f32 atvr             = 0.f; ///< 平均每个顶点被变换的次数 (Average Transformed Vertex Ratio)，最优为 1
+};
+
+/**
+ * 顶点读取（Pre-transform cache）的模拟统计结果
+ */
+struct VertexFetchStatistics
+{
+    u64 bytesFetched = 0;   ///< 以缓存行为单位从内存中读取的总字节数
+    f32 overfetch    = 0.f; ///< 读取字节数与实际引用的顶点数据大小之比，最优为 1
+};
+
+/**
+ * @brief 使用 Tom Forsyth 的线性时间算法对三角形重新排序，以提高顶点缓存的命中率。
+ *
+ * @param dst 输出的索引缓冲区，大小需与 indices 相同；允许与 indices 指向同一块内存。
+ * @param indices 三角形列表的索引缓冲区，大小需为 3 的倍数。
+ * @param vertexCount 顶点的数量，所有索引都需要小于该值。
+ */
+NOVA_API void OptimizeVertexCache(std::span<u32> dst, std::span<const u32> indices, size vertexCount);
+
+/**
+ * @brief 按照顶点在索引缓冲区中首次出现的顺序生成重映射表。
+ *
+ * @param remap 输出的重映射表，大小需为 vertexCount；未被引用的顶点会被映射为 ~0u。
+ * @return 被引用的顶点数量。
+ */
+NOVA_API size GenerateVertexFetchRemap(std::span<u32> remap, std::span<const u32> indices, size vertexCount);
+
+/**
+ * @brief 使用重映射表重写索引缓冲区，dst 允许与 indices 指向同一块内存。
+ */
+NOVA_API void RemapIndexBuffer(std::span<u32> dst, std::span<const u32> indices, std::span<const u32> remap);
+
+/**
+ * @brief 使用重映射表重排顶点缓冲区，映射为 ~0u 的顶点会被丢弃。dst 不能与 vertices 重叠。
+ */
+NOVA_API void
+RemapVertexBuffer(void* dst, const void* vertices, size vertexCount, size vertexSize, std::span<const u32> remap);
+
+/**
+ * @brief 按首次使用的顺序重排顶点，使顶点读取尽量连续，同时就地重写索引缓冲区。
+ *
+ * 通常在 OptimizeVertexCache 之后调用。
+ *
+ * @param dst 输出的顶点缓冲区，至少能容纳 vertexCount 个顶点，不能与 vertices 重叠。
+ * @return 重排后（被引用）的顶点数量。
+ */
+NOVA_API size
+OptimizeVertexFetch(void* dst, std::span<u32> indices, const void* vertices, size vertexCount, size vertexSize);
+
+/**
+ * @brief 使用 FIFO 缓存模拟顶点着色器的调用，统计 ACMR 与 ATVR。
+ *
+ * @param cacheSize 模拟的缓存大小，典型的硬件大小在 16 ~ 32 之间。
+ */
+NOVA_API VertexCacheStatistics AnalyzeVertexCache(std::span<const u32> indices, size vertexCount, u32 cacheSize = 16);
+
+/**
+ * @brief 使用直接映射的缓存行模拟顶点读取，统计内存读取量与 overfetch。
+ */
+NOVA_API VertexFetchStatistics AnalyzeVertexFetch(std::span<const u32> indices, size vertexCount, size vertexSize);
+
+} // namespace nova
@@ -0,0 +1,401 @@
+/**
+ * @File MeshSdf.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include "./MeshSdf.hpp"
+
+#include <algorithm>
+#include <array>
+#include "../Math/Geometry/ClosestPoint.hpp"
+#include "../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+namespace {
+
+/// 查询点到簇中心的距离超过簇半径的该倍数时，用偶极子近似整个簇的立体角
+constexpr f32 kFarFieldRatio = 2.f;
+
+/// 三角形对 p 张成的有向立体角 (Van Oosterom & Strackee)
+NOVA_FUNC f32 SolidAngle(const float3& p, const float3& v0, const float3& v1, const float3& v2)
+{
+    const auto a = v0 - p, b = v1 - p, c = v2 - p;
+    const auto la = Length(a), lb = Length(b), lc = Length(c);
+
+    const auto det   = Dot(a, Cross(b, c));
+    const auto denom = la * lb * lc + Dot(a, b) * lc + Dot(b, c) * la + Dot(c, a) * lb;
+    return 2.f * std::atan2(det, denom);
+}
+
+struct Cluster
+{
+    float3 center{0};     ///< 按面积加权的重心
+    float3 areaNormal{0}; ///< 面积加权的法线之和
+    f32 radius = 0;
+    u32 first  = 0;
+    u32 count  = 0;
+};
+
+class SdfBaker
+{
+public:
+    SdfBaker(std::span<const u32> indices, std::span<const float3> positions, const SdfOptions& options)
+        : _positions(positions)
+    {
+        NOVA_CHECK(indices.size() % 3 == 0);
+        NOVA_CHECK_GT(options.brickSize, 0u);
+
+        const auto triCount = indices.size() / 3;
+        NOVA_CHECK_GT(triCount, 0u);
+
+        _tris.resize(triCount);
+        _boxes.resize(triCount);
+
+        float3 lo = positions[indices[0]], hi = lo;
+        for (size t = 0; t < triCount; ++t) {
+            auto& tri = _tris[t];
+            tri       = {indices[t * 3 + 0], indices[t * 3 + 1], indices[t * 3 + 2]};
+
+            _boxes[t] = aabb(positions[tri[0]]);
+            for (const auto v : tri) {
+                NOVA_CHECK_LT(v, positions.size());
+                _boxes[t].include(positions[v]);
+                lo = Min(lo, positions[v]);
+                hi = Max(hi, positions[v]);
+            }
+        }
+
+        const auto extent = hi - lo;
+        _voxelSize        = options.voxelSize > 0 ? options.voxelSize
+                                                   : extent[MaxIndex(extent)] / f32(Max(options.resolution, 1u));
+        NOVA_CHECK_GT(_voxelSize, 0.f);
+
+        _brickSize = options.brickSize;
+        _origin    = lo - float3(f32(options.padding) * _voxelSize);
+
+        for (i32 i = 0; i < 3; ++i) {
+            const auto voxels = u32(std::ceil(extent[i] / _voxelSize)) + 2 * options.padding + 1;
+            _brickDims[i]     = (voxels + _brickSize - 1) / _brickSize;
+        }
+
+        _brickHalfDiagonal = 0.5f * std::sqrt(3.f) * f32(_brickSize - 1) * _voxelSize;
+        buildClusters();
+    }
+
+    NOVA_FUNC float3 origin() const { return _origin; }
+
+    NOVA_FUNC f32 voxelSize() const { return _voxelSize; }
+
+    NOVA_FUNC uint3 brickDims() const { return _brickDims; }
+
+    NOVA_FUNC f32 brickHalfDiagonal() const { return _brickHalfDiagonal; }
+
+    NOVA_FUNC size brickCount() const { return size(_brickDims.x) * _brickDims.y * _brickDims.z; }
+
+    /**
+     * @brief 计算一个砖块内所有体素的有符号距离，距离截断在 band 以内。
+     *
+     * 砖块内所有体素与表面的距离都超过 band 时不写入 out，返回 false，inside 给出砖块位于内部还是外部。
+     */
+    bool bakeBrick(size brick, f32 band, std::span<f32> out, bool& inside) const
+    {
+        const auto bx = u32(brick % _brickDims.x);
+        const auto by = u32(brick / _brickDims.x % _brickDims.y);
+        const auto bz = u32(brick / (size(_brickDims.x) * _brickDims.y));
+
+        const uint3 first = uint3(bx, by, bz) * _brickSize;
+        const auto lo     = voxelCenter(first);
+        const auto hi     = voxelCenter(first + uint3(_brickSize - 1));
+        const aabb brickBox(lo, hi);
+        const auto center = (lo + hi) * 0.5f;
+
+        // 砖块中心到表面的距离给出砖块内所有体素距离的上界
+        const auto centerDist = Sqrt(closestDistanceSqr(center, kInfinity));
+
+        if (centerDist - _brickHalfDiagonal > band) {
+            inside = windingNumber(center) > 0.5f;
+            return false;
+        }
+
+        const auto bound   = Min(centerDist + _brickHalfDiagonal, band);
+        const auto boundSq = bound * bound;
+
+        // 候选三角形按与砖块的包围盒距离排序，体素查询时可以尽早停止
+        std::vector<std::pair<f32, u32>> candidates;
+        for (size t = 0; t < _tris.size(); ++t) {
+            const auto d = DistanceSqr(brickBox, _boxes[t]);
+            if (d <= boxDistanceSlack(boundSq))
+                candidates.emplace_back(d, cast_to<u32>(t));
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        // 与表面不相交的砖块内环绕数处处相同
+        const auto surfaceInside = centerDist <= _brickHalfDiagonal;
+        const auto brickSign     = surfaceInside ? 0.f : (windingNumber(center) > 0.5f ? -1.f : 1.f);
+
+        for (u32 z = 0; z < _brickSize; ++z) {
+            for (u32 y = 0; y < _brickSize; ++y) {
+                for (u32 x = 0; x < _brickSize; ++x) {
+                    const auto p = voxelCenter(first + uint3(x, y, z));
+
+                    auto best = boundSq;
+                    for (const auto& [boxDist, t] : candidates) {
+                        if (boxDist >= best)
+                            break;
+                        if (DistanceSqr(_boxes[t], p) >= best)
+                            continue;
+
+                        const auto& tri = _tris[t];
+                        best = Min(best, DistanceSqrToTriangle(p, _positions[tri[0]], _positions[tri[1]], _positions[tri[2]]));
+                    }
+
+                    const auto dist = Min(Sqrt(best), band);
+                    const auto sign = surfaceInside ? (windingNumber(p) > 0.5f ? -1.f : 1.f) : brickSign;
+
+                    out[(size(z) * _brickSize + y) * _brickSize + x] = sign * dist;
+                }
+            }
+        }
+
+        return true;
+    }
+
+private:
+    NOVA_FUNC float3 voxelCenter(const uint3& v) const { return _origin + (float3(v) + 0.5f) * _voxelSize; }
+
+    /// 包围盒距离与三角形距离按单精度分别计算，比较时留出少量余量
+    NOVA_FUNC static f32 boxDistanceSlack(f32 distSq) { return distSq * (1.f + 1e-4f) + 1e-12f; }
+
+    f32 closestDistanceSqr(const float3& p, f32 best) const
+    {
+        for (size t = 0; t < _tris.size(); ++t) {
+            if (DistanceSqr(_boxes[t], p) >= best)
+                continue;
+
+            const auto& tri = _tris[t];
+            best = Min(best, DistanceSqrToTriangle(p, _positions[tri[0]], _positions[tri[1]], _positions[tri[2]]));
+        }
+        return best;
+    }
+
+    /// 三角形按所在的砖块聚成簇，每个簇记录偶极子近似所需的面积法线与重心
+    void buildClusters()
+    {
+        const auto triCount = _tris.size();
+
+        std::vector<u32> clusterOf(triCount);
+        std::vector<u32> clusterIds;
+        std::vector<u32> slot(brickCount(), ~0u);
+
+        const auto brickExtent = f32(_brickSize) * _voxelSize;
+        for (size t = 0; t < triCount; ++t) {
+            const auto& tri = _tris[t];
+            const auto c    = (_positions[tri[0]] + _positions[tri[1]] + _positions[tri[2]]) / 3.f;
+            const auto cell = uint3(Clamp((c - _origin) / brickExtent, float3(0.f), float3(_brickDims - 1u)));
+            const auto key  = (size(cell.z) * _brickDims.y + cell.y) * _brickDims.x + cell.x;
+
+            if (slot[key] == ~0u) {
+                slot[key] = cast_to<u32>(_clusters.size());
+                _clusters.emplace_back();
+            }
+            clusterOf[t] = slot[key];
+            _clusters[slot[key]].count++;
+        }
+
+        u32 offset = 0;
+        for (auto& c : _clusters) {
+            c.first  = offset;
+            offset  += c.count;
+            c.count  = 0;
+        }
+
+        _clusterTris.resize(triCount);
+        for (size t = 0; t < triCount; ++t) {
+            auto& c                            = _clusters[clusterOf[t]];
+            _clusterTris[c.first + c.count++] = cast_to<u32>(t);
+        }
+
+        for (auto& c : _clusters) {
+            f32 area = 0.f;
+            float3 weighted{0.f};
+            for (u32 i = 0; i < c.count; ++i) {
+                const auto& tri = _tris[_clusterTris[c.first + i]];
+                const auto& a = _positions[tri[0]], b = _positions[tri[1]], v = _positions[tri[2]];
+
+                const auto n  = Cross(b - a, v - a) * 0.5f;
+                const auto ar = Length(n);
+                c.areaNormal += n;
+                weighted     += (a + b + v) * (ar / 3.f);
+                area         += ar;
+            }
+
+            const auto& first = _tris[_clusterTris[c.first]];
+            c.center          = area > 0.f ? weighted / area : _positions[first[0]];
+
+            for (u32 i = 0; i < c.count; ++i) {
+                for (const auto v : _tris[_clusterTris[c.first + i]])
+                    c.radius = Max(c.radius, Length(_positions[v] - c.center));
+            }
+        }
+    }
+
+    /// 广义环绕数 (Barill et al., Fast Winding Numbers for Soups and Clouds)
+    f32 windingNumber(const float3& p) const
+    {
+        f32 omega = 0.f;
+        for (const auto& c : _clusters) {
+            const auto d    = c.center - p;
+            const auto dist = Length(d);
+
+            if (dist > kFarFieldRatio * c.radius) {
+                omega += Dot(c.areaNormal, d) / (dist * dist * dist);
+                continue;
+            }
+
+            for (u32 i = 0; i < c.count; ++i) {
+                const auto& tri  = _tris[_clusterTris[c.first + i]];
+                omega           += SolidAngle(p, _positions[tri[0]], _positions[tri[1]], _positions[tri[2]]);
+            }
+        }
+        return omega * kInv4Pi;
+    }
+
+    std::span<const float3> _positions;
+
+    std::vector<std::array<u32, 3>> _tris;
+    std::vector<aabb> _boxes;
+
+    std::vector<Cluster> _clusters;
+    std::vector<u32> _clusterTris;
+
+    float3 _origin{0};
+    f32 _voxelSize = 0;
+    u32 _brickSize = 0;
+    uint3 _brickDims{0};
+    f32 _brickHalfDiagonal = 0;
+};
+
+/// 按体素坐标取值的三线性插值，坐标在网格之外时取最近边界上的值
+template<typename Fetch>
+NOVA_FUNC f32 SampleTrilinear(const float3& origin, f32 voxelSize, const uint3& dims, const float3& p, Fetch&& fetch)
+{
+    const auto g  = Clamp((p - origin) / voxelSize - 0.5f, float3(0.f), float3(dims - 1u));
+    const auto i0 = Min(uint3(g), dims - 1u);
+    const auto i1 = Min(i0 + 1u, dims - 1u);
+    const auto t  = g - float3(i0);
+
+    const auto c00 = Lerp(fetch(i0.x, i0.y, i0.z), fetch(i1.x, i0.y, i0.z), t.x);
+    const auto c10 = Lerp(fetch(i0.x, i1.y, i0.z), fetch(i1.x, i1.y, i0.z), t.x);
+    const auto c01 = Lerp(fetch(i0.x, i0.y, i1.z), fetch(i1.x, i0.y, i1.z), t.x);
+    const auto c11 = Lerp(fetch(i0.x, i1.y, i1.z), fetch(i1.x, i1.y, i1.z), t.x);
+
+    return Lerp(Lerp(c00, c10, t.y), Lerp(c01, c11, t.y), t.z);
+}
+
+} // namespace
+
+f32 SdfGrid::sample(const float3& p) const
+{
+    return SampleTrilinear(origin, voxelSize, dims, p, [this](u32 x, u32 y, u32 z) { return at(x, y, z); });
+}
+
+f32 SparseSdf::at(u32 x, u32 y, u32 z) const
+{
+    const auto bx = x / brickSize, by = y / brickSize, bz = z / brickSize;
+    const auto id = brickTable[(size(bz) * brickDims.y + by) * brickDims.x + bx];
+
+    if (id == kOutside)
+        return narrowBand;
+    if (id == kInside)
+        return -narrowBand;
+
+    const auto lx = x % brickSize, ly = y % brickSize, lz = z % brickSize;
+    return bricks[size(id) * brickSize * brickSize * brickSize + (size(lz) * brickSize + ly) * brickSize + lx];
+}
+
+f32 SparseSdf::sample(const float3& p) const
+{
+    return SampleTrilinear(origin, voxelSize, dims(), p, [this](u32 x, u32 y, u32 z) { return at(x, y, z); });
+}
+
+SdfGrid BakeSdf(std::span<const u32> indices, std::span<const float3> positions, const SdfOptions& options)
+{
+    const SdfBaker baker(indices, positions, options);
+
+    const auto brickSize  = options.brickSize;
+    const auto brickDims  = baker.brickDims();
+    const auto brickVoxel = size(brickSize) * brickSize * brickSize;
+
+    SdfGrid grid;
+    grid.origin    = baker.origin();
+    grid.voxelSize = baker.voxelSize();
+    grid.dims      = brickDims * brickSize;
+    grid.distances.resize(size(grid.dims.x) * grid.dims.y * grid.dims.z);
+
+    ParallelForEach(0, baker.brickCount(), [&](size brick) {
+        std::vector<f32> local(brickVoxel);
+
+        bool inside = false;
+        baker.bakeBrick(brick, kInfinity, local, inside);
+
+        const auto bx = u32(brick % brickDims.x) * brickSize;
+        const auto by = u32(brick / brickDims.x % brickDims.y) * brickSize;
+        const auto bz = u32(brick / (size(brickDims.x) * brickDims.y)) * brickSize;
+
+        for (u32 z = 0; z < brickSize; ++z) {
+            for (u32 y = 0; y < brickSize; ++y) {
+                const auto* src = local.data() + (size(z) * brickSize + y) * brickSize;
+                auto* dst       = grid.distances.data() + ((size(bz + z) * grid.dims.y + by + y) * grid.dims.x + bx);
+                std::copy_n(src, brickSize, dst);
+            }
+        }
+    });
+
+    return grid;
+}
+
+SparseSdf BakeSparseSdf(std::span<const u32> indices, std::span<const float3> positions, const SdfOptions& options)
+{
+    const SdfBaker baker(indices, positions, options);
+
+    const auto brickSize  = options.brickSize;
+    const auto brickVoxel = size(brickSize) * brickSize * brickSize;
+    const auto brickCount = baker.brickCount();
+
+    SparseSdf sdf;
+    sdf.origin     = baker.origin();
+    sdf.voxelSize  = baker.voxelSize();
+    sdf.brickSize  = brickSize;
+    sdf.brickDims  = baker.brickDims();
+    sdf.narrowBand = options.narrowBand > 0 ? options.narrowBand : 2.f * baker.brickHalfDiagonal();
+
+    // 先并行烘焙到各砖块自己的缓冲区，再按砖块顺序紧凑存放，使结果与线程调度无关
+    std::vector<std::vector<f32>> baked(brickCount);
+    sdf.brickTable.resize(brickCount);
+
+    ParallelForEach(0, brickCount, [&](size brick) {
+        std::vector<f32> local(brickVoxel);
+
+        bool inside = false;
+        if (baker.bakeBrick(brick, sdf.narrowBand, local, inside))
+            baked[brick] = std::move(local);
+        else
+            sdf.brickTable[brick] = inside ? SparseSdf::kInside : SparseSdf::kOutside;
+    });
+
+    u32 allocated = 0;
+    for (size brick = 0; brick < brickCount; ++brick) {
+        if (baked[brick].empty())
+            continue;
+
+        sdf.brickTable[brick] = allocated++;
+        sdf.bricks.insert(sdf.bricks.end(), baked[brick].begin(), baked[brick].end());
+    }
+
+    return sdf;
+}
+
+} // namespace nova
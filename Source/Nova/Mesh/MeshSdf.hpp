@@ -0,0 +1,89 @@
+/**
+ * @File MeshSdf.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include "../Math/Vector.hpp"
+
+namespace nova {
+
+struct SdfOptions
+{
+    f32 voxelSize  = 0;  ///< 体素边长；不大于 0 时由 resolution 决定
+    u32 resolution = 64; ///< 网格包围盒最长轴上的体素数
+    u32 padding    = 2;  ///< 网格在网格包围盒之外扩展的体素数
+    u32 brickSize  = 8;  ///< 砖块的边长 (体素数)，并行与稀疏存储都以砖块为单位
+    f32 narrowBand = 0;  ///< 稀疏网格只保存距离不超过该值的砖块；不大于 0 时取一个砖块的对角线长度
+};
+
+/**
+ * @brief 稠密的有符号距离场，内部为负。
+ *
+ * 体素 (x, y, z) 的采样点位于 origin + (x + 0.5, y + 0.5, z + 0.5) * voxelSize，x 变化最快。
+ * 每个轴上的体素数都是砖块边长的整数倍。
+ */
+struct NOVA_API SdfGrid
+{
+    float3 origin{0};
+    f32 voxelSize = 0;
+    uint3 dims{0};
+    std::vector<f32> distances;
+
+    NOVA_FUNC f32 at(u32 x, u32 y, u32 z) const { return distances[(size(z) * dims.y + y) * dims.x + x]; }
+
+    /// 三线性插值采样，网格之外的点取最近边界上的值
+    f32 sample(const float3& p) const;
+};
+
+/**
+ * @brief 以砖块稀疏存储的有符号距离场。
+ *
+ * 与表面的距离都超过 narrowBand 的砖块不分配存储，只记录其位于内部还是外部，
+ * 此时砖块中的体素取 -narrowBand 或 narrowBand。体素坐标与 SdfGrid 相同。
+ */
+struct NOVA_API SparseSdf
+{
+    static constexpr u32 kOutside = ~0u;     ///< 未分配、位于外部的砖块
+    static constexpr u32 kInside  = ~0u - 1; ///< 未分配、位于内部的砖块
+
+    float3 origin{0};
+    f32 voxelSize  = 0;
+    f32 narrowBand = 0;
+    u32 brickSize  = 0;
+    uint3 brickDims{0};
+    std::vector<u32> brickTable; ///< 每个砖块在 bricks 中的编号，或 kOutside / kInside
+    std::vector<f32> bricks;     ///< 每个已分配的砖块占 brickSize^3 个值，砖块内 x 变化最快
+
+    NOVA_FUNC uint3 dims() const { return brickDims * brickSize; }
+
+    f32 at(u32 x, u32 y, u32 z) const;
+
+    /// 三线性插值采样，网格之外的点取最近边界上的值
+    f32 sample(const float3& p) const;
+
+    /// 已分配的砖块数量
+    NOVA_FUNC size allocatedBricks() const { return brickSize == 0 ? 0 : bricks.size() / (size(brickSize) * brickSize * brickSize); }
+};
+
+/**
+ * @brief 将索引三角形网格烘焙为稠密的有符号距离场。
+ *
+ * 不构建 BVH：每个砖块先求中心到网格的距离，据此得到砖块内距离的上界，只保留包围盒距离不超过上界的三角形作为候选，
+ * 体素再在候选中用包围盒距离剪枝求最近三角形。
+ * 符号由广义环绕数决定 (大于 0.5 为内部)，三角形按空间聚成簇，远处的簇用偶极子近似，因此对小的孔洞与自相交也是稳健的。
+ * 与表面不相交的砖块内环绕数不变，只在砖块中心计算一次。各砖块在全局执行器上并行处理。
+ */
+NOVA_API SdfGrid BakeSdf(std::span<const u32> indices, std::span<const float3> positions, const SdfOptions& options = {});
+
+/// 将索引三角形网格烘焙为稀疏的有符号距离场，远离表面的砖块不分配存储
+NOVA_API SparseSdf BakeSparseSdf(std::span<const u32> indices,
+                                 std::span<const float3> positions,
+                                 const SdfOptions& options = {});
+
+} // namespace nova
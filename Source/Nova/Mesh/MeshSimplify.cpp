@@ -0,0 +1,539 @@
+/**
+ * @File MeshSimplify.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include "./MeshSimplify.hpp"
+#include "./MeshAdjacency.hpp"
+#include "./MeshWeld.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include "../Math/Matrix.hpp"
+#include "../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+namespace {
+
+// -------------------------
+// Garland & Heckbert, Surface Simplification Using Quadric Error Metrics
+// Hoppe, New Quadric Metric for Simplifying Meshes with Appearance Attributes
+// -------------------------
+
+using Vec3 = vec3_t<f64>;
+using Vec4 = vec4_t<f64>;
+using Mat3 = mat3x3_t<f64>;
+using Mat4 = mat4x4_t<f64>;
+
+constexpr f64 kBorderWeight = 10.0;
+
+/// 折叠后三角形法线与原法线夹角的余弦下限，用于拒绝翻转的三角形
+constexpr f64 kFlipThreshold = 1e-2;
+
+enum class VertexKind : u8
+{
+    Manifold, ///< 内部顶点，可以折叠到任意相邻顶点
+    Border,   ///< 边界顶点，只能沿边界边折叠到其它边界顶点
+    Locked,   ///< 不可移除
+};
+
+struct Quadric
+{
+    Mat4 m{0};
+    f64 weight = 0;
+
+    void add(const Quadric& q)
+    {
+        m      += q.m;
+        weight += q.weight;
+    }
+
+    void addPlane(const Vec3& n, f64 d, f64 w)
+    {
+        const Vec4 plane(n, d);
+        m      += OuterProduct(plane, plane) * w;
+        weight += w;
+    }
+};
+
+NOVA_FUNC Vec3 ToVec3(const float3& p) { return Vec3(p.x, p.y, p.z); }
+
+struct Simplifier
+{
+    const MeshView& mesh;
+    const SimplifyOptions& options;
+
+    size vertexCount    = 0;
+    u32 attributeCount  = 0;
+    std::vector<f64> weights;
+
+    std::vector<u32> weld;
+    size groupCount = 0;
+    std::vector<VertexKind> kinds;
+
+    /// 当前索引按 weld 映射后的结果及其邻接表，接缝两侧的三角形在其中共享顶点
+    std::vector<u32> welded;
+    internal::TriangleAdjacency weldedAdjacency;
+
+    std::vector<Quadric> quadrics;
+    std::vector<Quadric> attrQuadrics;
+    std::vector<Vec4> attrGradients; ///< 每个顶点 attributeCount 个
+
+    Simplifier(const MeshView& m, const SimplifyOptions& opts) : mesh(m), options(opts)
+    {
+        vertexCount    = mesh.positions.size();
+        attributeCount = mesh.attributeCount;
+
+        NOVA_CHECK(mesh.indices.size() % 3 == 0);
+        NOVA_CHECK(mesh.attributes.size() >= vertexCount * attributeCount);
+        NOVA_CHECK(options.attributeWeights.empty() || options.attributeWeights.size() >= attributeCount);
+
+        weights.resize(attributeCount, 1.0);
+        for (u32 c = 0; c < attributeCount && !options.attributeWeights.empty(); ++c)
+            weights[c] = options.attributeWeights[c];
+    }
+
+    f64 attribute(u32 v, u32 c) const { return f64(mesh.attributes[v * attributeCount + c]) * weights[c]; }
+
+    /// 由当前的索引重建 welded 与 weldedAdjacency
+    void updateWelded(std::span<const u32> indices)
+    {
+        welded.resize(indices.size());
+        for (size i = 0; i < indices.size(); ++i)
+            welded[i] = weld[indices[i]];
+
+        weldedAdjacency.build(welded, groupCount);
+    }
+
+    /// 按位置合并顶点后统计边的使用次数，以区分内部、边界、接缝与非流形顶点
+    void classifyVertices()
+    {
+        const auto indices = mesh.indices;
+
+        weld.resize(vertexCount);
+        groupCount = WeldVertices(weld, mesh.positions.data(), vertexCount, sizeof(float3));
+        updateWelded(indices);
+
+        std::vector<u8> referenced(vertexCount, 0);
+        std::vector<u32> groupSize(groupCount, 0);
+        for (const auto idx : indices) {
+            if (!referenced[idx]) {
+                referenced[idx] = 1;
+                groupSize[weld[idx]]++;
+            }
+        }
+
+        std::vector<u8> border(groupCount, 0), locked(groupCount, 0);
+        for (size t = 0; t < welded.size() / 3; ++t) {
+            for (u32 k = 0; k < 3; ++k) {
+                const auto a = welded[t * 3 + k];
+                const auto b = welded[t * 3 + (k + 1) % 3];
+
+                u32 count = 0;
+                for (const auto other : weldedAdjacency[a]) {
+                    count += welded[other * 3 + 0] == b || welded[other * 3 + 1] == b || welded[other * 3 + 2] == b;
+                }
+
+                if (count == 1)
+                    border[a] = border[b] = 1;
+                else if (count > 2)
+                    locked[a] = locked[b] = 1;
+            }
+        }
+
+        kinds.resize(vertexCount);
+        for (size v = 0; v < vertexCount; ++v) {
+            const auto g = weld[v];
+            if (groupSize[g] > 1 || locked[g])
+                kinds[v] = VertexKind::Locked;
+            else if (border[g])
+                kinds[v] = options.lockBorder ? VertexKind::Locked : VertexKind::Border;
+            else
+                kinds[v] = VertexKind::Manifold;
+        }
+    }
+
+    void computeQuadrics(std::span<const u32> indices)
+    {
+        quadrics.assign(vertexCount, {});
+        attrQuadrics.assign(attributeCount > 0 ? vertexCount : 0, {});
+        attrGradients.assign(vertexCount * attributeCount, Vec4(0));
+
+        for (size t = 0; t < indices.size() / 3; ++t) {
+            const u32 v[3] = {indices[t * 3 + 0], indices[t * 3 + 1], indices[t * 3 + 2]};
+            const Vec3 p[3] = {ToVec3(mesh.positions[v[0]]), ToVec3(mesh.positions[v[1]]), ToVec3(mesh.positions[v[2]])};
+
+            const auto e1  = p[1] - p[0];
+            const auto e2  = p[2] - p[0];
+            const auto n   = Cross(e1, e2);
+            const auto len = Length(n);
+            if (len == 0)
+                continue;
+
+            const auto normal = n / len;
+            const auto area   = len * 0.5;
+
+            Quadric q;
+            q.addPlane(normal, -Dot(normal, p[0]), area);
+            for (const auto vi : v)
+                quadrics[vi].add(q);
+
+            // 边界边：附加一个经过该边且垂直于三角形的平面
+            for (u32 k = 0; k < 3; ++k) {
+                const auto a = v[k];
+                const auto b = v[(k + 1) % 3];
+                if (!isBorderEdge(a, b))
+                    continue;
+
+                const auto edge    = p[(k + 1) % 3] - p[k];
+                const auto edgeLen = Length(edge);
+                if (edgeLen == 0)
+                    continue;
+
+                const auto planeN = Normalize(Cross(edge / edgeLen, normal));
+
+                Quadric bq;
+                bq.addPlane(planeN, -Dot(planeN, p[k]), edgeLen * edgeLen * kBorderWeight);
+                quadrics[a].add(bq);
+                quadrics[b].add(bq);
+            }
+
+            if (attributeCount == 0)
+                continue;
+
+            // 属性在三角形上的线性插值 s(p) = g·p + d，梯度 g 由 [e1; e2; n] g = [s1 - s0, s2 - s0, 0] 求得
+            const auto basis = Transpose(Mat3(e1, e2, n));
+            const auto det   = Determinant(basis);
+            if (Abs(det) < 1e-30)
+                continue;
+
+            const auto inv = Inverse(basis);
+
+            Quadric aq;
+            aq.weight = area;
+
+            for (u32 c = 0; c < attributeCount; ++c) {
+                const f64 s0 = attribute(v[0], c);
+                const f64 s1 = attribute(v[1], c);
+                const f64 s2 = attribute(v[2], c);
+
+                const auto g = inv * Vec3(s1 - s0, s2 - s0, 0);
+                const Vec4 a(g, s0 - Dot(g, p[0]));
+
+                aq.m += OuterProduct(a, a) * area;
+                for (const auto vi : v)
+                    attrGradients[vi * attributeCount + c] += a * area;
+            }
+
+            for (const auto vi : v)
+                attrQuadrics[vi].add(aq);
+        }
+    }
+
+    /**
+     * @brief 边 (a, b) 是否只被一个三角形使用。
+     *
+     * 在合并后的索引与邻接表上统计，接缝两侧的三角形都会被计入，所以接缝上的边以及接缝端点处的边不会被当作边界。
+     */
+    bool isBorderEdge(u32 a, u32 b) const
+    {
+        const auto wb = weld[b];
+
+        u32 count = 0;
+        for (const auto t : weldedAdjacency[weld[a]]) {
+            count += welded[t * 3 + 0] == wb || welded[t * 3 + 1] == wb || welded[t * 3 + 2] == wb;
+        }
+        return count == 1;
+    }
+
+    /// 将 from 折叠到 to 的代价，不合法时返回无穷大
+    f64 collapseCost(u32 from, u32 to) const
+    {
+        const auto kind = kinds[from];
+        if (kind == VertexKind::Locked)
+            return kInfinity;
+
+        if (kind == VertexKind::Border && (kinds[to] == VertexKind::Manifold || !isBorderEdge(from, to)))
+            return kInfinity;
+
+        const Vec4 p(ToVec3(mesh.positions[to]), 1);
+
+        Quadric q = quadrics[from];
+        q.add(quadrics[to]);
+
+        auto cost = q.weight > 0 ? Max(Dot(p, q.m * p), 0.0) / q.weight : 0.0;
+
+        if (attributeCount > 0) {
+            Quadric aq = attrQuadrics[from];
+            aq.add(attrQuadrics[to]);
+
+            if (aq.weight > 0) {
+                auto err = Dot(p, aq.m * p);
+                for (u32 c = 0; c < attributeCount; ++c) {
+                    const auto s  = attribute(to, c);
+                    const auto g  = attrGradients[from * attributeCount + c] + attrGradients[to * attributeCount + c];
+                    err          += s * s * aq.weight - 2 * s * Dot(g, p);
+                }
+                cost += Max(err, 0.0) / aq.weight;
+            }
+        }
+
+        return cost;
+    }
+
+    void mergeQuadrics(u32 from, u32 to)
+    {
+        quadrics[to].add(quadrics[from]);
+
+        if (attributeCount > 0) {
+            attrQuadrics[to].add(attrQuadrics[from]);
+            for (u32 c = 0; c < attributeCount; ++c)
+                attrGradients[to * attributeCount + c] += attrGradients[from * attributeCount + c];
+        }
+    }
+
+    /// 折叠后与 from 相邻的三角形是否翻转或退化
+    bool flipsTriangle(std::span<const u32> indices,
+                       const internal::TriangleAdjacency& adjacency,
+                       std::span<const u32> remap,
+                       u32 from,
+                       u32 to,
+                       u32& removed) const
+    {
+        removed = 0;
+
+        const auto pt = ToVec3(mesh.positions[to]);
+
+        for (const auto t : adjacency[from]) {
+            const u32 v[3] = {remap[indices[t * 3 + 0]], remap[indices[t * 3 + 1]], remap[indices[t * 3 + 2]]};
+
+            // 已在本轮中被其它折叠移除
+            if (v[0] == v[1] || v[1] == v[2] || v[0] == v[2])
+                continue;
+
+            if (v[0] == to || v[1] == to || v[2] == to) {
+                removed++;
+                continue;
+            }
+
+            const auto k  = v[0] == from ? 0 : (v[1] == from ? 1 : 2);
+            const auto p1 = ToVec3(mesh.positions[v[(k + 1) % 3]]);
+            const auto p2 = ToVec3(mesh.positions[v[(k + 2) % 3]]);
+            const auto p0 = ToVec3(mesh.positions[from]);
+
+            const auto n0 = Cross(p1 - p0, p2 - p0);
+            const auto n1 = Cross(p1 - pt, p2 - pt);
+
+            if (Dot(n0, n1) <= kFlipThreshold * Length(n0) * Length(n1))
+                return true;
+        }
+
+        return false;
+    }
+
+    size run(std::span<u32> dst, f32* resultError)
+    {
+        std::vector<u32> current(mesh.indices.begin(), mesh.indices.end());
+
+        f32 maxExtent = 0;
+        if (vertexCount > 0) {
+            float3 pMin = mesh.positions[0], pMax = mesh.positions[0];
+            for (const auto& p : mesh.positions) {
+                pMin = Min(pMin, p);
+                pMax = Max(pMax, p);
+            }
+            maxExtent = MaxValue(pMax - pMin);
+        }
+
+        const auto scale      = maxExtent > 0 ? f64(maxExtent) : 1.0;
+        const auto errorLimit = Sqr(f64(options.targetError) * scale);
+        const auto targetTris = options.targetIndexCount / 3;
+
+        classifyVertices();
+
+        internal::TriangleAdjacency adjacency;
+        adjacency.build(current, vertexCount);
+        computeQuadrics(current);
+
+        struct Collapse
+        {
+            u32 from;
+            u32 to;
+            f64 cost;
+        };
+
+        std::vector<u64> edges;
+        std::vector<Collapse> collapses;
+        std::vector<u32> remap(vertexCount);
+        std::vector<u8> touched(vertexCount);
+
+        f64 maxCost   = 0;
+        auto triCount = current.size() / 3;
+
+        while (triCount > targetTris) {
+            // 收集无向边
+            edges.clear();
+            for (size t = 0; t < triCount; ++t) {
+                for (u32 k = 0; k < 3; ++k) {
+                    const auto a = current[t * 3 + k];
+                    const auto b = current[t * 3 + (k + 1) % 3];
+                    edges.push_back(u64(Min(a, b)) << 32 | Max(a, b));
+                }
+            }
+            std::sort(edges.begin(), edges.end());
+            edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+            // 并行计算每条边两个方向的折叠代价，保留代价较小的方向
+            collapses.resize(edges.size());
+            ParallelFor(0, edges.size(), 4096, [&](size first, size last) {
+                for (auto i = first; i < last; ++i) {
+                    const auto a  = u32(edges[i] >> 32);
+                    const auto b  = u32(edges[i]);
+                    const auto ab = collapseCost(a, b);
+                    const auto ba = collapseCost(b, a);
+                    collapses[i]  = ab <= ba ? Collapse{a, b, ab} : Collapse{b, a, ba};
+                }
+            });
+
+            std::erase_if(collapses, [&](const Collapse& c) { return !(c.cost <= errorLimit); });
+            if (collapses.empty())
+                break;
+
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+                return a.cost < b.cost || (a.cost == b.cost && a.from < b.from);
+            });
+
+            // 每条边的折叠大约移除两个三角形；只接受代价不超过本轮中位目标 1.5 倍的折叠，避免一次折叠过多高代价的边
+            const auto goal      = (triCount - targetTris) / 2 + 1;
+            const auto passLimit = collapses[Min(goal / 2, collapses.size() - 1)].cost * 1.5;
+
+            std::iota(remap.begin(), remap.end(), 0u);
+            std::fill(touched.begin(), touched.end(), 0);
+
+            size collapsed = 0;
+            for (const auto& c : collapses) {
+                if (triCount <= targetTris || c.cost > passLimit)
+                    break;
+
+                // 同一轮中每个顶点只参与一次折叠，保证 remap 只有一层
+                if (touched[c.from] || touched[c.to])
+                    continue;
+
+                u32 removed = 0;
+                if (flipsTriangle(current, adjacency, remap, c.from, c.to, removed))
+                    continue;
+
+                remap[c.from]  = c.to;
+                touched[c.from] = touched[c.to] = 1;
+                mergeQuadrics(c.from, c.to);
+
+                triCount -= Min(size(removed), triCount);
+                maxCost   = Max(maxCost, c.cost);
+                collapsed++;
+            }
+
+            if (collapsed == 0)
+                break;
+
+            // 重写索引并移除退化的三角形
+            size written = 0;
+            for (size t = 0; t < current.size() / 3; ++t) {
+                const auto a = remap[current[t * 3 + 0]];
+                const auto b = remap[current[t * 3 + 1]];
+                const auto c = remap[current[t * 3 + 2]];
+                if (a == b || b == c || a == c)
+                    continue;
+
+                current[written++] = a;
+                current[written++] = b;
+                current[written++] = c;
+            }
+            current.resize(written);
+            triCount = written / 3;
+
+            adjacency.build(current, vertexCount);
+            updateWelded(current);
+        }
+
+        NOVA_CHECK(dst.size() >= current.size());
+        std::copy(current.begin(), current.end(), dst.begin());
+
+        if (resultError)
+            *resultError = f32(Sqrt(maxCost) / scale);
+
+        return current.size();
+    }
+};
+
+} // namespace
+
+size SimplifyMesh(std::span<u32> dst, const MeshView& mesh, const SimplifyOptions& options, f32* resultError)
+{
+    Simplifier simplifier(mesh, options);
+    return simplifier.run(dst, resultError);
+}
+
+std::vector<MeshLod> GenerateLodChain(const MeshView& mesh, const LodChainOptions& options)
+{
+    NOVA_CHECK(options.reduction > 0.f && options.reduction < 1.f);
+
+    std::vector<MeshLod> lods;
+    lods.push_back({{mesh.indices.begin(), mesh.indices.end()}, 0.f});
+
+    SimplifyOptions simplifyOptions;
+    simplifyOptions.lockBorder       = options.lockBorder;
+    simplifyOptions.attributeWeights = options.attributeWeights;
+
+    while (lods.size() < options.maxLevels) {
+        const auto& prev = lods.back();
+        if (prev.indices.size() <= options.minIndexCount || prev.error >= options.maxError)
+            break;
+
+        const auto target = size(f64(prev.indices.size() / 3) * options.reduction) * 3;
+
+        simplifyOptions.targetIndexCount = Max(target, options.minIndexCount);
+        simplifyOptions.targetError      = options.maxError - prev.error;
+
+        MeshView view     = mesh;
+        view.indices      = prev.indices;
+
+        MeshLod lod;
+        lod.indices.resize(prev.indices.size());
+
+        f32 error = 0;
+        lod.indices.resize(SimplifyMesh(lod.indices, view, simplifyOptions, &error));
+        lod.error = prev.error + error;
+
+        // 简化几乎没有进展时，继续生成的层级没有意义
+        if (f64(lod.indices.size()) > f64(prev.indices.size()) * 0.95)
+            break;
+
+        lods.push_back(std::move(lod));
+    }
+
+    return lods;
+}
+
+std::vector<std::vector<MeshLod>> GenerateLodChains(std::span<const MeshView> meshes, const LodChainOptions& options)
+{
+    std::vector<std::vector<MeshLod>> result(meshes.size());
+
+    // 先调度大网格，减少最后阶段的负载不均
+    std::vector<u32> order(meshes.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](u32 a, u32 b) {
+        return meshes[a].indices.size() > meshes[b].indices.size();
+    });
+
+    ParallelForEach(0, order.size(), [&](size i) {
+        const auto m = order[i];
+        result[m]    = GenerateLodChain(meshes[m], options);
+    });
+
+    return result;
+}
+
+} // namespace nova
@@ -0,0 +1,77 @@
+/**
+ * @File MeshSimplify.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include "../Math/Vector.hpp"
+
+namespace nova {
+
+/// 索引网格的只读视图
+struct MeshView
+{
+    std::span<const u32> indices;
+    std::span<const float3> positions;
+    std::span<const f32> attributes; ///< 可选的顶点属性，每个顶点 attributeCount 个，连续存放
+    u32 attributeCount = 0;
+};
+
+struct SimplifyOptions
+{
+    size targetIndexCount = 0;       ///< 目标索引数量
+    f32 targetError       = 1e-2f;   ///< 允许的最大误差，相对于网格包围盒的最大边长
+    bool lockBorder       = false;   ///< 锁定网格边界上的顶点
+    std::span<const f32> attributeWeights; ///< 各属性的误差权重，为空时均为 1
+};
+
+/**
+ * @brief 基于二次误差度量 (QEM) 的边折叠简化。
+ *
+ * 每次折叠将一个顶点合并到相邻的顶点上，不生成新的顶点，因此简化结果可以继续使用原来的顶点缓冲区。
+ * 误差由三角形平面的二次误差与属性梯度的二次误差组成，边界边额外附加垂直平面以保持轮廓。
+ * 位于属性接缝 (位置相同的多个顶点) 和非流形边上的顶点总是被锁定。
+ *
+ * @param dst 输出的索引缓冲区，大小不小于 mesh.indices，可以与输入相同。
+ * @param resultError 可选，输出简化后的误差，单位与 targetError 相同。
+ * @return 简化后的索引数量。
+ */
+NOVA_API size SimplifyMesh(std::span<u32> dst,
+                           const MeshView& mesh,
+                           const SimplifyOptions& options,
+                           f32* resultError = nullptr);
+
+/// LOD 链中的一层
+struct MeshLod
+{
+    std::vector<u32> indices;
+    f32 error = 0; ///< 相对于原始网格的累计误差
+};
+
+struct LodChainOptions
+{
+    u32 maxLevels      = 8;     ///< 包括原始网格在内的最大层数
+    f32 reduction      = 0.5f;  ///< 相邻两层的三角形数量之比
+    size minIndexCount = 3 * 64; ///< 低于该索引数量时不再继续简化
+    f32 maxError       = 5e-2f; ///< 最后一层允许的累计误差
+    bool lockBorder    = false;
+    std::span<const f32> attributeWeights;
+};
+
+/**
+ * @brief 为网格生成 LOD 链，第 0 层为原始网格。
+ *
+ * 每一层都从上一层继续简化；当简化无法继续推进或误差达到上限时提前结束。
+ */
+NOVA_API std::vector<MeshLod> GenerateLodChain(const MeshView& mesh, const LodChainOptions& options = {});
+
+/// 在全局执行器上并行地为多个网格生成 LOD 链，按网格大小从大到小调度
+NOVA_API std::vector<std::vector<MeshLod>> GenerateLodChains(std::span<const MeshView> meshes,
+                                                             const LodChainOptions& options = {});
+
+} // namespace nova
@@ -0,0 +1,169 @@
+/**
+ * @File MeshWeld.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include "./MeshWeld.hpp"
+#include "./MeshOptimizer.hpp"
+
+#include "../Math/Hash.hpp"
+#include "../Math/TypeHash.hpp"
+#include "../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+namespace {
+
+constexpr size kHashGrainSize = 16'384;
+
+/**
+ * 并行查重的核心流程：
+ *   1. 并行计算每个顶点的哈希值；
+ *   2. 按哈希值的高位将顶点稳定地分到若干分片中；
+ *   3. 各分片独立地使用开放寻址表查找与之相同的、编号最小的顶点；
+ *   4. 按顶点顺序为每组相同的顶点分配紧凑的编号。
+ * 每个分片内部按顶点编号顺序处理，因此结果与线程数无关。
+ */
+template<typename HashFunc, typename EqualFunc>
+size WeldImpl(std::span<u32> remap, size vertexCount, HashFunc&& hashOf, EqualFunc&& equal)
+{
+    NOVA_CHECK(remap.size() >= vertexCount);
+
+    if (vertexCount == 0)
+        return 0;
+
+    std::vector<u64> hashes(vertexCount);
+    ParallelFor(0, vertexCount, kHashGrainSize, [&](size first, size last) {
+        for (auto i = first; i < last; ++i)
+            hashes[i] = hashOf(i);
+    });
+
+    u32 shardBits = 0;
+    while (shardBits < 8 && (vertexCount >> (shardBits + 13)) > 0)
+        ++shardBits;
+
+    const auto shardCount = size(1) << shardBits;
+    const auto shardOf    = [&](u64 h) { return shardBits == 0 ? size(0) : size(h >> (64 - shardBits)); };
+
+    std::vector<u32> shardOffsets(shardCount + 1, 0);
+    for (const auto h : hashes)
+        shardOffsets[shardOf(h) + 1]++;
+    for (size s = 0; s < shardCount; ++s)
+        shardOffsets[s + 1] += shardOffsets[s];
+
+    std::vector<u32> order(vertexCount);
+    {
+        std::vector<u32> cursor(shardOffsets.begin(), shardOffsets.end() - 1);
+        for (size i = 0; i < vertexCount; ++i)
+            order[cursor[shardOf(hashes[i])]++] = cast_to<u32>(i);
+    }
+
+    std::vector<u32> canonical(vertexCount);
+    ParallelFor(0, shardCount, 1, [&](size first, size last) {
+        std::vector<u32> table;
+
+        for (auto s = first; s < last; ++s) {
+            const auto begin = shardOffsets[s];
+            const auto end   = shardOffsets[s + 1];
+            if (begin == end)
+                continue;
+
+            const auto capacity = RoundUpPow2(u64(end - begin) * 2);
+            const auto mask     = capacity - 1;
+            table.assign(capacity, ~0u);
+
+            for (auto k = begin; k < end; ++k) {
+                const auto v = order[k];
+                const auto h = hashes[v];
+
+                auto slot = h & mask;
+                while (table[slot] != ~0u) {
+                    const auto other = table[slot];
+                    if (hashes[other] == h && equal(other, v))
+                        break;
+                    slot = (slot + 1) & mask;
+                }
+
+                if (table[slot] == ~0u)
+                    table[slot] = v;
+
+                canonical[v] = table[slot];
+            }
+        }
+    });
+
+    u32 next = 0;
+    for (size i = 0; i < vertexCount; ++i)
+        remap[i] = canonical[i] == i ? next++ : remap[canonical[i]];
+
+    return next;
+}
+
+/// 在 f64 中量化并钳制到 ±2^62，坐标很大或 epsilon 很小时转换为整数也不会溢出
+i64 QuantizeCoord(f32 x, f64 invEpsilon)
+{
+    constexpr f64 kLimit = 0x1p62;
+
+    const auto q = Floor(f64(x) * invEpsilon + 0.5);
+    if (q >= -kLimit && q <= kLimit)
+        return i64(q);
+    return q > 0 ? i64(kLimit) : -i64(kLimit);
+}
+
+} // namespace
+
+size WeldVertices(std::span<u32> remap, const void* vertices, size vertexCount, size vertexSize)
+{
+    const auto* data = static_cast<const u8*>(vertices);
+
+    return WeldImpl(
+        remap,
+        vertexCount,
+        [&](size i) { return wyHash(data + i * vertexSize, vertexSize); },
+        [&](size a, size b) { return Memcmp(data + a * vertexSize, data + b * vertexSize, vertexSize) == 0; });
+}
+
+size WeldVertices(std::span<u32> remap, std::span<const float3> positions, f32 epsilon)
+{
+    NOVA_CHECK_GT(epsilon, 0.f);
+
+    const auto invEpsilon = 1.0 / f64(epsilon);
+
+    std::vector<vec3_t<i64>> keys(positions.size());
+    ParallelFor(0, positions.size(), kHashGrainSize, [&](size first, size last) {
+        for (auto i = first; i < last; ++i) {
+            const auto& p = positions[i];
+            keys[i]       = {QuantizeCoord(p.x, invEpsilon), QuantizeCoord(p.y, invEpsilon), QuantizeCoord(p.z, invEpsilon)};
+        }
+    });
+
+    return WeldImpl(
+        remap,
+        positions.size(),
+        [&](size i) { return Hash(keys[i]); },
+        [&](size a, size b) { return all_eq(keys[a], keys[b]); });
+}
+
+size WeldMesh(std::vector<float3>& positions, std::vector<u32>& indices, f32 epsilon)
+{
+    std::vector<u32> remap(positions.size());
+
+    const auto uniqueCount = epsilon > 0.f ? WeldVertices(remap, positions, epsilon)
+                                           : WeldVertices(remap, positions.data(), positions.size(), sizeof(float3));
+
+    RemapIndexBuffer(indices, indices, remap);
+
+    // 编号按首次出现的顺序分配，且 remap[i] <= i，因此可以就地压缩
+    u32 written = 0;
+    for (size i = 0; i < positions.size(); ++i) {
+        if (remap[i] == written)
+            positions[written++] = positions[i];
+    }
+    positions.resize(uniqueCount);
+
+    return uniqueCount;
+}
+
+} // namespace nova
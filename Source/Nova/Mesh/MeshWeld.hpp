@@ -0,0 +1,45 @@
+/**
+ * @File MeshWeld.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include "../Math/Vector.hpp"
+
+namespace nova {
+
+/**
+ * @brief 合并逐字节完全相同的顶点，生成重映射表。
+ *
+ * 每个顶点被映射到与之相同的顶点中第一个出现的那个，编号按首次出现的顺序紧凑排列，
+ * 因此可以直接配合 RemapIndexBuffer / RemapVertexBuffer 使用。结果与线程数无关。
+ *
+ * @param remap 输出的重映射表，大小需为 vertexCount。
+ * @return 合并后的顶点数量。
+ */
+NOVA_API size WeldVertices(std::span<u32> remap, const void* vertices, size vertexCount, size vertexSize);
+
+/**
+ * @brief 合并位置在 epsilon 范围内的顶点，生成重映射表。
+ *
+ * 顶点位置被量化到边长为 epsilon 的网格上，落在同一网格单元中的顶点会被合并。
+ *
+ * @param remap 输出的重映射表，大小需与 positions 相同。
+ * @return 合并后的顶点数量。
+ */
+NOVA_API size WeldVertices(std::span<u32> remap, std::span<const float3> positions, f32 epsilon);
+
+/**
+ * @brief 对索引网格执行顶点合并，并就地压缩顶点缓冲区、重写索引缓冲区。
+ *
+ * @param epsilon 为 0 时仅合并完全相同的顶点。
+ * @return 合并后的顶点数量。
+ */
+NOVA_API size WeldMesh(std::vector<float3>& positions, std::vector<u32>& indices, f32 epsilon = 0.f);
+
+} // namespace nova
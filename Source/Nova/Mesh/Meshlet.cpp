@@ -0,0 +1,293 @@
+/**
+ * @File Meshlet.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include "./Meshlet.hpp"
+#include "./MeshAdjacency.hpp"
+
+#include <array>
+#include "../Utils/TaskFlow.hpp"
+
+namespace nova {
+
+namespace {
+
+constexpr u32 kInvalid             = ~0u;
+constexpr u32 kMaxMeshletVertices  = 256;
+constexpr u32 kMaxMeshletTriangles = 512;
+
+/// 法线锥的最小余弦值，低于该值时认为法线分布过宽，放弃剔除
+constexpr f32 kMinConeCosine = 0.1f;
+
+/// Ritter 近似最小包围球
+void ComputeBoundingSphere(const u32* verts, u32 count, std::span<const float3> positions, float3& center, f32& radius)
+{
+    // 在三个坐标轴上分别找到最小、最大的顶点，取距离最远的一对作为初始直径
+    std::array<u32, 3> minIdx{}, maxIdx{};
+    for (u32 i = 1; i < count; ++i) {
+        const auto& p = positions[verts[i]];
+        for (i32 axis = 0; axis < 3; ++axis) {
+            if (p[axis] < positions[verts[minIdx[axis]]][axis])
+                minIdx[axis] = i;
+            if (p[axis] > positions[verts[maxIdx[axis]]][axis])
+                maxIdx[axis] = i;
+        }
+    }
+
+    i32 bestAxis = 0;
+    f32 bestDist = -1.f;
+    for (i32 axis = 0; axis < 3; ++axis) {
+        const auto d = LengthSqr(positions[verts[maxIdx[axis]]] - positions[verts[minIdx[axis]]]);
+        if (d > bestDist) {
+            bestDist = d;
+            bestAxis = axis;
+        }
+    }
+
+    const auto& p0 = positions[verts[minIdx[bestAxis]]];
+    const auto& p1 = positions[verts[maxIdx[bestAxis]]];
+
+    center = (p0 + p1) * 0.5f;
+    radius = Sqrt(bestDist) * 0.5f;
+
+    // 逐个扩张球体以包含所有顶点
+    for (u32 i = 0; i < count; ++i) {
+        const auto& p = positions[verts[i]];
+        const auto d2 = LengthSqr(p - center);
+        if (d2 > radius * radius) {
+            const auto d         = Sqrt(d2);
+            const auto newRadius = (radius + d) * 0.5f;
+            center              += (p - center) * ((newRadius - radius) / d);
+            radius               = newRadius;
+        }
+    }
+}
+
+} // namespace
+
+MeshletData BuildMeshlets(std::span<const u32> indices,
+                          std::span<const float3> positions,
+                          u32 maxVertices,
+                          u32 maxTriangles)
+{
+    NOVA_CHECK(indices.size() % 3 == 0);
+    NOVA_CHECK(maxVertices >= 3 && maxVertices <= kMaxMeshletVertices);
+    NOVA_CHECK(maxTriangles >= 1 && maxTriangles <= kMaxMeshletTriangles);
+
+    MeshletData data;
+
+    const auto faceCount   = indices.size() / 3;
+    const auto vertexCount = positions.size();
+    if (faceCount == 0)
+        return data;
+
+    internal::TriangleAdjacency adjacency;
+    adjacency.build(indices, vertexCount);
+
+    std::vector<float3> centroids(faceCount);
+    ParallelFor(0, faceCount, 16'384, [&](size first, size last) {
+        for (auto t = first; t < last; ++t) {
+            const auto& a = positions[indices[t * 3 + 0]];
+            const auto& b = positions[indices[t * 3 + 1]];
+            const auto& c = positions[indices[t * 3 + 2]];
+            centroids[t]  = (a + b + c) * (1.f / 3.f);
+        }
+    });
+
+    data.meshlets.reserve(faceCount / maxTriangles + 1);
+    data.vertices.reserve(indices.size() / 2);
+    data.triangles.reserve(indices.size());
+
+    std::vector<u8> used(faceCount, 0);
+    std::vector<u32> liveTris = adjacency.counts; // 各顶点尚未分配的三角形数量
+    std::vector<u32> localIndex(vertexCount, kInvalid);
+
+    Meshlet meshlet;
+    float3 centroidSum{0};
+
+    const auto newVertexCount = [&](u32 t) {
+        u32 count = 0;
+        for (u32 k = 0; k < 3; ++k)
+            count += localIndex[indices[t * 3 + k]] == kInvalid;
+        return count;
+    };
+
+    // 在当前簇顶点的邻接三角形中，选取引入新顶点最少、离簇中心最近的三角形；
+    // 距离按三个顶点剩余的三角形数量加权，优先吸收边界处的三角形，减少残留的碎片
+    const auto findCandidate = [&](bool limitVertices) {
+        const auto center = centroidSum / f32(meshlet.triangleCount);
+
+        auto best      = kInvalid;
+        auto bestExtra = kInvalid;
+        auto bestDist  = kInfinity;
+
+        for (u32 i = 0; i < meshlet.vertexCount; ++i) {
+            const auto v = data.vertices[meshlet.vertexOffset + i];
+            if (liveTris[v] == 0)
+                continue;
+
+            for (const auto t : adjacency[v]) {
+                if (used[t])
+                    continue;
+
+                const auto extra = newVertexCount(t);
+                if (limitVertices && meshlet.vertexCount + extra > maxVertices)
+                    continue;
+
+                u32 live = 0;
+                for (u32 k = 0; k < 3; ++k)
+                    live += liveTris[indices[t * 3 + k]];
+                const auto dist = LengthSqr(centroids[t] - center) * (1.f + f32(live));
+                if (extra < bestExtra || (extra == bestExtra && dist < bestDist)) {
+                    best      = t;
+                    bestExtra = extra;
+                    bestDist  = dist;
+                }
+            }
+        }
+
+        return best;
+    };
+
+    const auto addTriangle = [&](u32 t) {
+        for (u32 k = 0; k < 3; ++k) {
+            const auto v = indices[t * 3 + k];
+            if (localIndex[v] == kInvalid) {
+                localIndex[v] = meshlet.vertexCount++;
+                data.vertices.push_back(v);
+            }
+            data.triangles.push_back(cast_to<u8>(localIndex[v]));
+            liveTris[v]--;
+        }
+
+        used[t]      = 1;
+        centroidSum += centroids[t];
+        meshlet.triangleCount++;
+    };
+
+    const auto flush = [&]() {
+        for (u32 i = 0; i < meshlet.vertexCount; ++i)
+            localIndex[data.vertices[meshlet.vertexOffset + i]] = kInvalid;
+
+        data.meshlets.push_back(meshlet);
+
+        meshlet                = {};
+        meshlet.vertexOffset   = cast_to<u32>(data.vertices.size());
+        meshlet.triangleOffset = cast_to<u32>(data.triangles.size());
+        centroidSum            = float3{0};
+    };
+
+    size scanCursor = 0;
+    for (size emitted = 0; emitted < faceCount; ++emitted) {
+        auto t = kInvalid;
+
+        if (meshlet.triangleCount > 0) {
+            if (meshlet.triangleCount < maxTriangles)
+                t = findCandidate(true);
+
+            // 当前簇无法继续扩展：从它的邻接三角形中为下一个簇选取种子
+            if (t == kInvalid) {
+                t = findCandidate(false);
+                flush();
+            }
+        }
+
+        // 与已有的簇都不相邻时，按输入顺序选取下一个未分配的三角形
+        if (t == kInvalid) {
+            while (used[scanCursor])
+                ++scanCursor;
+            t = cast_to<u32>(scanCursor);
+        }
+
+        addTriangle(t);
+    }
+
+    if (meshlet.triangleCount > 0)
+        flush();
+
+    return data;
+}
+
+MeshletBounds ComputeMeshletBounds(const MeshletData& data, const Meshlet& meshlet, std::span<const float3> positions)
+{
+    NOVA_CHECK(meshlet.triangleCount <= kMaxMeshletTriangles);
+
+    MeshletBounds result;
+    if (meshlet.vertexCount == 0)
+        return result;
+
+    const auto* verts = data.vertices.data() + meshlet.vertexOffset;
+    const auto* tris  = data.triangles.data() + meshlet.triangleOffset;
+
+    result.box = aabb(positions[verts[0]]);
+    for (u32 i = 1; i < meshlet.vertexCount; ++i)
+        result.box.include(positions[verts[i]]);
+
+    ComputeBoundingSphere(verts, meshlet.vertexCount, positions, result.center, result.radius);
+
+    result.coneApex = result.center;
+
+    // 法线锥：轴取面积非零的三角形法线的平均方向，半角由与轴夹角最大的法线决定
+    std::array<float3, kMaxMeshletTriangles> normals;
+    std::array<float3, kMaxMeshletTriangles> corners;
+    u32 normalCount = 0;
+    float3 normalSum{0};
+
+    for (u32 i = 0; i < meshlet.triangleCount; ++i) {
+        const auto& a = positions[verts[tris[i * 3 + 0]]];
+        const auto& b = positions[verts[tris[i * 3 + 1]]];
+        const auto& c = positions[verts[tris[i * 3 + 2]]];
+
+        const auto n   = Cross(b - a, c - a);
+        const auto len = Length(n);
+        if (len == 0)
+            continue;
+
+        normals[normalCount] = n / len;
+        corners[normalCount] = a;
+        normalSum           += normals[normalCount];
+        normalCount++;
+    }
+
+    const auto sumLength = Length(normalSum);
+    if (normalCount == 0 || sumLength == 0)
+        return result;
+
+    const auto axis = normalSum / sumLength;
+
+    f32 minDot = 1.f;
+    for (u32 i = 0; i < normalCount; ++i)
+        minDot = Min(minDot, Dot(normals[i], axis));
+
+    result.coneAxis = axis;
+    if (minDot <= kMinConeCosine)
+        return result;
+
+    // 将锥顶沿轴线后移，直到位于所有三角形平面的背面
+    f32 maxT = 0.f;
+    for (u32 i = 0; i < normalCount; ++i) {
+        const auto t = Dot(result.center - corners[i], normals[i]) / Dot(axis, normals[i]);
+        maxT         = Max(maxT, t);
+    }
+
+    result.coneApex   = result.center - axis * maxT;
+    result.coneCutoff = Sqrt(1.f - minDot * minDot);
+
+    return result;
+}
+
+std::vector<MeshletBounds> ComputeMeshletBounds(const MeshletData& data, std::span<const float3> positions)
+{
+    std::vector<MeshletBounds> result(data.meshlets.size());
+    ParallelFor(0, data.meshlets.size(), 64, [&](size first, size last) {
+        for (auto i = first; i < last; ++i)
+            result[i] = ComputeMeshletBounds(data, data.meshlets[i], positions);
+    });
+
+    return result;
+}
+
+} // namespace nova
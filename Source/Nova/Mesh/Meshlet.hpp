@@ -0,0 +1,80 @@
+/**
+ * @File Meshlet.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include "../Math/Vector.hpp"
+#include "../Math/Geometry/Bounds.hpp"
+
+namespace nova {
+
+/// 单个网格簇 (meshlet) 在 MeshletData 中的位置
+struct Meshlet
+{
+    u32 vertexOffset   = 0; ///< 在 MeshletData::vertices 中的起始位置
+    u32 triangleOffset = 0; ///< 在 MeshletData::triangles 中的起始位置，每个三角形占 3 个字节
+    u32 vertexCount    = 0;
+    u32 triangleCount  = 0;
+};
+
+struct MeshletData
+{
+    std::vector<Meshlet> meshlets;
+    std::vector<u32> vertices; ///< 局部顶点编号到全局顶点编号的映射
+    std::vector<u8> triangles; ///< 以局部顶点编号表示的三角形
+};
+
+/**
+ * @brief 网格簇的包围体与法线锥。
+ *
+ * 法线锥用于背面剔除：当 Dot(Normalize(coneApex - cameraPos), coneAxis) >= coneCutoff 时，
+ * 簇中所有三角形都背对相机。法线分布过宽时 coneCutoff 为 1，此时簇不会被剔除。
+ */
+struct MeshletBounds
+{
+    aabb box;
+    float3 center{0};
+    f32 radius = 0;
+    float3 coneApex{0};
+    float3 coneAxis{0};
+    f32 coneCutoff = 1; ///< 法线锥半角的正弦值
+};
+
+/**
+ * @brief 将索引三角形网格切分为网格簇。
+ *
+ * 每个簇最多包含 maxVertices 个顶点、maxTriangles 个三角形。簇从种子三角形出发，
+ * 优先吸收引入新顶点最少、且离簇中心最近的相邻三角形；簇填满后，下一个簇的种子优先从
+ * 当前簇的邻接三角形中选取，使相邻的簇在空间上也保持连续。
+ *
+ * @param maxVertices 不超过 256，以便使用 8 位局部编号。
+ * @param maxTriangles 不超过 512。
+ */
+NOVA_API MeshletData BuildMeshlets(std::span<const u32> indices,
+                                   std::span<const float3> positions,
+                                   u32 maxVertices  = 64,
+                                   u32 maxTriangles = 124);
+
+/// 计算单个网格簇的包围盒、包围球和法线锥
+NOVA_API MeshletBounds ComputeMeshletBounds(const MeshletData& data,
+                                            const Meshlet& meshlet,
+                                            std::span<const float3> positions);
+
+/// 并行计算所有网格簇的包围体
+NOVA_API std::vector<MeshletBounds> ComputeMeshletBounds(const MeshletData& data, std::span<const float3> positions);
+
+/// 判断网格簇是否整体背对位于 cameraPos 的相机
+NOVA_FUNC bool IsMeshletBackfacing(const MeshletBounds& bounds, const float3& cameraPos)
+{
+    const auto dir = bounds.coneApex - cameraPos;
+    const auto len = Length(dir);
+    return len > 0 && Dot(dir, bounds.coneAxis) >= bounds.coneCutoff * len;
+}
+
+} // namespace nova
@@ -24,10 +24,19 @@
 #include "./Math/Common.hpp"
 #include "./Math/Constants.hpp"
 #include "./Math/Float.hpp"
+#include "./Math/Interval.hpp"
 #include "./Math/Vector.hpp"
 #include "./Math/Geometry.hpp"
+#include "./Math/Parallel.hpp"
 #include "./Math/Transform.hpp"
 
+#include "./Mesh/MeshOptimizer.hpp"
+#include "./Mesh/MeshWeld.hpp"
+#include "./Mesh/Meshlet.hpp"
+#include "./Mesh/MeshSimplify.hpp"
+#include "./Mesh/ConvexHull.hpp"
+#include "./Mesh/MeshSdf.hpp"
+
 #include "./Utils/Logger.hpp"
 #include "./Utils/Profiler.hpp"
 #include "./Utils/Terminal.hpp"
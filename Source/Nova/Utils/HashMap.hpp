@@ -0,0 +1,796 @@
+/**
+ * @File HashMap.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Nova/Math/Hash.hpp"
+
+#ifdef NOVA_HAS_SSE2
+#  include <emmintrin.h>
+#endif
+
+namespace nova {
+
+/**
+ * @brief HashMap/HashSet 默认使用的哈希函数。
+ *
+ * 表用哈希值的低 7 位作为控制字节、其余位选择分组，所以低位与高位都需要充分混合：
+ * 整数、枚举与指针用 wyHash64，其他类型在 std::hash 的结果上再做一次 MixBits (std::hash 对整数通常是恒等映射)。
+ */
+template<typename T> struct HashOf
+{
+    size operator()(const T& v) const noexcept
+    {
+        if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+            return wyHash64(static_cast<u64>(v), 0);
+        else if constexpr (std::is_pointer_v<T>)
+            return wyHash64(reinterpret_cast<std::uintptr_t>(v), 0);
+        else
+            return MixBits(std::hash<T>{}(v));
+    }
+};
+
+/// 字符串用 wyHash，可以直接用 std::string_view 与字符串字面量查找 std::string 键
+struct StringHash
+{
+    using is_transparent = void;
+
+    size operator()(std::string_view s) const noexcept { return wyHash(s.data(), s.size()); }
+};
+
+template<> struct HashOf<std::string> : StringHash
+{
+};
+
+template<> struct HashOf<std::string_view> : StringHash
+{
+};
+
+/// 默认的相等比较，字符串键使用透明的 std::equal_to<>
+template<typename T> struct EqualTo : std::equal_to<T>
+{
+};
+
+template<> struct EqualTo<std::string> : std::equal_to<>
+{
+};
+
+template<> struct EqualTo<std::string_view> : std::equal_to<>
+{
+};
+
+namespace internal {
+
+// 控制字节：满的槽为哈希值的低 7 位 (0 ~ 127)，其余状态的最高位都为 1
+inline constexpr i8 kCtrlEmpty    = -128;
+inline constexpr i8 kCtrlDeleted  = -2;
+inline constexpr i8 kCtrlSentinel = -1; ///< 位于最后一个槽之后，迭代器在此停下
+
+inline constexpr size kGroupWidth = 16;
+
+/// 容量为 0 的表指向这里，begin() 直接遇到哨兵
+alignas(kGroupWidth) inline constexpr i8 kEmptyCtrl[kGroupWidth] = {
+    kCtrlSentinel, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+    kCtrlEmpty,    kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty};
+
+/**
+ * @brief 一组 16 个控制字节，查询结果为按槽排列的位掩码。
+ *
+ * 支持 SSE2 时一次比较整组，否则逐字节比较 (编译器通常也能将其向量化)。
+ */
+class CtrlGroup
+{
+public:
+    explicit CtrlGroup(const i8* ctrl)
+    {
+#ifdef NOVA_HAS_SSE2
+        _ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        Memcpy(_ctrl, ctrl, kGroupWidth);
+#endif
+    }
+
+    /// 控制字节等于 h2 的槽
+    u32 match(i8 h2) const
+    {
+#ifdef NOVA_HAS_SSE2
+        return u32(_mm_movemask_epi8(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(h2))));
+#else
+        return matchIf([h2](i8 c) { return c == h2; });
+#endif
+    }
+
+    u32 matchEmpty() const
+    {
+#ifdef NOVA_HAS_SSE2
+        return u32(_mm_movemask_epi8(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(kCtrlEmpty))));
+#else
+        return matchIf([](i8 c) { return c == kCtrlEmpty; });
+#endif
+    }
+
+    /// 空槽与已删除的槽，即最高位为 1 的控制字节 (组内不会出现哨兵)
+    u32 matchEmptyOrDeleted() const
+    {
+#ifdef NOVA_HAS_SSE2
+        return u32(_mm_movemask_epi8(_ctrl));
+#else
+        return matchIf([](i8 c) { return c < 0; });
+#endif
+    }
+
+private:
+#ifdef NOVA_HAS_SSE2
+    __m128i _ctrl;
+#else
+    template<typename Pred> u32 matchIf(Pred pred) const
+    {
+        u32 mask = 0;
+        for (size i = 0; i < kGroupWidth; ++i)
+            mask |= u32(pred(_ctrl[i])) << i;
+        return mask;
+    }
+
+    i8 _ctrl[kGroupWidth];
+#endif
+};
+
+/// 哈希函数与比较函数都声明了 is_transparent 时，查找可以使用与键不同的类型
+template<typename Hash, typename Eq>
+concept TransparentHashEq = requires {
+    typename Hash::is_transparent;
+    typename Eq::is_transparent;
+};
+
+template<bool kTransparent> struct KeyArg
+{
+    template<typename K, typename Key> using type = Key;
+};
+
+template<> struct KeyArg<true>
+{
+    template<typename K, typename Key> using type = K;
+};
+
+template<typename K, typename V> struct MapPolicy
+{
+    using key_type   = K;
+    using value_type = std::pair<const K, V>;
+
+    static constexpr bool kConstIterator = false;
+
+    static const K& Key(const value_type& v) { return v.first; }
+
+    /// 扩容时移动元素：键声明为 const，直接移动以免复制字符串等较重的键
+    static void Transfer(value_type* dst, value_type* src)
+    {
+        ::new (dst) value_type(std::piecewise_construct,
+                               std::forward_as_tuple(std::move(const_cast<K&>(src->first))),
+                               std::forward_as_tuple(std::move(src->second)));
+        src->~value_type();
+    }
+};
+
+template<typename K> struct SetPolicy
+{
+    using key_type   = K;
+    using value_type = K;
+
+    static constexpr bool kConstIterator = true;
+
+    static const K& Key(const value_type& v) { return v; }
+
+    static void Transfer(value_type* dst, value_type* src)
+    {
+        ::new (dst) value_type(std::move(*src));
+        src->~value_type();
+    }
+};
+
+/**
+ * @brief Swiss table 风格的开放寻址哈希表，HashMap 与 HashSet 的共同实现。
+ *
+ * 元素直接存放在一块连续的槽数组中，每个槽对应一个控制字节。容量为 2 的幂，每 16 个槽为一组；
+ * 哈希值的高位选择起始组，之后按三角数序列在组之间探测，低 7 位 (h2) 存入控制字节。
+ * 查找时一次比较整组的控制字节，只有 h2 相同的槽才需要比较键，遇到含空槽的组即可结束；
+ * 删除时若所在组仍有空槽则直接置空，否则留下墓碑。装载因子上限为 7/8。
+ */
+template<typename Policy, typename Hash, typename Eq> class FlatHashTable
+{
+public:
+    using key_type        = typename Policy::key_type;
+    using value_type      = typename Policy::value_type;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = Eq;
+
+    template<bool kConst> class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename Policy::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::conditional_t<kConst, const value_type&, value_type&>;
+        using pointer           = std::conditional_t<kConst, const value_type*, value_type*>;
+
+        Iterator() = default;
+
+        /// iterator 可以隐式转换为 const_iterator
+        template<bool kOther>
+            requires (kConst && !kOther)
+        Iterator(const Iterator<kOther>& other) : _ctrl(other._ctrl), _slot(other._slot)
+        {
+        }
+
+        reference operator*() const { return *_slot; }
+
+        pointer operator->() const { return _slot; }
+
+        Iterator& operator++()
+        {
+            ++_ctrl;
+            ++_slot;
+            skipEmpty();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        template<bool kOther> bool operator==(const Iterator<kOther>& other) const { return _ctrl == other._ctrl; }
+
+    private:
+        friend class FlatHashTable;
+        template<bool> friend class Iterator;
+
+        Iterator(const i8* ctrl, value_type* slot) : _ctrl(ctrl), _slot(slot) { }
+
+        /// 跳过空槽与墓碑，停在下一个元素或哨兵处
+        void skipEmpty()
+        {
+            while (*_ctrl < kCtrlSentinel) {
+                ++_ctrl;
+                ++_slot;
+            }
+        }
+
+        const i8* _ctrl   = nullptr;
+        value_type* _slot = nullptr;
+    };
+
+    using iterator       = Iterator<Policy::kConstIterator>;
+    using const_iterator = Iterator<true>;
+
+protected:
+    static constexpr bool kTransparent = TransparentHashEq<Hash, Eq>;
+
+    /// 透明查找时为 K，否则为 key_type
+    template<typename K> using key_arg = typename KeyArg<kTransparent>::template type<K, key_type>;
+
+public:
+    FlatHashTable() = default;
+
+    explicit FlatHashTable(size_type capacity, const Hash& hash = Hash(), const Eq& eq = Eq()) : _hash(hash), _eq(eq)
+    {
+        reserve(capacity);
+    }
+
+    FlatHashTable(const FlatHashTable& other) : _hash(other._hash), _eq(other._eq)
+    {
+        reserve(other._size);
+        for (const auto& v : other)
+            insertUnique(v);
+    }
+
+    FlatHashTable(FlatHashTable&& other) noexcept
+        : _hash(std::move(other._hash)), _eq(std::move(other._eq)), _ctrl(other._ctrl), _slots(other._slots),
+          _capacity(other._capacity), _size(other._size), _growthLeft(other._growthLeft)
+    {
+        other.resetEmpty();
+    }
+
+    FlatHashTable& operator=(const FlatHashTable& other)
+    {
+        if (this != &other) {
+            auto tmp = other;
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    FlatHashTable& operator=(FlatHashTable&& other) noexcept
+    {
+        if (this != &other) {
+            destroyAll();
+            deallocate();
+            resetEmpty();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~FlatHashTable()
+    {
+        destroyAll();
+        deallocate();
+    }
+
+    void swap(FlatHashTable& other) noexcept
+    {
+        std::swap(_ctrl, other._ctrl);
+        std::swap(_slots, other._slots);
+        std::swap(_capacity, other._capacity);
+        std::swap(_size, other._size);
+        std::swap(_growthLeft, other._growthLeft);
+        std::swap(_hash, other._hash);
+        std::swap(_eq, other._eq);
+    }
+
+    iterator begin()
+    {
+        iterator it(_ctrl, _slots);
+        it.skipEmpty();
+        return it;
+    }
+
+    const_iterator begin() const { return const_cast<FlatHashTable*>(this)->begin(); }
+
+    const_iterator cbegin() const { return begin(); }
+
+    iterator end() { return iterator(_ctrl + _capacity, _slots + _capacity); }
+
+    const_iterator end() const { return const_cast<FlatHashTable*>(this)->end(); }
+
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return _size == 0; }
+
+    size_type size() const { return _size; }
+
+    size_type capacity() const { return _capacity; }
+
+    /// 保证插入 n 个元素之前不会再扩容
+    void reserve(size_type n)
+    {
+        const auto capacity = CapacityFor(n);
+        if (capacity > _capacity)
+            resize(capacity);
+    }
+
+    /// 析构所有元素，保留容量
+    void clear()
+    {
+        destroyAll();
+        if (_capacity > 0) {
+            Memset(_ctrl, kCtrlEmpty, _capacity);
+            _growthLeft = MaxLoad(_capacity);
+        }
+        _size = 0;
+    }
+
+    template<typename K = key_type> iterator find(const key_arg<K>& key)
+    {
+        const auto i = findIndex(key, _hash(key));
+        return i == _capacity ? end() : iteratorAt(i);
+    }
+
+    template<typename K = key_type> const_iterator find(const key_arg<K>& key) const
+    {
+        return const_cast<FlatHashTable*>(this)->find(key);
+    }
+
+    template<typename K = key_type> bool contains(const key_arg<K>& key) const
+    {
+        return findIndex(key, _hash(key)) != _capacity;
+    }
+
+    /// @return 删除的元素个数 (0 或 1)
+    template<typename K = key_type> size_type erase(const key_arg<K>& key)
+    {
+        const auto i = findIndex(key, _hash(key));
+        if (i == _capacity)
+            return 0;
+
+        eraseAt(i);
+        return 1;
+    }
+
+    /// @return 下一个元素的迭代器。删除不会移动其他元素，其余迭代器仍然有效
+    iterator erase(iterator pos)
+        requires (!Policy::kConstIterator)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        const auto i = size_type(pos._ctrl - _ctrl);
+        eraseAt(i);
+
+        auto it = iteratorAt(i);
+        it.skipEmpty();
+        return it;
+    }
+
+    hasher hash_function() const { return _hash; }
+
+    key_equal key_eq() const { return _eq; }
+
+protected:
+    template<typename K> size_type findIndex(const K& key, size_type hash) const
+    {
+        if (_capacity == 0)
+            return _capacity;
+
+        const auto h2   = H2(hash);
+        const auto mask = groupMask();
+        auto group      = H1(hash) & mask;
+
+        for (size_type step = 1;; ++step) {
+            const auto base = group * kGroupWidth;
+            const CtrlGroup ctrl(_ctrl + base);
+
+            for (auto m = ctrl.match(h2); m != 0; m &= m - 1) {
+                const auto i = base + size_type(std::countr_zero(m));
+                if (_eq(Policy::Key(_slots[i]), key)) [[likely]]
+                    return i;
+            }
+
+            if (ctrl.matchEmpty() != 0) [[likely]]
+                return _capacity;
+
+            group = (group + step) & mask;
+        }
+    }
+
+    /// 为不存在的键准备一个槽，调用者在该槽上构造元素后调用 commitInsert
+    size_type prepareInsert(size_type hash)
+    {
+        // 只有占用一个从未用过的空槽时才消耗增长余量，复用墓碑不需要扩容
+        if (_capacity == 0 || (_growthLeft == 0 && _ctrl[findInsertSlot(hash)] == kCtrlEmpty))
+            growForInsert();
+
+        return findInsertSlot(hash);
+    }
+
+    void commitInsert(size_type i, size_type hash)
+    {
+        _growthLeft -= _ctrl[i] == kCtrlEmpty;
+        _ctrl[i]     = H2(hash);
+        ++_size;
+    }
+
+    /// 在确定不存在的键上插入 (复制构造时使用)
+    template<typename... Args> void insertUnique(Args&&... args)
+    {
+        const auto hash = _hash(Policy::Key(args...));
+        const auto i    = prepareInsert(hash);
+        ::new (_slots + i) value_type(std::forward<Args>(args)...);
+        commitInsert(i, hash);
+    }
+
+    iterator iteratorAt(size_type i) { return iterator(_ctrl + i, _slots + i); }
+
+    value_type* slot(size_type i) { return _slots + i; }
+
+    Hash _hash;
+    Eq _eq;
+
+private:
+    static constexpr size_type kMinCapacity = kGroupWidth;
+
+    static i8 H2(size_type hash) { return i8(hash & 0x7F); }
+
+    static size_type H1(size_type hash) { return hash >> 7; }
+
+    static size_type MaxLoad(size_type capacity) { return capacity - capacity / 8; }
+
+    static size_type CapacityFor(size_type n)
+    {
+        if (n == 0)
+            return 0;
+
+        auto capacity = kMinCapacity;
+        while (MaxLoad(capacity) < n)
+            capacity *= 2;
+        return capacity;
+    }
+
+    size_type groupMask() const { return _capacity / kGroupWidth - 1; }
+
+    /// 探测序列中第一个空槽或墓碑
+    size_type findInsertSlot(size_type hash) const
+    {
+        const auto mask = groupMask();
+        auto group      = H1(hash) & mask;
+
+        for (size_type step = 1;; ++step) {
+            const auto base = group * kGroupWidth;
+            const auto m    = CtrlGroup(_ctrl + base).matchEmptyOrDeleted();
+            if (m != 0)
+                return base + size_type(std::countr_zero(m));
+
+            group = (group + step) & mask;
+        }
+    }
+
+    void eraseAt(size_type i)
+    {
+        std::destroy_at(_slots + i);
+        --_size;
+
+        // 所在组仍有空槽说明没有探测序列越过这一组，可以直接置空
+        if (CtrlGroup(_ctrl + i / kGroupWidth * kGroupWidth).matchEmpty() != 0) {
+            _ctrl[i] = kCtrlEmpty;
+            ++_growthLeft;
+        }
+        else {
+            _ctrl[i] = kCtrlDeleted;
+        }
+    }
+
+    /// 墓碑较多时原地重建以清除墓碑，否则容量加倍
+    void growForInsert()
+    {
+        if (_capacity > 0 && _size < MaxLoad(_capacity) / 2)
+            resize(_capacity);
+        else
+            resize(_capacity == 0 ? kMinCapacity : _capacity * 2);
+    }
+
+    void resize(size_type capacity)
+    {
+        auto* oldCtrl     = _ctrl;
+        auto* oldSlots    = _slots;
+        const auto oldCap = _capacity;
+
+        allocate(capacity);
+
+        for (size_type i = 0; i < oldCap; ++i) {
+            if (oldCtrl[i] < 0)
+                continue;
+
+            const auto hash = _hash(Policy::Key(oldSlots[i]));
+            const auto j    = findInsertSlot(hash);
+            Policy::Transfer(_slots + j, oldSlots + i);
+            _ctrl[j] = H2(hash);
+        }
+        _growthLeft -= _size;
+
+        Deallocate(oldCtrl, oldCap);
+    }
+
+    // 控制字节与槽放在同一块内存中：[控制字节 | 哨兵与填充 | 槽]
+    static constexpr size_type kAlignment = std::max(kGroupWidth, alignof(value_type));
+
+    static size_type SlotOffset(size_type capacity)
+    {
+        return (capacity + kGroupWidth + alignof(value_type) - 1) / alignof(value_type) * alignof(value_type);
+    }
+
+    void allocate(size_type capacity)
+    {
+        const auto offset = SlotOffset(capacity);
+        auto* memory = static_cast<u8*>(::operator new(offset + capacity * sizeof(value_type), std::align_val_t(kAlignment)));
+
+        _ctrl     = reinterpret_cast<i8*>(memory);
+        _slots    = reinterpret_cast<value_type*>(memory + offset);
+        _capacity = capacity;
+
+        Memset(_ctrl, kCtrlEmpty, capacity);
+        _ctrl[capacity] = kCtrlSentinel;
+        _growthLeft     = MaxLoad(capacity);
+    }
+
+    static void Deallocate(i8* ctrl, size_type capacity)
+    {
+        if (capacity > 0)
+            ::operator delete(ctrl, std::align_val_t(kAlignment));
+    }
+
+    void deallocate() { Deallocate(_ctrl, _capacity); }
+
+    void destroyAll()
+    {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < _capacity; ++i) {
+                if (_ctrl[i] >= 0)
+                    std::destroy_at(_slots + i);
+            }
+        }
+    }
+
+    void resetEmpty()
+    {
+        _ctrl       = const_cast<i8*>(kEmptyCtrl);
+        _slots      = nullptr;
+        _capacity   = 0;
+        _size       = 0;
+        _growthLeft = 0;
+    }
+
+    i8* _ctrl             = const_cast<i8*>(kEmptyCtrl);
+    value_type* _slots    = nullptr;
+    size_type _capacity   = 0;
+    size_type _size       = 0;
+    size_type _growthLeft = 0;
+};
+
+} // namespace internal
+
+/**
+ * @brief 扁平存储的哈希表，代替 std::unordered_map。
+ *
+ * 与 std::unordered_map 的主要区别：插入可能使所有迭代器与引用失效 (删除不会)；
+ * 字符串键支持用 std::string_view 或字面量直接查找，不需要构造临时的 std::string。
+ */
+template<typename K, typename V, typename Hash = HashOf<K>, typename Eq = EqualTo<K>>
+class HashMap : public internal::FlatHashTable<internal::MapPolicy<K, V>, Hash, Eq>
+{
+    using Base = internal::FlatHashTable<internal::MapPolicy<K, V>, Hash, Eq>;
+
+    template<typename Q> using key_arg = typename Base::template key_arg<Q>;
+
+public:
+    using mapped_type = V;
+    using typename Base::const_iterator;
+    using typename Base::iterator;
+    using typename Base::key_type;
+    using typename Base::value_type;
+
+    using Base::Base;
+
+    HashMap() = default;
+
+    HashMap(std::initializer_list<value_type> init)
+    {
+        this->reserve(init.size());
+        for (const auto& v : init)
+            insert(v);
+    }
+
+    template<typename Q = key_type, typename... Args> std::pair<iterator, bool> try_emplace(const key_arg<Q>& key, Args&&... args)
+    {
+        return emplaceImpl(key, [&] { return key_type(key); }, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args> std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+    {
+        return emplaceImpl(key, [&] { return std::move(key); }, std::forward<Args>(args)...);
+    }
+
+    /// 与 try_emplace 相同：键已存在时不构造值
+    template<typename Q, typename... Args> std::pair<iterator, bool> emplace(Q&& key, Args&&... args)
+    {
+        return try_emplace(std::forward<Q>(key), std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& v) { return try_emplace(v.first, v.second); }
+
+    std::pair<iterator, bool> insert(value_type&& v)
+    {
+        return try_emplace(std::move(const_cast<key_type&>(v.first)), std::move(v.second));
+    }
+
+    template<typename Q = key_type, typename M> std::pair<iterator, bool> insert_or_assign(const key_arg<Q>& key, M&& value)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second)
+            result.first->second = std::forward<M>(value);
+        return result;
+    }
+
+    template<typename Q = key_type> V& operator[](const key_arg<Q>& key) { return try_emplace(key).first->second; }
+
+    V& operator[](key_type&& key) { return try_emplace(std::move(key)).first->second; }
+
+    template<typename Q = key_type> V& at(const key_arg<Q>& key)
+    {
+        auto it = this->find(key);
+        NOVA_CHECK(it != this->end());
+        return it->second;
+    }
+
+    template<typename Q = key_type> const V& at(const key_arg<Q>& key) const
+    {
+        auto it = this->find(key);
+        NOVA_CHECK(it != this->end());
+        return it->second;
+    }
+
+private:
+    /// 只有键不存在时才调用 makeKey 构造键
+    template<typename Q, typename MakeKey, typename... Args>
+    std::pair<iterator, bool> emplaceImpl(const Q& key, MakeKey&& makeKey, Args&&... args)
+    {
+        const auto hash = this->_hash(key);
+        if (const auto i = this->findIndex(key, hash); i != this->capacity())
+            return {this->iteratorAt(i), false};
+
+        const auto i = this->prepareInsert(hash);
+        ::new (this->slot(i)) value_type(std::piecewise_construct,
+                                         std::forward_as_tuple(makeKey()),
+                                         std::forward_as_tuple(std::forward<Args>(args)...));
+        this->commitInsert(i, hash);
+        return {this->iteratorAt(i), true};
+    }
+};
+
+/**
+ * @brief 扁平存储的哈希集合，代替 std::unordered_set，迭代器只读。
+ */
+template<typename K, typename Hash = HashOf<K>, typename Eq = EqualTo<K>>
+class HashSet : public internal::FlatHashTable<internal::SetPolicy<K>, Hash, Eq>
+{
+    using Base = internal::FlatHashTable<internal::SetPolicy<K>, Hash, Eq>;
+
+    template<typename Q> using key_arg = typename Base::template key_arg<Q>;
+
+public:
+    using typename Base::const_iterator;
+    using typename Base::iterator;
+    using typename Base::key_type;
+    using typename Base::value_type;
+
+    using Base::Base;
+
+    HashSet() = default;
+
+    HashSet(std::initializer_list<key_type> init)
+    {
+        this->reserve(init.size());
+        for (const auto& k : init)
+            insert(k);
+    }
+
+    template<typename Q = key_type> std::pair<iterator, bool> insert(const key_arg<Q>& key)
+    {
+        return emplaceImpl(key, [&] { return key_type(key); });
+    }
+
+    std::pair<iterator, bool> insert(key_type&& key)
+    {
+        return emplaceImpl(key, [&] { return std::move(key); });
+    }
+
+    template<typename... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert(key_type(std::forward<Args>(args)...));
+    }
+
+private:
+    template<typename Q, typename MakeKey> std::pair<iterator, bool> emplaceImpl(const Q& key, MakeKey&& makeKey)
+    {
+        const auto hash = this->_hash(key);
+        if (const auto i = this->findIndex(key, hash); i != this->capacity())
+            return {this->iteratorAt(i), false};
+
+        const auto i = this->prepareInsert(hash);
+        ::new (this->slot(i)) value_type(makeKey());
+        this->commitInsert(i, hash);
+        return {this->iteratorAt(i), true};
+    }
+};
+
+} // namespace nova
@@ -7,10 +7,10 @@
 
 #include "Logger.hpp"
 #include "Nova/Base/Defines.hpp"
+#include "Nova/Utils/HashMap.hpp"
 #include "Nova/Utils/Terminal.hpp"
 
 #include <iostream>
-#include <ranges>
 
 using namespace nova;
 
@@ -28,6 +28,16 @@ constexpr inline const char* logLevelString(Logger::Level level)
 
 } // namespace
 
+/// 按名称保存订阅者。名称复制为 std::string，取消订阅时用 std::string_view 直接查找
+struct Logger::Subscribers
+{
+    HashMap<std::string, LogNotifyType> notifies;
+};
+
+Logger::Logger() : _subscribers(std::make_unique<Subscribers>()) { }
+
+Logger::~Logger() = default;
+
 void Logger::log(Level level, std::string_view msg)
 {
     auto lock = std::lock_guard(_mutex);
@@ -51,10 +61,8 @@ void Logger::log(Level level, std::string_view msg)
         os << tc::reset << std::flush;
     }
 
-    if (!_subscribers.empty()) {
-        for (const auto& notify : _subscribers | std::views::values) {
-            notify(s);
-        }
+    for (const auto& [name, notify] : _subscribers->notifies) {
+        notify(s);
     }
 }
 
@@ -73,13 +81,13 @@ Logger::Level Logger::level()
 void Logger::subscribe(std::string_view name, LogNotifyType&& notify)
 {
     auto lock = std::lock_guard(_mutex);
-    _subscribers.emplace(name, std::move(notify));
+    _subscribers->notifies.try_emplace(name, std::move(notify));
 }
 
 void Logger::unsubscribe(std::string_view name)
 {
     auto lock = std::lock_guard(_mutex);
-    _subscribers.extract(name);
+    _subscribers->notifies.erase(name);
 }
 
 void NOVA_API detail::LogWithSourceLocation(Logger::Level level, std::source_location sl, std::string_view msg)
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <format>
 #include <source_location>
@@ -44,13 +45,15 @@ public:
     void unsubscribe(std::string_view name);
 
 private:
-    Logger()  = default;
-    ~Logger() = default;
+    Logger();
+    ~Logger();
 
     std::mutex _mutex;
 
     Logger::Level _level = Logger::Level::Info;
-    std::unordered_map<std::string_view, LogNotifyType> _subscribers;
+    // 订阅者表使用 HashMap，其头文件间接包含 Error.hpp，因此只在 Logger.cpp 中定义
+    struct Subscribers;
+    std::unique_ptr<Subscribers> _subscribers;
 };
 
 inline auto operator<=>(Logger::Level lhs, Logger::Level rhs)
@@ -0,0 +1,312 @@
+/**
+ * @File Sketch.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#include "Nova/Math/Bit.hpp"
+#include "Nova/Math/Hash.hpp"
+#include "Nova/Utils/HashMap.hpp"
+
+#ifdef NOVA_HAS_AVX2
+#  include <immintrin.h>
+#endif
+
+namespace nova {
+
+namespace internal {
+
+/// 与原子写入同时进行的读取也需要是原子的，relaxed 读取在 x86 上就是普通的读取
+template<typename T> T LoadRelaxed(const T& x)
+{
+    return std::atomic_ref<T>(const_cast<T&>(x)).load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief 由键的哈希值 h 得到一组双重哈希 g_i = a + i * b (Kirsch-Mitzenmacher)。
+ *
+ * a = MixBits(h) 与 h 的高位近似独立，所以 h 的高位可以另外用于选择块；b 为奇数，保证 g_i 互不相同。
+ */
+struct DoubleHash
+{
+    explicit DoubleHash(u64 h) : a(MixBits(h)), b(RotLeft(a, 32) | 1) { }
+
+    u64 operator[](u64 i) const { return a + i * b; }
+
+    u64 a;
+    u64 b;
+};
+
+/**
+ * @brief 分块 Bloom 过滤器的误判率：每块平均有 keysPerBlock 个键 (Poisson 分布)，
+ * 每个键在块的 8 个 64 位字中各置一位。
+ */
+inline f64 BlockedBloomFalsePositiveRate(f64 keysPerBlock)
+{
+    const auto terms = size(keysPerBlock + 10 * std::sqrt(keysPerBlock) + 10);
+
+    f64 rate = 0, poisson = std::exp(-keysPerBlock);
+    for (size j = 0; j < terms; ++j) {
+        const auto bit = 1 - std::pow(63.0 / 64.0, f64(j));
+        rate          += poisson * std::pow(bit, 8);
+        poisson       *= keysPerBlock / f64(j + 1);
+    }
+    return rate;
+}
+
+} // namespace internal
+
+/**
+ * @brief 分块 Bloom 过滤器，用于在访问磁盘或大表之前排除一定不存在的键。
+ *
+ * 每个键只访问一个 64 字节 (一条缓存行) 的块：哈希值的高位选择块，双重哈希在块的 8 个 64 位字中各置一位。
+ * 插入对每个字使用原子的按位或，可以在多个线程中同时进行而不需要加锁；查询用 relaxed 原子读取块中的字，
+ * 支持 AVX2 时一次计算 4 个字的掩码，两次比较即可得到结果。
+ * 同一块中的键较多时误判率高于普通的 Bloom 过滤器，构造时按分块后的误判率选择大小。
+ *
+ * 查询与插入同时进行时，查询不保证能看到正在进行的插入；插入完成并同步之后的查询不会漏报。
+ */
+template<typename K = u64, typename Hash = HashOf<K>> class BloomFilter
+{
+public:
+    static constexpr size kBlockBits = 512;
+    static constexpr size kWords     = kBlockBits / 64;
+
+    /**
+     * @param expectedCount      预计插入的键的数量
+     * @param falsePositiveRate  插入 expectedCount 个键后期望的误判率
+     */
+    explicit BloomFilter(size expectedCount, f64 falsePositiveRate = 0.01, const Hash& hash = Hash()) : _hash(hash)
+    {
+        NOVA_CHECK(falsePositiveRate > 0 && falsePositiveRate < 1);
+
+        // 以 0.5 位为步长寻找满足误判率的每个键的位数，误判率过低时最多使用 64 位
+        f64 bitsPerKey = 1;
+        while (bitsPerKey < 64 &&
+               internal::BlockedBloomFalsePositiveRate(f64(kBlockBits) / bitsPerKey) > falsePositiveRate)
+            bitsPerKey += 0.5;
+
+        const auto blocks = std::ceil(f64(Max<size>(expectedCount, 1)) * bitsPerKey / f64(kBlockBits));
+        _blocks.resize(Clamp<size>(size(blocks), 1, u32_max));
+    }
+
+    void insert(const K& key) { insertHash(_hash(key)); }
+
+    bool contains(const K& key) const { return containsHash(_hash(key)); }
+
+    /// 依次插入一组键，在全局执行器上并行插入见 Parallel/Sketch.hpp
+    void insert(std::span<const K> keys)
+    {
+        for (const auto& key : keys)
+            insert(key);
+    }
+
+    void contains(std::span<const K> keys, std::span<bool> out) const
+    {
+        NOVA_CHECK(out.size() >= keys.size());
+
+        for (size i = 0; i < keys.size(); ++i)
+            out[i] = contains(keys[i]);
+    }
+
+    /// 直接使用哈希值，便于与 StreamHasher 等已有的哈希配合
+    void insertHash(u64 h)
+    {
+        auto& block = _blocks[blockIndex(h)];
+
+        const internal::DoubleHash g(h);
+        for (size i = 0; i < kWords; ++i) {
+            const auto mask = u64(1) << (g[i] >> 58);
+
+            // 多数位已经置过，先读一次以免每次都独占缓存行
+            std::atomic_ref<u64> word(block.words[i]);
+            if ((word.load(std::memory_order_relaxed) & mask) == 0)
+                word.fetch_or(mask, std::memory_order_relaxed);
+        }
+    }
+
+    bool containsHash(u64 h) const
+    {
+        const auto& block = _blocks[blockIndex(h)];
+        const internal::DoubleHash g(h);
+
+        // 先原子地读出整个块，再在局部副本上比较
+        alignas(32) u64 words[kWords];
+        for (size i = 0; i < kWords; ++i)
+            words[i] = internal::LoadRelaxed(block.words[i]);
+
+#ifdef NOVA_HAS_AVX2
+        // 前 4 个字为 a + {0, 1, 2, 3} * b，后 4 个字再加上 4 * b
+        const auto step = _mm256_set_epi64x(i64(3 * g.b), i64(2 * g.b), i64(g.b), 0);
+        const auto a    = _mm256_add_epi64(_mm256_set1_epi64x(i64(g.a)), step);
+        const auto b4   = _mm256_set1_epi64x(i64(4 * g.b));
+        const auto one  = _mm256_set1_epi64x(1);
+
+        const auto lo = _mm256_sllv_epi64(one, _mm256_srli_epi64(a, 58));
+        const auto hi = _mm256_sllv_epi64(one, _mm256_srli_epi64(_mm256_add_epi64(a, b4), 58));
+
+        // testc 判断掩码中的位是否都已置位
+        return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(words)), lo) &
+               _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(words + 4)), hi);
+#else
+        u64 missing = 0;
+        for (size i = 0; i < kWords; ++i) {
+            const auto mask  = u64(1) << (g[i] >> 58);
+            missing         |= mask & ~words[i];
+        }
+        return missing == 0;
+#endif
+    }
+
+    void clear() { std::fill(_blocks.begin(), _blocks.end(), Block{}); }
+
+    size blockCount() const { return _blocks.size(); }
+
+    size bitCount() const { return _blocks.size() * kBlockBits; }
+
+    /// 插入 count 个键后的误判率估计
+    f64 falsePositiveRate(size count) const
+    {
+        return internal::BlockedBloomFalsePositiveRate(f64(count) / f64(_blocks.size()));
+    }
+
+private:
+    struct alignas(64) Block
+    {
+        u64 words[kWords] = {};
+    };
+
+    /// 用哈希值的高 32 位将其映射到 [0, blockCount)，不需要取模
+    size blockIndex(u64 h) const { return size(((h >> 32) * u64(_blocks.size())) >> 32); }
+
+    std::vector<Block> _blocks;
+    Hash _hash;
+};
+
+/**
+ * @brief Count-min sketch，用固定的内存估计每个键出现的次数，用于缓存准入等需要访问频率的场合。
+ *
+ * depth 行、每行 width 个 32 位计数器，每行由双重哈希选择一个计数器，估计值取各行的最小值：
+ * 估计值不会小于真实次数，以至少 1 - delta 的概率不超过真实次数 + epsilon * total。
+ * 增加计数使用原子的比较交换，可以在多个线程中同时进行，计数器到达 u32_max 后保持不变而不会回绕；
+ * 查询用 relaxed 原子读取各行的计数器，支持 AVX2 时用向量计算各行的下标与最小值。
+ */
+template<typename K = u64, typename Hash = HashOf<K>> class CountMinSketch
+{
+public:
+    static constexpr size kMaxDepth = 8;
+
+    explicit CountMinSketch(f64 epsilon = 1e-3, f64 delta = 1e-2, const Hash& hash = Hash()) : _hash(hash)
+    {
+        NOVA_CHECK(epsilon > 0 && delta > 0 && delta < 1);
+
+        // 计数器的下标需要能用 32 位整数表示 (AVX2 gather)
+        const auto width = std::ceil(std::numbers::e / epsilon);
+        _width           = RoundUpPow2(Clamp<size>(size(width), 64, size(1) << 27));
+        _depth           = Clamp<size>(size(std::ceil(std::log(1 / delta))), 1, kMaxDepth);
+        _shift           = 64 - Log2Int(u64(_width));
+        _counters.resize(_depth * _width);
+    }
+
+    void add(const K& key, u32 count = 1) { addHash(_hash(key), count); }
+
+    u32 estimate(const K& key) const { return estimateHash(_hash(key)); }
+
+    void addHash(u64 h, u32 count = 1)
+    {
+        const internal::DoubleHash g(h);
+        for (size i = 0; i < _depth; ++i) {
+            std::atomic_ref<u32> counter(_counters[i * _width + (g[i] >> _shift)]);
+
+            // 饱和加法：已经饱和的计数器不再写入
+            auto c = counter.load(std::memory_order_relaxed);
+            while (c != u32_max) {
+                const auto next = c + Min(count, u32_max - c);
+                if (counter.compare_exchange_weak(c, next, std::memory_order_relaxed))
+                    break;
+            }
+        }
+
+        std::atomic_ref<u64>(_total).fetch_add(count, std::memory_order_relaxed);
+    }
+
+    u32 estimateHash(u64 h) const
+    {
+        const internal::DoubleHash g(h);
+
+#ifdef NOVA_HAS_AVX2
+        // 8 行的下标先按 64 位计算，再取每个 64 位数的低 32 位拼成一个向量
+        const auto step  = _mm256_set_epi64x(i64(3 * g.b), i64(2 * g.b), i64(g.b), 0);
+        const auto a     = _mm256_add_epi64(_mm256_set1_epi64x(i64(g.a)), step);
+        const auto b4    = _mm256_set1_epi64x(i64(4 * g.b));
+        const auto shift = _mm_cvtsi64_si128(i64(_shift));
+
+        const auto even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        const auto lo   = _mm256_permutevar8x32_epi32(_mm256_srl_epi64(a, shift), even);
+        const auto hi   = _mm256_permutevar8x32_epi32(_mm256_srl_epi64(_mm256_add_epi64(a, b4), shift), even);
+        const auto col  = _mm256_permute2x128_si256(lo, hi, 0x20);
+
+        const auto row    = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const auto offset = _mm256_add_epi32(col, _mm256_mullo_epi32(row, _mm256_set1_epi32(i32(_width))));
+
+        // gather 不是原子读取，计数器逐个读出；不存在的行读作最大值，不影响最小值
+        alignas(32) u32 offsets[kMaxDepth];
+        alignas(32) u32 counts[kMaxDepth];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(offsets), offset);
+        for (size i = 0; i < kMaxDepth; ++i)
+            counts[i] = i < _depth ? internal::LoadRelaxed(_counters[offsets[i]]) : u32_max;
+
+        auto m = _mm256_load_si256(reinterpret_cast<const __m256i*>(counts));
+        m      = _mm256_min_epu32(m, _mm256_permute2x128_si256(m, m, 1));
+        m                = _mm256_min_epu32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+        m                = _mm256_min_epu32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+        return u32(_mm256_cvtsi256_si32(m));
+#else
+        auto count = u32_max;
+        for (size i = 0; i < _depth; ++i)
+            count = Min(count, internal::LoadRelaxed(_counters[i * _width + (g[i] >> _shift)]));
+        return count;
+#endif
+    }
+
+    /// 所有计数减半，让旧的访问逐渐失效 (TinyLFU 的老化)，饱和的计数器也随之减半。不能与 add 同时调用
+    void halve()
+    {
+        for (auto& c : _counters)
+            c >>= 1;
+        _total >>= 1;
+    }
+
+    void clear()
+    {
+        std::fill(_counters.begin(), _counters.end(), 0u);
+        _total = 0;
+    }
+
+    size width() const { return _width; }
+
+    size depth() const { return _depth; }
+
+    /// 所有键的计数之和，不受计数器饱和的影响
+    u64 total() const { return internal::LoadRelaxed(_total); }
+
+private:
+    std::vector<u32> _counters;
+    size _width = 0;
+    size _depth = 0;
+    i32 _shift  = 0;
+    u64 _total  = 0;
+    Hash _hash;
+};
+
+} // namespace nova
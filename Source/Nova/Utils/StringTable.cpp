@@ -0,0 +1,94 @@
+/**
+ * @File StringTable.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include "StringTable.hpp"
+
+#include <mutex>
+#include <vector>
+
+#include "Nova/Base/Error.hpp"
+
+using namespace nova;
+
+/// 按块分配字符串的存储，已分配的字符串不会移动
+struct StringTable::Arena
+{
+    static constexpr size kBlockSize = 64 * 1024;
+
+    std::string_view store(std::string_view s)
+    {
+        if (s.size() > kBlockSize / 4) {
+            // 较长的字符串单独分配，不浪费当前块的剩余空间
+            auto& block = large.emplace_back(std::make_unique<char[]>(s.size()));
+            Memcpy(block.get(), s.data(), s.size());
+            return {block.get(), s.size()};
+        }
+
+        if (blocks.empty() || used + s.size() > kBlockSize) {
+            blocks.emplace_back(std::make_unique<char[]>(kBlockSize));
+            used = 0;
+        }
+
+        auto* p = blocks.back().get() + used;
+        Memcpy(p, s.data(), s.size());
+        used += s.size();
+        return {p, s.size()};
+    }
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::vector<std::unique_ptr<char[]>> large;
+    size used = 0;
+};
+
+StringTable& StringTable::inst()
+{
+    static StringTable table;
+    return table;
+}
+
+StringTable::StringTable() : _arena(std::make_unique<Arena>()) { }
+
+StringTable::~StringTable() = default;
+
+StringId StringTable::intern(std::string_view s)
+{
+    const StringId id(s);
+    {
+        auto lock = std::shared_lock(_mutex);
+        if (auto it = _strings.find(id); it != _strings.end()) {
+            NOVA_CONFIRM(it->second == s, "字符串 '{}' 与 '{}' 的 ID 相同", s, it->second);
+            return id;
+        }
+    }
+
+    auto lock         = std::unique_lock(_mutex);
+    auto [it, insert] = _strings.try_emplace(id);
+    if (insert)
+        it->second = _arena->store(s);
+    else
+        NOVA_CONFIRM(it->second == s, "字符串 '{}' 与 '{}' 的 ID 相同", s, it->second);
+
+    return id;
+}
+
+std::string_view StringTable::find(StringId id) const
+{
+    auto lock = std::shared_lock(_mutex);
+    auto it   = _strings.find(id);
+    return it != _strings.end() ? it->second : std::string_view{};
+}
+
+size StringTable::count() const
+{
+    auto lock = std::shared_lock(_mutex);
+    return _strings.size();
+}
+
+std::string_view StringId::str() const
+{
+    return StringTable::inst().find(*this);
+}
@@ -0,0 +1,61 @@
+/**
+ * @File StringTable.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+
+#include "Nova/Math/Hash.hpp"
+#include "Nova/Utils/HashMap.hpp"
+
+namespace nova {
+
+/// ID 本身就是 wyHash 的结果，不需要再混合
+template<> struct HashOf<StringId>
+{
+    size operator()(StringId id) const noexcept { return id.value(); }
+};
+
+/**
+ * @brief 全局的字符串驻留表。
+ *
+ * 每个不同的字符串只保存一份，地址在程序结束前保持不变，返回的 std::string_view 可以长期持有。
+ * 查询使用读写锁，已经注册过的字符串再次 intern 时只需要读锁。
+ * 两个不同的字符串得到相同的 ID 时抛出异常，而不是静默地把它们当作同一个字符串。
+ */
+class NOVA_API StringTable
+{
+public:
+    static StringTable& inst();
+
+    /// 注册字符串并返回其 ID，与 StringId(s) 相同
+    StringId intern(std::string_view s);
+
+    /// 注册过的字符串，没有注册过时返回空串
+    std::string_view find(StringId id) const;
+
+    size count() const;
+
+private:
+    StringTable();
+    ~StringTable();
+
+    struct Arena;
+
+    mutable std::shared_mutex _mutex;
+    HashMap<StringId, std::string_view> _strings;
+    std::unique_ptr<Arena> _arena;
+};
+
+inline StringId Intern(std::string_view s)
+{
+    return StringTable::inst().intern(s);
+}
+
+} // namespace nova
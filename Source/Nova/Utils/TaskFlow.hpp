@@ -9,3 +9,92 @@
 
 #include <taskflow/taskflow.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include "Nova/Base/Defines.hpp"
+
+namespace nova {
+
+/// 全局共享的任务执行器
+inline tf::Executor& GetExecutor()
+{
+    static tf::Executor executor;
+    return executor;
+}
+
+/**
+ * @brief 将 [begin, end) 划分为若干区间，并在全局执行器上并行调用 func(first, last)。
+ *
+ * 每个区间至少包含 grainSize 个元素；只有一个区间时直接在调用线程中执行。
+ * 在执行器的工作线程中调用时使用 corun，避免嵌套并行时阻塞工作线程。
+ */
+template<typename Func> inline void ParallelFor(size begin, size end, size grainSize, Func&& func)
+{
+    if (begin >= end)
+        return;
+
+    auto& executor = GetExecutor();
+
+    const auto count      = end - begin;
+    const auto maxChunks  = std::max<size>(executor.num_workers() * 4, 1);
+    const auto chunkCount = std::min(std::max<size>(count / std::max<size>(grainSize, 1), 1), maxChunks);
+
+    if (chunkCount <= 1) {
+        func(begin, end);
+        return;
+    }
+
+    const auto chunkSize = (count + chunkCount - 1) / chunkCount;
+
+    tf::Taskflow taskflow;
+    for (auto first = begin; first < end; first += chunkSize) {
+        const auto last = std::min(first + chunkSize, end);
+        taskflow.emplace([first, last, &func]() { func(first, last); });
+    }
+
+    if (executor.this_worker_id() >= 0)
+        executor.corun(taskflow);
+    else
+        executor.run(taskflow).wait();
+}
+
+/**
+ * @brief 在全局执行器上并行调用 func(i)，i 取遍 [begin, end)。
+ *
+ * 各工作线程通过原子计数器逐个领取元素，适用于单个元素耗时差异较大的情形。
+ */
+template<typename Func> inline void ParallelForEach(size begin, size end, Func&& func)
+{
+    if (begin >= end)
+        return;
+
+    auto& executor = GetExecutor();
+
+    const auto taskCount = std::min<size>(std::max<size>(executor.num_workers(), 1), end - begin);
+    if (taskCount <= 1) {
+        for (auto i = begin; i < end; ++i)
+            func(i);
+        return;
+    }
+
+    std::atomic<size> next{begin};
+
+    tf::Taskflow taskflow;
+    for (size t = 0; t < taskCount; ++t) {
+        taskflow.emplace([&]() {
+            for (;;) {
+                const auto i = next.fetch_add(1, std::memory_order_relaxed);
+                if (i >= end)
+                    break;
+                func(i);
+            }
+        });
+    }
+
+    if (executor.this_worker_id() >= 0)
+        executor.corun(taskflow);
+    else
+        executor.run(taskflow).wait();
+}
+
+} // namespace nova
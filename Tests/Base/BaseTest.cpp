@@ -7,3 +7,36 @@
 
 #include <gtest/gtest.h>
 
+#include <Nova/Base/Object.hpp>
+
+using namespace nova;
+
+namespace {
+
+class Mesh : public Object
+{
+    NOVA_OBJECT(Mesh)
+};
+
+class SkinnedMesh : public Mesh
+{
+    NOVA_OBJECT(SkinnedMesh)
+};
+
+} // namespace
+
+TEST(ObjectTest, TypeId)
+{
+    static_assert(Mesh::kTypeId == StringId("Mesh"));
+    static_assert(Mesh::kTypeId != SkinnedMesh::kTypeId);
+    static_assert(Object::kTypeId != Mesh::kTypeId);
+
+    SkinnedMesh skinned;
+    const Object& object = skinned;
+    EXPECT_EQ(object.id(), "SkinnedMesh");
+    EXPECT_EQ(object.typeId(), SkinnedMesh::kTypeId);
+    EXPECT_EQ(object.typeId().str(), "SkinnedMesh");
+    EXPECT_EQ(StringId::FromValue(object.typeId().value()).str(), "SkinnedMesh");
+    EXPECT_TRUE(object.is<SkinnedMesh>());
+    EXPECT_FALSE(object.is<Mesh>());
+}
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include "Nova/Nova.hpp"
+#include "Nova/Math/Random.hpp"
 using namespace nova;
 
 TEST(FmaTest, BasicOperation)
@@ -170,4 +171,57 @@ TEST(NextFloatDownTest, Infinity)
     auto next = NextFloatDown(v);
     // Negative infinity is the smallest representable number
     EXPECT_EQ(next, v);
-}
\ No newline at end of file
+}
+
+TEST(IntervalTest, ContainsExactResult)
+{
+    PCG32 rng(17);
+    for (int i = 0; i < 10000; ++i) {
+        const auto a = (rng.gen<f32>() - 0.5f) * 100.f;
+        const auto b = (rng.gen<f32>() - 0.5f) * 100.f;
+        const Interval ia(a), ib(b);
+
+        // 单精度数的和、差、积在双精度下是精确的
+        EXPECT_LE((ia + ib).lowerBound(), f64(a) + f64(b));
+        EXPECT_GE((ia + ib).upperBound(), f64(a) + f64(b));
+        EXPECT_LE((ia - ib).lowerBound(), f64(a) - f64(b));
+        EXPECT_GE((ia - ib).upperBound(), f64(a) - f64(b));
+        EXPECT_LE((ia * ib).lowerBound(), f64(a) * f64(b));
+        EXPECT_GE((ia * ib).upperBound(), f64(a) * f64(b));
+        EXPECT_LE(Sqr(ia).lowerBound(), f64(a) * f64(a));
+        EXPECT_GE(Sqr(ia).upperBound(), f64(a) * f64(a));
+        EXPECT_LE(Fma(ia, ib, ia).lowerBound(), f64(a) * f64(b) + f64(a));
+        EXPECT_GE(Fma(ia, ib, ia).upperBound(), f64(a) * f64(b) + f64(a));
+
+        if (b != 0) {
+            EXPECT_LE((ia / ib).lowerBound(), f64(a) / f64(b) * (1 + 1e-12));
+            EXPECT_GE((ia / ib).upperBound(), f64(a) / f64(b) * (1 - 1e-12));
+        }
+    }
+}
+
+TEST(IntervalTest, SignAndDegenerate)
+{
+    const Interval zero(0.f);
+    EXPECT_TRUE(zero.exactly(0.f));
+    EXPECT_EQ(zero.sign(), 0);
+
+    // 0 的加减与乘积不会产生 NaN
+    const auto sum = zero + zero;
+    EXPECT_FALSE(IsNaN(sum.lowerBound()));
+    EXPECT_LE(sum.lowerBound(), 0.f);
+    EXPECT_GE(sum.upperBound(), 0.f);
+    EXPECT_FALSE(IsNaN((zero * Interval(3.f)).lowerBound()));
+
+    EXPECT_EQ((Interval(1.f) + Interval(2.f)).sign(), 1);
+    EXPECT_EQ((Interval(1.f) - Interval(2.f)).sign(), -1);
+    EXPECT_EQ(Interval(-1.f, 1.f).sign(), 0);
+
+    EXPECT_GE(Sqr(Interval(-1.f, 2.f)).lowerBound(), 0.f);
+    EXPECT_GE(Sqr(Interval(-1.f, 2.f)).upperBound(), 4.f);
+    EXPECT_TRUE(IsInf((Interval(1.f) / Interval(-1.f, 1.f)).upperBound()));
+
+    const auto r = Sqrt(Interval(4.f));
+    EXPECT_TRUE(r.inRange(2.f));
+    EXPECT_LT(r.width(), 1e-5f);
+}
@@ -7,7 +7,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "Nova/nova.hpp"
+#include "Nova/Math/Random.hpp"
 using namespace nova;
 
 class FrameTest : public ::testing::Test
@@ -69,3 +75,1314 @@ TEST_F(FrameTest, BoundaryConditions)
     EXPECT_NEAR(vec_local.x / vec_near_zero.x, 1.0f, 1e-6);
     EXPECT_NEAR(vec_local.z / vec_near_zero.z, 1.0f, 1e-6);
 }
+
+namespace {
+
+f64 TriangulatedArea(std::span<const float2> points, const std::vector<u32>& indices)
+{
+    f64 area = 0;
+    for (size i = 0; i < indices.size(); i += 3) {
+        const auto a = Triangulate::Orient(points[indices[i]], points[indices[i + 1]], points[indices[i + 2]]) * 0.5;
+        EXPECT_GE(a, 0.0);
+        area += a;
+    }
+    return area;
+}
+
+// 星形多边形，顶点按逆时针排列
+std::vector<float2> MakeStar(u32 n, u64 seed)
+{
+    PCG32 rng(seed);
+    std::vector<float2> points;
+    for (u32 i = 0; i < n; ++i) {
+        const auto angle  = f32(i) / f32(n) * 2.f * f32(kPi);
+        const auto radius = 1.f + 4.f * rng.gen<f32>();
+        points.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    return points;
+}
+
+} // namespace
+
+TEST(TriangulateTest, ConvexPolygon)
+{
+    const std::vector<float2> square = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+
+    Triangulate triangulate;
+    std::vector<u32> indices;
+    ASSERT_TRUE(triangulate({square, {}}, indices));
+
+    EXPECT_EQ(indices.size(), 6u);
+    EXPECT_DOUBLE_EQ(TriangulatedArea(square, indices), 4.0);
+}
+
+TEST(TriangulateTest, StarPolygonBothOrientations)
+{
+    auto points = MakeStar(300, 17);
+    const auto area = Triangulate::ComputeArea(std::span<const float2>(points));
+    EXPECT_GT(area, 0.0);
+
+    Triangulate triangulate;
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<u32> indices;
+        ASSERT_TRUE(triangulate({points, {}}, indices));
+        EXPECT_EQ(indices.size(), (points.size() - 2) * 3);
+        EXPECT_NEAR(TriangulatedArea(points, indices), area, 1e-6 * area);
+
+        std::reverse(points.begin(), points.end());
+    }
+}
+
+TEST(TriangulateTest, CombWithHoles)
+{
+    // 下方开口的梳子形状：产生大量分裂/合并顶点
+    std::vector<float2> points;
+    const u32 teeth = 20;
+    points.emplace_back(0.f, 0.f);
+    for (u32 i = 0; i < teeth; ++i) {
+        const auto x = f32(i) * 2.f;
+        points.emplace_back(x + 1.f, 0.f);
+        points.emplace_back(x + 1.f, 3.f);
+        points.emplace_back(x + 2.f, 3.f);
+        points.emplace_back(x + 2.f, 0.f);
+    }
+    points.emplace_back(f32(teeth) * 2.f + 1.f, 0.f);
+    points.emplace_back(f32(teeth) * 2.f + 1.f, 6.f);
+    points.emplace_back(0.f, 6.f);
+
+    std::vector<u32> ringEnds = {cast_to<u32>(points.size())};
+    f64 holeArea              = 0;
+
+    // 梳背上的方形孔洞
+    for (u32 i = 0; i < 5; ++i) {
+        const auto x = 1.f + f32(i) * 8.f;
+        points.insert(points.end(), {{x, 4.f}, {x + 1.5f, 4.f}, {x + 1.5f, 5.f}, {x, 5.f}});
+        ringEnds.push_back(cast_to<u32>(points.size()));
+        holeArea += 1.5;
+    }
+
+    const auto outerArea = Triangulate::ComputeArea(std::span<const float2>(points.data(), ringEnds[0]));
+
+    Triangulate triangulate;
+    std::vector<u32> indices;
+    ASSERT_TRUE(triangulate({points, ringEnds}, indices));
+
+    EXPECT_EQ(indices.size(), (points.size() - 2 + 2 * 5) * 3);
+    EXPECT_NEAR(TriangulatedArea(points, indices), outerArea - holeArea, 1e-6);
+}
+
+TEST(TriangulateTest, NearCollinearFan)
+{
+    // 远离原点的梳子，齿尖与齿根各自只差一个 ulp 左右：单调分解的对角线在同一顶点处形成近似共线的扇形
+    for (const f32 offset : {0.f, 1e3f, 1e5f}) {
+        std::vector<float2> points;
+        const u32 teeth = 64;
+        const auto ulp  = std::nextafter(offset + 1.f, 2.f * offset + 2.f) - (offset + 1.f);
+
+        points.emplace_back(offset, offset);
+        for (u32 i = 0; i < teeth; ++i) {
+            const auto x = offset + f32(i) * 2.f;
+            const auto d = f32(i % 3) * ulp;
+            points.emplace_back(x + 1.f, offset + d);
+            points.emplace_back(x + 1.f, offset + 3.f - d);
+            points.emplace_back(x + 2.f, offset + 3.f + d);
+            points.emplace_back(x + 2.f, offset - d);
+        }
+        points.emplace_back(offset + f32(teeth) * 2.f + 1.f, offset);
+        points.emplace_back(offset + f32(teeth) * 2.f + 1.f, offset + 6.f);
+        points.emplace_back(offset, offset + 6.f);
+
+        const auto area = Triangulate::ComputeArea(std::span<const float2>(points));
+
+        Triangulate triangulate;
+        std::vector<u32> indices;
+        ASSERT_TRUE(triangulate({points, {}}, indices)) << offset;
+        EXPECT_EQ(indices.size(), (points.size() - 2) * 3) << offset;
+        EXPECT_NEAR(TriangulatedArea(points, indices), area, 1e-6 * area) << offset;
+    }
+}
+
+TEST(TriangulateTest, SelfIntersectingFallsBack)
+{
+    // 自相交的领结形状无法单调分解，退化为耳切法后仍输出 n - 2 个三角形
+    const std::vector<float2> bowtie = {{0, 0}, {2, 2}, {2, 0}, {0, 2}, {-1, 1}};
+
+    Triangulate triangulate;
+    std::vector<u32> indices;
+    ASSERT_TRUE(triangulate({bowtie, {}}, indices));
+    EXPECT_EQ(indices.size(), 9u);
+
+    // 退化的多边形没有输出
+    const std::vector<float2> line = {{0, 0}, {1, 1}, {2, 2}};
+    indices.clear();
+    EXPECT_FALSE(triangulate({line, {}}, indices));
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST(TriangulateTest, DegenerateHoleFails)
+{
+    // 孔洞完全位于外边界之外：单调分解失败，耳切法也找不到桥接顶点，不应静默丢弃孔洞
+    const std::vector<float2> points = {{0, 0}, {4, 0}, {4, 4}, {0, 4}, {6, 1}, {7, 1}, {7, 2}, {6, 2}};
+    const std::vector<u32> ringEnds  = {4, 8};
+
+    Triangulate triangulate;
+    std::vector<u32> indices = {7, 7, 7};
+    EXPECT_FALSE(triangulate({points, ringEnds}, indices));
+    EXPECT_EQ(indices, (std::vector<u32>{7, 7, 7}));
+}
+
+TEST(TriangulateTest, Parallel)
+{
+    std::vector<std::vector<float2>> shapes;
+    for (u32 i = 0; i < 1000; ++i)
+        shapes.push_back(MakeStar(3 + i % 40, i));
+
+    std::vector<Polygon2D> polygons;
+    for (const auto& s : shapes)
+        polygons.push_back({s, {}});
+
+    std::vector<u32> indices, offsets;
+    ParallelTriangulate(polygons, indices, offsets);
+    ASSERT_EQ(offsets.size(), polygons.size() + 1);
+    EXPECT_EQ(offsets.back(), indices.size());
+
+    Triangulate triangulate;
+    for (size i = 0; i < polygons.size(); ++i) {
+        std::vector<u32> expected;
+        triangulate(polygons[i], expected);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), indices.begin() + offsets[i], indices.begin() + offsets[i + 1]));
+    }
+}
+
+TEST(TriangulateTest, InsideAndArea)
+{
+    const float2 a(0, 0), b(4, 0), c(0, 4);
+    EXPECT_TRUE(Triangulate::CheckInside(float2(1, 1), a, b, c));
+    EXPECT_TRUE(Triangulate::CheckInside(float2(1, 1), a, c, b));
+    EXPECT_TRUE(Triangulate::CheckInside(float2(2, 2), a, b, c));
+    EXPECT_FALSE(Triangulate::CheckInside(float2(3, 3), a, b, c));
+
+    PCG32 rng(3);
+    std::vector<float2> points(1000);
+    for (auto& p : points)
+        p = float2(rng.gen<f32>() * 6.f - 1.f, rng.gen<f32>() * 6.f - 1.f);
+
+    std::vector<u8> inside(points.size());
+    Triangulate::CheckInside(points, a, b, c, inside);
+    for (size i = 0; i < points.size(); ++i)
+        EXPECT_EQ(inside[i] != 0, Triangulate::CheckInside(points[i], a, b, c));
+
+    EXPECT_FLOAT_EQ(Triangulate::ComputeArea(a, b, c), 8.f);
+    EXPECT_FLOAT_EQ(Triangulate::ComputeArea(a, c, b), -8.f);
+
+    const std::vector<float3> positions = {{0, 0, 0}, {2, 0, 0}, {0, 0, 3}, {0, 5, 0}};
+    const std::vector<u32> tris         = {0, 1, 2, 0, 1, 3};
+    std::vector<f32> areas(2);
+    Triangulate::ComputeArea(positions, tris, areas);
+    EXPECT_FLOAT_EQ(areas[0], 3.f);
+    EXPECT_FLOAT_EQ(areas[1], 5.f);
+}
+
+namespace {
+
+BoxShape MakeBox(const float3& halfExtent, const quatf& rotation, const float3& position)
+{
+    return {aabb(-halfExtent, halfExtent),
+            transform<4, f32>(position,
+                              Rotate(rotation, float3(1, 0, 0)),
+                              Rotate(rotation, float3(0, 1, 0)),
+                              Rotate(rotation, float3(0, 0, 1)))};
+}
+
+} // namespace
+
+TEST(GjkTest, SphereSphere)
+{
+    const SphereShape a{float3(0, 0, 0), 1.f};
+    const SphereShape b{float3(3, 0, 0), 0.5f};
+
+    auto r = ConvexContact(a, b);
+    EXPECT_FALSE(r.intersect());
+    EXPECT_NEAR(r.distance, 1.5f, 1e-5f);
+    EXPECT_NEAR(r.normal.x, 1.f, 1e-5f);
+    EXPECT_NEAR(r.pointA.x, 1.f, 1e-5f);
+    EXPECT_NEAR(r.pointB.x, 2.5f, 1e-5f);
+    EXPECT_FALSE(ConvexIntersect(a, b));
+
+    const SphereShape c{float3(0, 1.2f, 0), 0.5f};
+    r = ConvexContact(a, c);
+    EXPECT_TRUE(r.intersect());
+    EXPECT_NEAR(r.distance, -0.3f, 1e-5f);
+    EXPECT_NEAR(r.normal.y, 1.f, 1e-5f);
+    EXPECT_TRUE(ConvexIntersect(a, c));
+}
+
+TEST(GjkTest, BoxPenetration)
+{
+    const auto a = MakeBox(float3(1), quatf{}, float3(0));
+    const auto b = MakeBox(float3(1), quatf{}, float3(1.5f, 0.2f, -0.1f));
+
+    const auto r = ConvexContact(a, b);
+    EXPECT_NEAR(r.distance, -0.5f, 1e-4f);
+    EXPECT_NEAR(r.normal.x, 1.f, 1e-4f);
+
+    // 绕 z 轴旋转 45° 的盒子以棱角接近另一个盒子
+    const auto c = MakeBox(float3(1), AngleAxis(kPi * 0.25f, float3(0, 0, 1)), float3(2.5f, 0, 0));
+    const auto s = ConvexContact(a, c);
+    EXPECT_NEAR(s.distance, 1.5f - std::sqrt(2.f), 1e-4f);
+    EXPECT_NEAR(s.pointB.x, 2.5f - std::sqrt(2.f), 1e-4f);
+}
+
+TEST(GjkTest, HullMatchesBox)
+{
+    const std::vector<float3> cube = {
+        {-1, -1, -1}, {1, -1, -1}, {-1, 1, -1}, {1, 1, -1}, {-1, -1, 1}, {1, -1, 1}, {-1, 1, 1}, {1, 1, 1},
+        { 0,  0,  0}, {0.5f, 0.2f, -0.3f}
+    };
+
+    PCG32 rng(11);
+    const auto randomQuat = [&]() {
+        const float3 axis(rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f, rng.gen<f32>() + 0.1f);
+        return AngleAxis(rng.gen<f32>() * 2.f * kPi, Normalize(axis));
+    };
+
+    for (i32 i = 0; i < 200; ++i) {
+        const auto qa = randomQuat(), qb = randomQuat();
+        const float3 pa(rng.gen<f32>() * 4.f - 2.f, rng.gen<f32>() * 4.f - 2.f, rng.gen<f32>() * 4.f - 2.f);
+        const float3 pb(rng.gen<f32>() * 4.f - 2.f, rng.gen<f32>() * 4.f - 2.f, rng.gen<f32>() * 4.f - 2.f);
+
+        const auto boxA = MakeBox(float3(1), qa, pa);
+        const auto boxB = MakeBox(float3(1), qb, pb);
+        const HullShape hullA{cube, qa, pa};
+        const HullShape hullB{cube, qb, pb};
+
+        const auto rb = ConvexContact(boxA, boxB);
+        const auto rh = ConvexContact(hullA, hullB);
+        EXPECT_NEAR(rb.distance, rh.distance, 1e-3f);
+        EXPECT_EQ(ConvexIntersect(boxA, boxB), rb.intersect());
+
+        // 法线方向上平移穿透深度后两者恰好分离
+        if (rb.intersect()) {
+            auto moved = boxB;
+            moved.xform = MakeBox(float3(1), qb, pb + rb.normal * (-rb.distance + 1e-2f)).xform;
+            EXPECT_FALSE(ConvexIntersect(boxA, moved));
+        }
+    }
+}
+
+TEST(GjkTest, HullCentroidAndTouching)
+{
+    // 第一个点位于凸包的角上，质心应为各点的平均值
+    const std::vector<float3> corner = {{0, 0, 0}, {2, 0, 0}, {0, 2, 0}, {0, 0, 2}, {2, 2, 2}};
+    const HullShape hull{corner, AngleAxis(kPi * 0.5f, float3(0, 0, 1)), float3(1, 0, 0)};
+    EXPECT_TRUE(Equal(hull.centroid(), float3(1, 0, 0) + Rotate(hull.rotation, float3(0.8f)), 1e-5f));
+
+    // 两个盒子的面恰好接触或只相隔一个 ulp，核心距离接近零时法线与距离仍然有效
+    const auto a = MakeBox(float3(1), quatf{}, float3(0));
+    for (const auto x : {2.f, std::nextafter(2.f, 3.f)}) {
+        const auto b = MakeBox(float3(1), quatf{}, float3(x, 0, 0));
+        const auto r = ConvexContact(a, b);
+        EXPECT_TRUE(std::isfinite(r.normal.x) && std::isfinite(r.normal.y) && std::isfinite(r.normal.z));
+        EXPECT_NEAR(Length(r.normal), 1.f, 1e-4f);
+        EXPECT_NEAR(r.distance, 0.f, 1e-4f);
+    }
+}
+
+TEST(GjkTest, CapsuleCrossing)
+{
+    // 两个胶囊的轴线相交，核心的 Minkowski 差退化为平面
+    const CapsuleShape a{float3(-2, 0, 0), float3(2, 0, 0), 0.5f};
+    const CapsuleShape b{float3(0, -2, 0.2f), float3(0, 2, 0.2f), 0.25f};
+
+    const auto r = ConvexContact(a, b);
+    EXPECT_TRUE(r.intersect());
+    EXPECT_NEAR(r.distance, 0.2f - 0.75f, 1e-3f);
+    EXPECT_NEAR(r.normal.z, 1.f, 1e-3f);
+
+    const CapsuleShape c{float3(0, -2, 1.f), float3(0, 2, 1.f), 0.25f};
+    const auto s = ConvexContact(a, c);
+    EXPECT_NEAR(s.distance, 0.25f, 1e-4f);
+    EXPECT_FALSE(ConvexIntersect(a, c));
+}
+
+TEST(GjkTest, WarmStartAndBatch)
+{
+    std::vector<ConvexShape> shapes;
+    PCG32 rng(5);
+    for (i32 i = 0; i < 64; ++i) {
+        const float3 p(rng.gen<f32>() * 10.f, rng.gen<f32>() * 10.f, rng.gen<f32>() * 10.f);
+        switch (i % 3) {
+            case 0 : shapes.emplace_back(SphereShape{p, 0.5f + rng.gen<f32>()}); break;
+            case 1 : shapes.emplace_back(CapsuleShape{p, p + float3(1, 1, 0), 0.4f}); break;
+            default: shapes.emplace_back(MakeBox(float3(0.8f), AngleAxis(rng.gen<f32>() * kPi, float3(0, 1, 0)), p)); break;
+        }
+    }
+
+    std::vector<ShapePair> pairs;
+    for (u32 i = 0; i < shapes.size(); ++i)
+        for (u32 j = i + 1; j < shapes.size(); ++j)
+            pairs.push_back({i, j});
+
+    std::vector<ContactResult> results(pairs.size());
+    std::vector<GjkCache> caches(pairs.size());
+    ParallelConvexContact(shapes, pairs, results, caches);
+
+    u32 coldIterations = 0;
+    for (size i = 0; i < pairs.size(); ++i) {
+        const auto expected = std::visit([](const auto& a, const auto& b) { return ConvexContact(a, b); },
+                                         shapes[pairs[i].a],
+                                         shapes[pairs[i].b]);
+        EXPECT_NEAR(results[i].distance, expected.distance, 1e-4f);
+        coldIterations += results[i].iterations;
+    }
+
+    // 位姿不变时从缓存热启动，结果一致且迭代次数更少
+    std::vector<ContactResult> warm(pairs.size());
+    ParallelConvexContact(shapes, pairs, warm, caches);
+
+    u32 warmIterations = 0;
+    for (size i = 0; i < pairs.size(); ++i) {
+        EXPECT_NEAR(warm[i].distance, results[i].distance, 1e-4f);
+        warmIterations += warm[i].iterations;
+    }
+    EXPECT_LT(warmIterations, coldIterations);
+
+    std::vector<u8> overlap(pairs.size());
+    ParallelConvexIntersect(shapes, pairs, overlap);
+    for (size i = 0; i < pairs.size(); ++i)
+        EXPECT_EQ(overlap[i] != 0, results[i].intersect());
+}
+
+namespace {
+
+std::vector<BroadphasePair> BruteForcePairs(const SweepAndPrune& sap, const std::vector<u32>& ids)
+{
+    std::vector<BroadphasePair> pairs;
+    for (size i = 0; i < ids.size(); ++i) {
+        for (size j = i + 1; j < ids.size(); ++j) {
+            if (sap.box(ids[i]).overlaps(sap.box(ids[j])))
+                pairs.push_back({Min(ids[i], ids[j]), Max(ids[i], ids[j])});
+        }
+    }
+    std::sort(pairs.begin(), pairs.end(), [](const auto& l, const auto& r) { return l.key() < r.key(); });
+    return pairs;
+}
+
+} // namespace
+
+TEST(SweepAndPruneTest, IncrementalMatchesBruteForce)
+{
+    PCG32 rng(9);
+    SweepAndPrune sap;
+
+    std::vector<u32> ids;
+    std::vector<float3> velocity;
+    const auto randomBox = [&](const float3& c) {
+        const float3 h(0.2f + rng.gen<f32>(), 0.2f + rng.gen<f32>(), 0.2f + rng.gen<f32>());
+        return aabb(c - h, c + h);
+    };
+
+    for (u32 i = 0; i < 400; ++i) {
+        const float3 c(rng.gen<f32>() * 40.f, rng.gen<f32>() * 10.f, rng.gen<f32>() * 10.f);
+        ids.push_back(sap.add(randomBox(c)));
+        velocity.emplace_back(rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f);
+    }
+
+    auto delta = sap.commit();
+    EXPECT_TRUE(delta.removed.empty());
+    EXPECT_EQ(sap.axis(), 0);
+    EXPECT_EQ(delta.added.size(), sap.pairs().size());
+
+    std::vector<BroadphasePair> previous(sap.pairs().begin(), sap.pairs().end());
+    EXPECT_EQ(previous, BruteForcePairs(sap, ids));
+
+    for (u32 frame = 0; frame < 30; ++frame) {
+        for (size i = 0; i < ids.size(); ++i) {
+            auto b      = sap.box(ids[i]);
+            b.minPoint += velocity[i] * 0.3f;
+            b.maxPoint += velocity[i] * 0.3f;
+            sap.update(ids[i], b);
+        }
+
+        // 每帧移除一部分代理并添加新的代理
+        for (u32 k = 0; k < 5; ++k) {
+            const auto victim = rng.gen<u32>() % ids.size();
+            sap.remove(ids[victim]);
+            ids.erase(ids.begin() + victim);
+            velocity.erase(velocity.begin() + victim);
+        }
+        for (u32 k = 0; k < 5; ++k) {
+            ids.push_back(sap.add(randomBox(float3(rng.gen<f32>() * 40.f, rng.gen<f32>() * 10.f, rng.gen<f32>() * 10.f))));
+            velocity.emplace_back(rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f);
+        }
+
+        // 同一帧内添加又移除的代理不产生任何重叠对
+        sap.remove(sap.add(randomBox(float3(20, 5, 5))));
+
+        delta = sap.commit();
+        EXPECT_EQ(sap.count(), ids.size());
+
+        const auto expected = BruteForcePairs(sap, ids);
+        const std::vector<BroadphasePair> current(sap.pairs().begin(), sap.pairs().end());
+        EXPECT_EQ(current, expected);
+
+        // 上一帧的重叠对加上变化量即为当前的重叠对
+        std::vector<BroadphasePair> applied;
+        for (const auto& p : previous) {
+            if (std::find(delta.removed.begin(), delta.removed.end(), p) == delta.removed.end())
+                applied.push_back(p);
+        }
+        applied.insert(applied.end(), delta.added.begin(), delta.added.end());
+        std::sort(applied.begin(), applied.end(), [](const auto& l, const auto& r) { return l.key() < r.key(); });
+        EXPECT_EQ(applied, current);
+
+        previous = current;
+    }
+}
+
+TEST(SweepAndPruneTest, SwitchesAxisByVariance)
+{
+    SweepAndPrune sap;
+    std::vector<u32> ids;
+    for (u32 i = 0; i < 100; ++i)
+        ids.push_back(sap.add(aabb(float3(0, f32(i), 0), float3(1, f32(i) + 1.5f, 1))));
+
+    sap.commit();
+    EXPECT_EQ(sap.axis(), 1);
+    EXPECT_EQ(sap.box(ids[0]).longestAxis(), 1);
+    EXPECT_EQ(sap.pairs().size(), 99u);
+
+    // 沿 z 轴展开后，排序轴切换到 z，重叠对全部消失
+    for (u32 i = 0; i < ids.size(); ++i)
+        sap.update(ids[i], aabb(float3(0, 0, f32(i) * 3), float3(1, 1, f32(i) * 3 + 1)));
+
+    const auto& delta = sap.commit();
+    EXPECT_EQ(sap.axis(), 2);
+    EXPECT_TRUE(sap.pairs().empty());
+    EXPECT_EQ(delta.removed.size(), 99u);
+    EXPECT_TRUE(delta.added.empty());
+}
+
+TEST(ClosestPointTest, BoundsDistance)
+{
+    const aabb a(float3(0), float3(1));
+    const aabb b(float3(3, 0, 0), float3(4, 1, 1));
+    EXPECT_FLOAT_EQ(DistanceSqr(a, b), 4.f);
+    EXPECT_FLOAT_EQ(DistanceSqr(b, a), 4.f);
+    EXPECT_FLOAT_EQ(DistanceSqr(a, float3(2, 2, 0.5f)), 2.f);
+    EXPECT_FLOAT_EQ(DistanceSqr(a, float3(0.5f)), 0.f);
+}
+
+TEST(ClosestPointTest, TriangleAndBatch)
+{
+    PCG32 rng(11);
+    const auto rand3 = [&] { return float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 4.f - 2.f; };
+
+    constexpr size n = 2000;
+    std::vector<f32> buf(n * 15);
+    const auto column = [&](size k) { return std::span<f32>(buf.data() + k * n, n); };
+    const Float3SoA<f32> p(column(0), column(1), column(2)), a(column(3), column(4), column(5));
+    const Float3SoA<f32> b(column(6), column(7), column(8)), c(column(9), column(10), column(11));
+    const Float3SoA<f32> out(column(12), column(13), column(14));
+
+    for (size i = 0; i < n; ++i) {
+        p.store(i, rand3());
+        a.store(i, rand3());
+        b.store(i, rand3());
+        // 一部分三角形退化为线段
+        c.store(i, i % 10 == 0 ? (a[i] + b[i]) * 0.5f : rand3());
+    }
+
+    ParallelClosestPointOnTriangle(p, a, b, c, out);
+
+    for (size i = 0; i < n; ++i) {
+        float3 uvw;
+        const auto q = ClosestPointOnTriangle(p[i], a[i], b[i], c[i], uvw);
+        EXPECT_NEAR(uvw.x + uvw.y + uvw.z, 1.f, 1e-5f);
+        EXPECT_TRUE(Equal(a[i] * uvw.x + b[i] * uvw.y + c[i] * uvw.z, q, 1e-4f));
+        EXPECT_NEAR(Length(p[i] - out[i]), Length(p[i] - q), 1e-4f);
+
+        // 最近点不比三角形上的任何采样点远
+        const auto d = LengthSqr(p[i] - q);
+        for (i32 s = 0; s < 16; ++s) {
+            auto u = rng.gen<f32>(), v = rng.gen<f32>();
+            if (u + v > 1.f)
+                u = 1.f - u, v = 1.f - v;
+            EXPECT_LE(d, LengthSqr(p[i] - (a[i] + (b[i] - a[i]) * u + (c[i] - a[i]) * v)) + 1e-5f);
+        }
+    }
+}
+
+TEST(ClosestPointTest, SegmentsAndBatch)
+{
+    // 平行与退化的情况
+    auto r = ClosestPointsOnSegments(float3(0, 0, 0), float3(2, 0, 0), float3(1, 1, 0), float3(3, 1, 0));
+    EXPECT_FLOAT_EQ(r.distanceSqr, 1.f);
+
+    r = ClosestPointsOnSegments(float3(0, 0, 0), float3(2, 0, 0), float3(3, 1, 0), float3(3, 1, 0));
+    EXPECT_TRUE(Equal(r.pointA, float3(2, 0, 0), 1e-6f));
+    EXPECT_FLOAT_EQ(r.distanceSqr, 2.f);
+
+    r = ClosestPointsOnSegments(float3(1, 2, 0), float3(1, 2, 0), float3(0, 0, 0), float3(4, 0, 0));
+    EXPECT_TRUE(Equal(r.pointB, float3(1, 0, 0), 1e-6f));
+
+    PCG32 rng(5);
+    const auto rand3 = [&] { return float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 4.f - 2.f; };
+
+    constexpr size n = 1000;
+    std::vector<f32> buf(n * 18);
+    const auto column = [&](size k) { return std::span<f32>(buf.data() + k * n, n); };
+    const Float3SoA<f32> p1(column(0), column(1), column(2)), q1(column(3), column(4), column(5));
+    const Float3SoA<f32> p2(column(6), column(7), column(8)), q2(column(9), column(10), column(11));
+    const Float3SoA<f32> outA(column(12), column(13), column(14)), outB(column(15), column(16), column(17));
+
+    for (size i = 0; i < n; ++i) {
+        p1.store(i, rand3());
+        q1.store(i, rand3());
+        p2.store(i, rand3());
+        q2.store(i, rand3());
+    }
+
+    ParallelClosestPointsOnSegments(p1, q1, p2, q2, outA, outB);
+
+    for (size i = 0; i < n; ++i) {
+        const auto s = ClosestPointsOnSegments(p1[i], q1[i], p2[i], q2[i]);
+        EXPECT_NEAR(LengthSqr(outA[i] - outB[i]), s.distanceSqr, 1e-5f);
+
+        f32 best = kInfinity;
+        for (i32 u = 0; u <= 32; ++u)
+            for (i32 v = 0; v <= 32; ++v)
+                best = Min(best, LengthSqr(Lerp(p1[i], q1[i], u / 32.f) - Lerp(p2[i], q2[i], v / 32.f)));
+        EXPECT_LE(s.distanceSqr, best + 1e-5f);
+    }
+}
+
+TEST(ClosestPointTest, OrientedBox)
+{
+    const auto rotation = AngleAxis(kPi * 0.3f, Normalize(float3(1, 2, 3)));
+    const obb box(float3(1, -2, 0.5f), Mat3Cast(rotation), float3(0.5f, 1.f, 2.f));
+
+    PCG32 rng(3);
+    constexpr size n = 500;
+    std::vector<f32> buf(n * 6);
+    const auto column = [&](size k) { return std::span<f32>(buf.data() + k * n, n); };
+    const Float3SoA<f32> points(column(0), column(1), column(2)), out(column(3), column(4), column(5));
+
+    for (size i = 0; i < n; ++i)
+        points.store(i, box.center + float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 8.f - 4.f);
+
+    ParallelClosestPoint(box, points, out);
+
+    for (size i = 0; i < n; ++i) {
+        // 旋转回包围盒的局部坐标后即为 aabb 的最近点
+        const auto local = Rotate(Conjugate(rotation), points[i] - box.center);
+        const auto q     = box.center + Rotate(rotation, ClosestPoint(aabb(-box.halfExtents, box.halfExtents), local));
+
+        EXPECT_TRUE(Equal(out[i], q, 1e-4f));
+        EXPECT_NEAR(DistanceSqr(box, points[i]), LengthSqr(points[i] - q), 1e-3f);
+    }
+}
+
+TEST(ClosestPointTest, MeshMatchesBruteForce)
+{
+    // 起伏的网格面
+    constexpr u32 res = 24;
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    for (u32 y = 0; y <= res; ++y)
+        for (u32 x = 0; x <= res; ++x)
+            positions.emplace_back(f32(x) / res, f32(y) / res, 0.1f * std::sin(f32(x) * 0.7f) * std::cos(f32(y) * 0.5f));
+    for (u32 y = 0; y < res; ++y) {
+        for (u32 x = 0; x < res; ++x) {
+            const auto i = y * (res + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + res + 2, i, i + res + 2, i + res + 1});
+        }
+    }
+
+    const TriangleSoA mesh(indices, positions);
+    EXPECT_EQ(mesh.count(), indices.size() / 3);
+
+    PCG32 rng(9);
+    constexpr size n = 300;
+    std::vector<f32> buf(n * 6);
+    std::vector<u32> triangles(n);
+    const auto column = [&](size k) { return std::span<f32>(buf.data() + k * n, n); };
+    const Float3SoA<f32> points(column(0), column(1), column(2)), out(column(3), column(4), column(5));
+
+    for (size i = 0; i < n; ++i)
+        points.store(i, float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 1.6f - 0.3f);
+
+    ParallelClosestPointOnMesh(mesh, points, out, triangles);
+
+    for (size i = 0; i < n; ++i) {
+        const auto expected = ClosestPointOnMesh(indices, positions, points[i]);
+        ASSERT_TRUE(expected.valid());
+        ASSERT_LT(triangles[i], indices.size() / 3);
+        EXPECT_NEAR(LengthSqr(points[i] - out[i]), expected.distanceSqr, 1e-5f);
+
+        const auto t = triangles[i];
+        EXPECT_NEAR(DistanceSqrToTriangle(points[i], positions[indices[t * 3]], positions[indices[t * 3 + 1]], positions[indices[t * 3 + 2]]),
+                    expected.distanceSqr, 1e-5f);
+    }
+
+    // 超出最大距离时没有结果
+    EXPECT_FALSE(mesh.closestPoint(float3(0.5f, 0.5f, 5.f), 1.f).valid());
+}
+
+namespace {
+
+using i128 = __int128;
+
+/// 以整数坐标精确计算的参考行列式符号
+i32 SignOf(i128 v) { return v > 0 ? 1 : (v < 0 ? -1 : 0); }
+
+i32 SignOf(f64 v) { return i32(Sign(v)); }
+
+} // namespace
+
+TEST(PredicatesTest, Orient2DNearlyCollinear)
+{
+    PCG32 rng(21);
+    const auto coord = [&] { return i64(rng.gen<u32>() % (1u << 22)) - (1 << 21); };
+
+    // 所有坐标同乘 2 的幂不改变符号，用于覆盖非整数的情况
+    for (const auto scale : {1.f, 0x1p-40f}) {
+        for (i32 i = 0; i < 20000; ++i) {
+            const i64 ax = coord(), ay = coord(), bx = coord(), by = coord();
+            const auto t   = rng.gen<f32>();
+            const i64 cx = ax + i64((bx - ax) * t) + i64(rng.gen<u32>() % 3) - 1;
+            const i64 cy = ay + i64((by - ay) * t) + i64(rng.gen<u32>() % 3) - 1;
+
+            const auto a = float2(f32(ax), f32(ay)) * scale;
+            const auto b = float2(f32(bx), f32(by)) * scale;
+            const auto c = float2(f32(cx), f32(cy)) * scale;
+            const auto expected = SignOf(i128(ax - cx) * (by - cy) - i128(ay - cy) * (bx - cx));
+            ASSERT_EQ(SignOf(Orient2D(a, b, c)), expected);
+        }
+    }
+
+    EXPECT_EQ(Orient2D(float2(0, 0), float2(1, 1), float2(3, 3)), 0.0);
+    EXPECT_GT(Orient2D(float2(0, 0), float2(1, 0), float2(0, 1)), 0.0);
+    EXPECT_LT(Orient2D(float2(0, 0), float2(0, 1), float2(1, 0)), 0.0);
+
+    // 坐标量级相差很大时双精度的坐标差也不再精确
+    EXPECT_EQ(Orient2D(float2(1e30f, 1e30f), float2(-1e-30f, -1e-30f), float2(0, 0)), 0.0);
+    EXPECT_LT(Orient2D(float2(1e30f, 1e30f), float2(0, 0), float2(-1e-30f, 0)), 0.0);
+}
+
+TEST(PredicatesTest, Orient3DNearlyCoplanar)
+{
+    PCG32 rng(22);
+    const auto coord = [&] { return i64(rng.gen<u32>() % (1u << 20)) - (1 << 19); };
+
+    for (i32 i = 0; i < 20000; ++i) {
+        std::array<i64, 3> p[4];
+        for (i32 k = 0; k < 3; ++k)
+            for (auto& c : p[k])
+                c = coord();
+
+        // 第四个点取前三个点的近似仿射组合
+        const auto u = rng.gen<f32>(), v = rng.gen<f32>();
+        for (i32 j = 0; j < 3; ++j)
+            p[3][j] = p[0][j] + i64((p[1][j] - p[0][j]) * u) + i64((p[2][j] - p[0][j]) * v) + i64(rng.gen<u32>() % 3) - 1;
+
+        i128 d[3][3];
+        for (i32 k = 0; k < 3; ++k)
+            for (i32 j = 0; j < 3; ++j)
+                d[k][j] = p[k][j] - p[3][j];
+        const auto det = d[0][0] * (d[1][1] * d[2][2] - d[1][2] * d[2][1]) - d[0][1] * (d[1][0] * d[2][2] - d[1][2] * d[2][0])
+                       + d[0][2] * (d[1][0] * d[2][1] - d[1][1] * d[2][0]);
+
+        const auto f = [&](i32 k) { return float3(f32(p[k][0]), f32(p[k][1]), f32(p[k][2])); };
+        ASSERT_EQ(SignOf(Orient3D(f(0), f(1), f(2), f(3))), SignOf(det));
+    }
+
+    // d 在逆时针三角形 abc 下方时为正
+    EXPECT_GT(Orient3D(float3(0, 0, 0), float3(1, 0, 0), float3(0, 1, 0), float3(0, 0, -1)), 0.0);
+    EXPECT_EQ(Orient3D(float3(0, 0, 0), float3(1, 0, 0), float3(0, 1, 0), float3(5, 7, 0)), 0.0);
+}
+
+TEST(PredicatesTest, InCircleCocircular)
+{
+    // 整数网格上大量四点共圆的情况
+    for (i32 y = -3; y <= 3; ++y) {
+        for (i32 x = -3; x <= 3; ++x) {
+            const float2 a(0, 0), b(4, 0), c(4, 4);
+            const auto d = float2(f32(x), f32(y));
+
+            // 以 (2, 2) 为圆心、半径平方 8 的圆
+            const auto r = (x - 2) * (x - 2) + (y - 2) * (y - 2);
+            EXPECT_EQ(SignOf(InCircle(a, b, c, d)), r < 8 ? 1 : (r > 8 ? -1 : 0));
+            EXPECT_EQ(SignOf(InCircle(a, c, b, d)), r < 8 ? -1 : (r > 8 ? 1 : 0));
+        }
+    }
+
+    PCG32 rng(23);
+    const auto coord = [&] { return i64(rng.gen<u32>() % (1u << 16)) - (1 << 15); };
+    for (i32 i = 0; i < 20000; ++i) {
+        i64 p[4][2];
+        for (auto& q : p)
+            for (auto& c : q)
+                c = coord();
+
+        // 将 d 放在 a 关于 bc 中垂线的镜像附近，使其接近外接圆
+        if (i % 2 == 0) {
+            p[3][0] = p[1][0] + p[2][0] - p[0][0] + i64(rng.gen<u32>() % 3) - 1;
+            p[3][1] = p[1][1] + p[2][1] - p[0][1] + i64(rng.gen<u32>() % 3) - 1;
+        }
+
+        i128 m[3][3];
+        for (i32 k = 0; k < 3; ++k) {
+            const i128 dx = p[k][0] - p[3][0], dy = p[k][1] - p[3][1];
+            m[k][0] = dx;
+            m[k][1] = dy;
+            m[k][2] = dx * dx + dy * dy;
+        }
+        const auto det = m[0][2] * (m[1][0] * m[2][1] - m[2][0] * m[1][1]) + m[1][2] * (m[2][0] * m[0][1] - m[0][0] * m[2][1])
+                       + m[2][2] * (m[0][0] * m[1][1] - m[1][0] * m[0][1]);
+
+        const auto f = [&](i32 k) { return float2(f32(p[k][0]), f32(p[k][1])); };
+        ASSERT_EQ(SignOf(InCircle(f(0), f(1), f(2), f(3))), SignOf(det));
+    }
+}
+
+namespace {
+
+/// 检查三角剖分是合法的 (约束) Delaunay 剖分，返回三角形面积之和
+f64 CheckDelaunay(const Delaunay& dt, const std::vector<float2>& points)
+{
+    const auto idx = dt.indices();
+
+    std::unordered_map<u64, u32> edges; // 有向边 -> 对顶点
+    std::unordered_set<u32> used;
+    f64 area = 0;
+    for (size t = 0; t < idx.size(); t += 3) {
+        const auto& a = points[idx[t]];
+        const auto& b = points[idx[t + 1]];
+        const auto& c = points[idx[t + 2]];
+        EXPECT_GT(Orient2D(a, b, c), 0);
+        area += 0.5 * Orient2D(a, b, c);
+
+        for (u32 k = 0; k < 3; ++k) {
+            const auto u = idx[t + k], v = idx[t + (k + 1) % 3];
+            EXPECT_TRUE(edges.emplace((u64(u) << 32) | v, idx[t + (k + 2) % 3]).second);
+            used.insert(u);
+        }
+    }
+
+    size boundary = 0;
+    for (const auto& [key, opposite] : edges) {
+        const auto u = u32(key >> 32), v = u32(key);
+        const auto it = edges.find((u64(v) << 32) | u);
+        if (it == edges.end()) {
+            ++boundary;
+            continue;
+        }
+        if (!dt.isConstrained(u, v)) {
+            EXPECT_LE(InCircle(points[u], points[v], points[opposite], points[it->second]), 0);
+        }
+    }
+
+    // 平面三角剖分的欧拉公式：T = 2n - 2 - h
+    EXPECT_EQ(dt.triangleCount(), 2 * used.size() - 2 - boundary);
+    return area;
+}
+
+} // namespace
+
+TEST(DelaunayTest, RandomPointsWithDuplicates)
+{
+    PCG32 rng(31);
+    std::vector<float2> points;
+    for (i32 i = 0; i < 20000; ++i)
+        points.emplace_back(rng.gen<f32>(), rng.gen<f32>());
+    for (i32 i = 0; i < 100; ++i)
+        points.push_back(points[rng.gen<u32>() % 20000]);
+
+    Delaunay dt;
+    EXPECT_TRUE(dt.build(points));
+    CheckDelaunay(dt, points);
+
+    for (u32 i = 20000; i < points.size(); ++i) {
+        const auto v = dt.vertexMap()[i];
+        EXPECT_LT(v, i);
+        EXPECT_TRUE(all_eq(points[v], points[i]));
+    }
+}
+
+TEST(DelaunayTest, CocircularAndCollinear)
+{
+    // 网格上每个单元的四个点都共圆
+    std::vector<float2> grid;
+    for (i32 y = 0; y < 32; ++y)
+        for (i32 x = 0; x < 32; ++x)
+            grid.emplace_back(f32(x), f32(y));
+
+    Delaunay dt;
+    EXPECT_TRUE(dt.build(grid));
+    EXPECT_EQ(dt.triangleCount(), 2u * 31 * 31);
+    EXPECT_DOUBLE_EQ(CheckDelaunay(dt, grid), 31.0 * 31.0);
+
+    std::vector<float2> line;
+    for (i32 i = 0; i < 10; ++i)
+        line.emplace_back(f32(i), 2.f * f32(i));
+    EXPECT_TRUE(dt.build(line));
+    EXPECT_EQ(dt.triangleCount(), 0u);
+
+    // 共线的点加上一个点，所有点都在凸包边界上
+    line.emplace_back(0.f, 5.f);
+    EXPECT_TRUE(dt.build(line));
+    EXPECT_EQ(dt.triangleCount(), 9u);
+    CheckDelaunay(dt, line);
+}
+
+TEST(DelaunayTest, ConstraintsAreRecovered)
+{
+    PCG32 rng(37);
+    std::vector<float2> points;
+    for (i32 i = 0; i < 2000; ++i)
+        points.emplace_back(rng.gen<f32>(), rng.gen<f32>());
+
+    // 互相平行的长线段穿过大量三角形，最后一条与它们都相交
+    std::vector<uint2> constraints;
+    const auto addSegment = [&](const float2& a, const float2& b) {
+        constraints.emplace_back(u32(points.size()), u32(points.size() + 1));
+        points.push_back(a);
+        points.push_back(b);
+    };
+    for (i32 k = 0; k < 4; ++k)
+        addSegment(float2(0.05f, 0.1f + 0.2f * f32(k)), float2(0.95f, 0.15f + 0.2f * f32(k)));
+    addSegment(float2(0.5f, 0.02f), float2(0.5f, 0.98f));
+
+    Delaunay dt;
+    EXPECT_FALSE(dt.build(points, constraints));
+    EXPECT_EQ(dt.skippedConstraints(), 1u);
+    CheckDelaunay(dt, points);
+    for (size k = 0; k < 4; ++k)
+        EXPECT_TRUE(dt.isConstrained(constraints[k].x, constraints[k].y));
+
+    // 经过网格顶点的约束边会在这些顶点处拆开
+    std::vector<float2> grid;
+    for (i32 y = 0; y < 16; ++y)
+        for (i32 x = 0; x < 16; ++x)
+            grid.emplace_back(f32(x), f32(y));
+
+    const auto at = [](u32 x, u32 y) { return y * 16 + x; };
+    const std::vector<uint2> gridConstraints = {{at(0, 0), at(15, 15)}, {at(1, 0), at(15, 11)}};
+    EXPECT_TRUE(dt.build(grid, gridConstraints));
+    EXPECT_DOUBLE_EQ(CheckDelaunay(dt, grid), 15.0 * 15.0);
+    for (u32 i = 0; i < 15; ++i)
+        EXPECT_TRUE(dt.isConstrained(at(i, i), at(i + 1, i + 1)));
+    EXPECT_TRUE(dt.isConstrained(at(1, 0), at(15, 11)));
+}
+
+TEST(DelaunayTest, DomainCoversRect)
+{
+    PCG32 rng(41);
+    std::vector<float2> points;
+    for (i32 i = 0; i < 5000; ++i)
+        points.emplace_back(3.f * rng.gen<f32>() - 1.f, 3.f * rng.gen<f32>() - 1.f);
+
+    const rect domain(float2(0.f), float2(1.f));
+    Delaunay dt;
+    EXPECT_TRUE(dt.build(points, {}, domain));
+
+    auto all = points;
+    for (i32 c = 0; c < 4; ++c)
+        all.push_back(domain.corner(c));
+    EXPECT_NEAR(CheckDelaunay(dt, all), 1.0, 1e-6);
+
+    for (size i = 0; i < points.size(); ++i)
+        EXPECT_EQ(dt.vertexMap()[i] == Delaunay::kInvalid, !domain.contains(points[i]));
+}
+
+namespace {
+
+/// 双精度下求最近的交点作为参考
+f64 RaySphereReference(const Ray& ray, const float3& c, f32 r)
+{
+    const auto d  = Normalize(ray.dir);
+    const f64 fx  = f64(c.x) - ray.origin.x, fy = f64(c.y) - ray.origin.y, fz = f64(c.z) - ray.origin.z;
+    const f64 b   = fx * d.x + fy * d.y + fz * d.z;
+    const f64 lx  = fx - b * d.x, ly = fy - b * d.y, lz = fz - b * d.z;
+    const f64 disc = f64(r) * r - (lx * lx + ly * ly + lz * lz);
+    if (disc < 0)
+        return kInfinity;
+
+    const auto s = std::sqrt(disc);
+    const auto t = b - s >= ray.tMin ? b - s : b + s;
+    return t >= ray.tMin && t < ray.tMax ? t : kInfinity;
+}
+
+} // namespace
+
+TEST(SphereSoATest, NearestMatchesReference)
+{
+    PCG32 rng(43);
+    SphereSoA spheres;
+    for (i32 i = 0; i < 10007; ++i) {
+        const float3 c(rng.gen<f32>() * 100.f - 50.f, rng.gen<f32>() * 100.f - 50.f, rng.gen<f32>() * 100.f - 50.f);
+        spheres.push(c, 0.05f + rng.gen<f32>() * 0.5f);
+    }
+
+    std::vector<Ray> rays;
+    for (i32 i = 0; i < 64; ++i) {
+        // 一部分射线从球内出发，应当得到离开球的交点
+        const auto origin = i % 8 == 0 ? spheres.center(rng.gen<u32>() % spheres.count())
+                                       : float3(rng.gen<f32>() * 100.f - 50.f, rng.gen<f32>() * 100.f - 50.f, -60.f);
+        const float3 dir(rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f, 1.f);
+        rays.emplace_back(origin, dir * 3.f, 0.f, i % 4 == 0 ? 40.f : kInfinity);
+    }
+
+    std::vector<RaySphereHit> packet(rays.size());
+    ParallelIntersect(spheres, rays, packet);
+
+    size hits = 0;
+    for (size i = 0; i < rays.size(); ++i) {
+        f64 best = kInfinity;
+        for (size s = 0; s < spheres.count(); ++s)
+            best = std::min(best, RaySphereReference(rays[i], spheres.center(s), spheres.radius(s)));
+
+        const auto hit = spheres.intersect(rays[i]);
+        EXPECT_EQ(hit.index, packet[i].index);
+        if (best == kInfinity) {
+            EXPECT_FALSE(hit.valid());
+            continue;
+        }
+
+        ++hits;
+        ASSERT_TRUE(hit.valid());
+        EXPECT_NEAR(hit.t, best, 1e-3 * (1.0 + best));
+        EXPECT_NEAR(RaySphereReference(rays[i], spheres.center(hit.index), spheres.radius(hit.index)), best, 1e-3 * (1.0 + best));
+    }
+    EXPECT_GT(hits, 16u);
+}
+
+TEST(SphereSoATest, AllHitsIntoBuffer)
+{
+    // 沿 x 轴排成一列的球，tMax 截掉了最后两个
+    SphereSoA spheres;
+    for (i32 i = 0; i < 100; ++i)
+        spheres.push(float3(f32(i) * 2.f, 0.f, 0.f), 0.5f);
+    spheres.push(float3(0.f, 10.f, 0.f), 0.5f);
+
+    const Ray ray(float3(-5.f, 0.f, 0.f), float3(1.f, 0.f, 0.f), 0.f, 100.f);
+
+    std::vector<RaySphereHit> out(64);
+    EXPECT_EQ(spheres.intersectAll(ray, out), 48u);
+    for (u32 i = 0; i < 48; ++i) {
+        EXPECT_EQ(out[i].index, i);
+        EXPECT_NEAR(out[i].t, 4.5f + 2.f * f32(i), 1e-5f);
+    }
+
+    // 缓冲区不够时只写入前面的部分，但仍返回总数
+    std::vector<RaySphereHit> small(8);
+    EXPECT_EQ(spheres.intersectAll(ray, small), 48u);
+    EXPECT_EQ(small.back().index, 7u);
+
+    const auto nearest = spheres.intersect(ray);
+    EXPECT_EQ(nearest.index, 0u);
+    EXPECT_NEAR(nearest.t, 4.5f, 1e-5f);
+
+    spheres.set(0, float3(0.f, 5.f, 0.f), 0.5f);
+    EXPECT_EQ(spheres.intersect(ray).index, 1u);
+}
+
+TEST(ObbTest, FitRotatedPointCloud)
+{
+    PCG32 rng(47);
+    const auto rotation = Normalize(quatf(0.8f, 0.3f, -0.4f, 0.2f));
+    const obb truth(float3(3.f, -1.f, 2.f), rotation, float3(4.f, 1.f, 0.25f));
+
+    std::vector<float3> points;
+    for (i32 i = 0; i < 4000; ++i)
+        points.push_back(truth.toWorld((float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 2.f - 1.f) * truth.halfExtents));
+    for (i32 c = 0; c < 8; ++c)
+        points.push_back(truth.corner(c));
+
+    const auto fit = FitOBB(points);
+    for (const auto& p : points)
+        EXPECT_LT(LengthSqr(fit.toLocal(p) - Clamp(fit.toLocal(p), -fit.halfExtents, fit.halfExtents)), 1e-8f);
+    EXPECT_LT(Volume(fit), Volume(truth) * 1.1f);
+    EXPECT_NEAR(Determinant(fit.axes), 1.f, 1e-5f);
+
+    // 旋转后的盒子用 obb 表示远比 aabb 紧
+    const auto box = ToAABB(fit);
+    for (i32 c = 0; c < 8; ++c)
+        EXPECT_TRUE(aabb(box.minPoint - 1e-4f, box.maxPoint + 1e-4f).contains(fit.corner(c)));
+    EXPECT_GT(Volume(box), Volume(fit) * 2.f);
+
+    // 与坐标轴对齐的点集直接返回 aabb
+    std::vector<float3> cube;
+    for (i32 c = 0; c < 8; ++c)
+        cube.push_back(aabb(float3(-1, -2, -3), float3(1, 2, 3)).corner(c));
+    const auto aligned = FitOBB(cube);
+    EXPECT_NEAR(Volume(aligned), 48.f, 1e-4f);
+}
+
+TEST(ObbTest, OverlapMatchesGjk)
+{
+    PCG32 rng(53);
+    const auto randomRotation = [&] {
+        return Normalize(quatf(rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f));
+    };
+    const auto randomExtent = [&] { return float3(0.2f + rng.gen<f32>(), 0.2f + rng.gen<f32>(), 0.2f + rng.gen<f32>()); };
+
+    size overlapping = 0;
+    for (i32 i = 0; i < 2000; ++i) {
+        const auto qa = randomRotation(), qb = randomRotation();
+        const auto ea = randomExtent(), eb = randomExtent();
+        const float3 ca(0.f), cb((float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 2.f - 1.f) * 2.5f);
+
+        // 边缘接触时两种方法的容差不同，跳过
+        const auto contact = ConvexContact(MakeBox(ea, qa, ca), MakeBox(eb, qb, cb));
+        if (Abs(contact.distance) < 1e-3f)
+            continue;
+
+        const auto overlap = Overlaps(obb(ca, qa, ea), obb(cb, qb, eb));
+        EXPECT_EQ(overlap, contact.intersect());
+        EXPECT_EQ(overlap, Overlaps(obb(cb, qb, eb), obb(ca, qa, ea)));
+        overlapping += overlap;
+    }
+    EXPECT_GT(overlapping, 100u);
+    EXPECT_LT(overlapping, 1900u);
+
+    // 棱平行的退化情况
+    EXPECT_TRUE(Overlaps(obb(aabb(float3(0.f), float3(1.f))), obb(aabb(float3(0.5f), float3(2.f)))));
+    EXPECT_FALSE(Overlaps(obb(aabb(float3(0.f), float3(1.f))), obb(aabb(float3(1.1f, 0.f, 0.f), float3(2.f)))));
+}
+
+TEST(ObbTest, RaySlab)
+{
+    PCG32 rng(59);
+    const obb box(float3(1.f, 2.f, -1.f), Normalize(quatf(0.9f, 0.1f, 0.3f, -0.2f)), float3(1.f, 0.5f, 2.f));
+
+    size hits = 0;
+    for (i32 i = 0; i < 1000; ++i) {
+        const float3 origin = (float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 2.f - 1.f) * 6.f;
+        const float3 dir    = box.center + (float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 2.f - 1.f) * 2.f - origin;
+        const Ray ray(origin, dir, 0.f, kInfinity);
+
+        Float nearT, farT;
+        if (!RayIntersect(box, ray, nearT, farT))
+            continue;
+
+        // 进入与离开的点都在盒子表面上
+        ++hits;
+        for (const auto t : {nearT, farT}) {
+            const auto local = Abs(box.toLocal(origin + dir * t)) / box.halfExtents;
+            EXPECT_NEAR(Max(local.x, Max(local.y, local.z)), 1.f, 1e-4f);
+        }
+    }
+    EXPECT_GT(hits, 100u);
+
+    // 与 aabb 的 slab 测试一致
+    const aabb unit(float3(-1.f), float3(1.f));
+    const Ray ray(float3(-3.f, 0.2f, 0.1f), float3(1.f, 0.f, 0.f));
+    Float n0, f0, n1, f1;
+    EXPECT_EQ(RayIntersect(unit, ray, n0, f0), RayIntersect(obb(unit), ray, n1, f1));
+    EXPECT_FLOAT_EQ(n0, n1);
+    EXPECT_FLOAT_EQ(f0, f1);
+}
+
+TEST(BoundsBatchTest, MatchesSerialInclude)
+{
+    PCG32 rng(61);
+
+    // 超过并行阈值，且数量不是分组大小的整数倍
+    std::vector<float3> points(100003);
+    for (auto& p : points)
+        p = (float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 2.f - 1.f) * 1000.f;
+
+    aabb expected(points[0]);
+    for (const auto& p : points)
+        expected.include(p);
+    EXPECT_EQ(ComputeBounds(points), expected);
+    EXPECT_EQ(ParallelComputeBounds(points), expected);
+
+    std::vector<float2> flat(37);
+    for (auto& p : flat)
+        p = float2(rng.gen<f32>(), -rng.gen<f32>());
+    rect expected2(flat[0]);
+    for (const auto& p : flat)
+        expected2.include(p);
+    EXPECT_EQ(ComputeBounds(flat), expected2);
+
+    std::vector<aabb> boxes;
+    for (size i = 0; i + 1 < points.size(); i += 2)
+        boxes.emplace_back(Min(points[i], points[i + 1]), Max(points[i], points[i + 1]));
+    EXPECT_EQ(UnionBounds(boxes), expected);
+    EXPECT_EQ(ParallelUnionBounds(boxes), expected);
+
+    // 空输入得到空包围盒
+    EXPECT_FALSE(ComputeBounds(std::span<const float3>{}).valid());
+    EXPECT_FALSE(UnionBounds(std::span<const aabb>{}).valid());
+    EXPECT_FALSE(ParallelComputeBounds(std::span<const float3>{}).valid());
+}
+
+TEST(BoundsBatchTest, TransformAABBsMatchesSingle)
+{
+    PCG32 rng(67);
+
+    auto m = mat4x4_t<f32>(Mat3Cast(Normalize(quatf(0.7f, -0.2f, 0.4f, 0.5f))) * 2.5f);
+    m[3]   = float4(3.f, -4.f, 5.f, 1.f);
+
+    std::vector<aabb> boxes(40000);
+    for (auto& b : boxes) {
+        const float3 c = (float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 2.f - 1.f) * 100.f;
+        const float3 h(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>());
+        b = aabb(c - h, c + h);
+    }
+    boxes[17] = aabb(float3(1.f), float3(-1.f));
+
+    std::vector<aabb> out(boxes.size());
+    TransformAABBs(m, boxes, out);
+    for (size i = 0; i < boxes.size(); ++i)
+        ASSERT_EQ(out[i], TransformAABB(m, boxes[i]));
+
+    std::vector<aabb> parallel(boxes.size());
+    ParallelTransformAABBs(m, boxes, parallel);
+    EXPECT_EQ(parallel, out);
+
+    // 原地变换
+    ParallelTransformAABBs(m, boxes, boxes);
+    EXPECT_EQ(boxes, out);
+}
+
+TEST(WarpTest, SinCosAndShapes)
+{
+    for (i32 i = -50; i <= 100; ++i) {
+        const auto t = f32(i) / 100.f;
+        f32 s, c;
+        internal::SinCos2Pi(t, s, c);
+        ASSERT_NEAR(s, std::sin(2 * 3.14159265358979 * t), 2e-7) << t;
+        ASSERT_NEAR(c, std::cos(2 * 3.14159265358979 * t), 2e-7) << t;
+    }
+
+    PCG32 rng(1);
+    for (i32 i = 0; i < 1000; ++i) {
+        const float2 u(rng.gen<f32>(), rng.gen<f32>());
+
+        const auto d = SampleUniformDiskConcentric(u);
+        ASSERT_LE(Length(d), 1.f + 1e-6f);
+
+        const auto h = SampleCosineHemisphere(u);
+        ASSERT_NEAR(Length(h), 1.f, 1e-5f);
+        ASSERT_GE(h.z, 0.f);
+
+        ASSERT_NEAR(Length(SampleUniformSphere(u)), 1.f, 1e-5f);
+
+        const auto cone = SampleUniformCone(u, 0.8f);
+        ASSERT_NEAR(Length(cone), 1.f, 1e-5f);
+        ASSERT_GE(cone.z, 0.8f - 1e-6f);
+
+        const auto b = SampleUniformTriangle(u);
+        ASSERT_TRUE(b.x >= 0.f && b.y >= 0.f && b.z >= -1e-6f);
+        ASSERT_NEAR(b.x + b.y + b.z, 1.f, 1e-6f);
+    }
+
+    // 同心映射把正方形的中心与边界映射到圆心与圆周
+    EXPECT_EQ(SampleUniformDiskConcentric(float2(0.5f, 0.5f)), float2(0.f, 0.f));
+    EXPECT_NEAR(SampleUniformDiskConcentric(float2(1.f, 0.5f)).x, 1.f, 1e-6f);
+    EXPECT_NEAR(SampleUniformDiskConcentric(float2(0.5f, 0.f)).y, -1.f, 1e-6f);
+}
+
+TEST(WarpTest, PdfsMatchSampling)
+{
+    // 用样本估计 E[g] 与用均匀球面积分 ∫ g · pdf 的结果应当一致
+    constexpr i32 kSamples = 1 << 16;
+    const auto g = [](const float3& w) { return w.z * w.z + 0.5f * w.x; };
+
+    PCG32 rng(7);
+    f64 cosineMean = 0, coneMean = 0, cosineRef = 0, coneRef = 0, pdfSum = 0;
+    for (i32 i = 0; i < kSamples; ++i) {
+        const float2 u(rng.gen<f32>(), rng.gen<f32>());
+        cosineMean += g(SampleCosineHemisphere(u));
+        coneMean += g(SampleUniformCone(u, 0.5f));
+
+        const float2 v(rng.gen<f32>(), rng.gen<f32>());
+        const auto w = SampleUniformSphere(v);
+        cosineRef += g(w) * CosineHemispherePdf(w.z) / UniformSpherePdf();
+        coneRef += w.z >= 0.5f ? g(w) * UniformConePdf(0.5f) / UniformSpherePdf() : 0.0;
+        pdfSum += CosineHemispherePdf(w.z) / UniformSpherePdf();
+    }
+
+    EXPECT_NEAR(pdfSum / kSamples, 1.0, 0.02);
+    EXPECT_NEAR(cosineMean / kSamples, cosineRef / kSamples, 0.02);
+    EXPECT_NEAR(coneMean / kSamples, coneRef / kSamples, 0.02);
+}
+
+TEST(WarpTest, GGXVisibleNormals)
+{
+    const float2 alpha(0.3f, 0.6f);
+    const auto wo = Normalize(float3(0.4f, -0.3f, 0.8f));
+
+    constexpr i32 kSamples = 1 << 17;
+    PCG32 rng(11);
+    f64 pdfSum = 0, zMean = 0, zRef = 0;
+    for (i32 i = 0; i < kSamples; ++i) {
+        const auto wm = SampleGGXVisibleNormal(wo, alpha, float2(rng.gen<f32>(), rng.gen<f32>()));
+        ASSERT_NEAR(Length(wm), 1.f, 1e-5f);
+        ASSERT_GE(Dot(wo, wm), -1e-4f);
+        zMean += wm.z;
+
+        const auto w   = SampleUniformSphere(float2(rng.gen<f32>(), rng.gen<f32>()));
+        const auto pdf = GGXVisibleNormalPdf(wo, w, alpha) / UniformSpherePdf();
+        pdfSum += pdf;
+        zRef += w.z * pdf;
+    }
+
+    // 可见法线分布归一化，且抽样得到的法线与概率密度一致
+    EXPECT_NEAR(pdfSum / kSamples, 1.0, 0.03);
+    EXPECT_NEAR(zMean / kSamples, zRef / kSamples, 0.03);
+}
+
+TEST(WarpTest, BatchMatchesScalar)
+{
+    constexpr size n = 37;
+    std::vector<f32> u0(n), u1(n), x(n), y(n), z(n), pdf(n);
+    PCG32 rng(13);
+    for (size i = 0; i < n; ++i) {
+        u0[i] = rng.gen<f32>();
+        u1[i] = rng.gen<f32>();
+    }
+
+    const auto frame = Frame<f32>::FromZ(Normalize(float3(1.f, 2.f, 3.f)));
+    const Float3SoA<f32> out(x, y, z);
+
+    SampleCosineHemisphere(u0, u1, frame, out, pdf);
+    for (size i = 0; i < n; ++i) {
+        const auto w = SampleCosineHemisphere(float2(u0[i], u1[i]));
+        ASSERT_NEAR(Length(out[i] - frame.fromLocal(w)), 0.f, 1e-6f);
+        ASSERT_EQ(pdf[i], CosineHemispherePdf(w.z));
+        ASSERT_NEAR(Dot(out[i], frame.z), w.z, 1e-5f);
+    }
+
+    SampleUniformCone(u0, u1, 0.9f, frame, out, pdf);
+    for (size i = 0; i < n; ++i) {
+        ASSERT_NEAR(Length(out[i] - frame.fromLocal(SampleUniformCone(float2(u0[i], u1[i]), 0.9f))), 0.f, 1e-6f);
+        ASSERT_EQ(pdf[i], UniformConePdf(0.9f));
+    }
+
+    // 不需要概率密度时可以不传
+    SampleUniformSphere(u0, u1, Frame<f32>(), out);
+    for (size i = 0; i < n; ++i)
+        ASSERT_EQ(out[i], SampleUniformSphere(float2(u0[i], u1[i])));
+
+    SampleUniformDiskConcentric(u0, u1, x, y);
+    for (size i = 0; i < n; ++i)
+        ASSERT_EQ(float2(x[i], y[i]), SampleUniformDiskConcentric(float2(u0[i], u1[i])));
+
+    SampleUniformTriangle(u0, u1, out);
+    for (size i = 0; i < n; ++i)
+        ASSERT_EQ(out[i], SampleUniformTriangle(float2(u0[i], u1[i])));
+
+    std::vector<f32> wx(n, 0.f), wy(n, 0.2f), wz(n, 0.9f), mx(n), my(n), mz(n);
+    const float2 alpha(0.2f, 0.4f);
+    SampleGGXVisibleNormal(Float3SoA<const f32>(wx, wy, wz), alpha, u0, u1, Float3SoA<f32>(mx, my, mz), pdf);
+    for (size i = 0; i < n; ++i) {
+        const auto wm = SampleGGXVisibleNormal(float3(0.f, 0.2f, 0.9f), alpha, float2(u0[i], u1[i]));
+        ASSERT_EQ(float3(mx[i], my[i], mz[i]), wm);
+        ASSERT_EQ(pdf[i], GGXVisibleNormalPdf(float3(0.f, 0.2f, 0.9f), wm, alpha));
+    }
+}
@@ -0,0 +1,431 @@
+/**
+ * @File RandomTest.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Nova/Nova.hpp"
+#include "Nova/Math/Distribution.hpp"
+#include "Nova/Math/LowDiscrepancy.hpp"
+#include "Nova/Math/Random.hpp"
+#include "Nova/Math/StreamHash.hpp"
+using namespace nova;
+
+TEST(PCG32x8Test, LanesMatchScalar)
+{
+    const std::array<u64, 8> streams = {0, 1, 7, 42, 1000, 0xdeadbeef, ~0ull, 12345678901234ull};
+    PCG32x8 rng(streams);
+
+    std::array<PCG32, 8> scalar;
+    for (size i = 0; i < 8; ++i)
+        scalar[i] = PCG32(streams[i]);
+
+    for (i32 k = 0; k < 1000; ++k) {
+        const auto v = rng.gen();
+        for (size i = 0; i < 8; ++i)
+            ASSERT_EQ(v[i], scalar[i].gen<u32>());
+    }
+
+    const auto f = rng.genFloat();
+    for (size i = 0; i < 8; ++i)
+        EXPECT_EQ(f[i], scalar[i].gen<f32>());
+
+    rng.advance(12345);
+    for (size i = 0; i < 8; ++i) {
+        scalar[i].advance(12345);
+        EXPECT_EQ(rng.lane(i).gen<u32>(), scalar[i].gen<u32>());
+    }
+}
+
+TEST(PCG32x8Test, FillInterleavesLanes)
+{
+    PCG32x8 rng(100);
+    std::vector<u32> out(8 * 50 + 5);
+    rng.fill(out);
+
+    for (size i = 0; i < 8; ++i) {
+        PCG32 scalar(100 + i);
+        for (size k = 0; k * 8 + i < out.size(); ++k)
+            ASSERT_EQ(out[k * 8 + i], scalar.gen<u32>());
+    }
+
+    // 不足 8 个的尾部也会让所有通道前进一步
+    EXPECT_EQ(rng.lane(7).distance(PCG32(107)), 51);
+
+    PCG32x8 frng(3);
+    std::vector<f32> floats(8 * 20 + 3);
+    frng.fill(floats);
+    for (size i = 0; i < 8; ++i) {
+        PCG32 scalar(3 + i);
+        for (size k = 0; k * 8 + i < floats.size(); ++k) {
+            const auto x = floats[k * 8 + i];
+            ASSERT_EQ(x, scalar.gen<f32>());
+            ASSERT_TRUE(x >= 0.f && x < 1.f);
+        }
+    }
+}
+
+TEST(ParallelFillTest, MatchesSerialSequence)
+{
+    PCG32 serial(77), parallel(77);
+
+    // 跨越多个块，且长度不是块长度的整数倍
+    std::vector<u32> expected((1 << 18) + 123), actual(expected.size());
+    for (auto& v : expected)
+        v = serial.gen<u32>();
+    ParallelFill(parallel, actual);
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(parallel.distance(serial), 0);
+
+    std::vector<f32> expectedF(100000), actualF(expectedF.size());
+    for (auto& v : expectedF)
+        v = serial.gen<f32>();
+    ParallelFill(parallel, actualF);
+    EXPECT_EQ(actualF, expectedF);
+    EXPECT_EQ(parallel.gen<u32>(), serial.gen<u32>());
+
+    std::vector<u32> empty;
+    ParallelFill(parallel, empty);
+    EXPECT_EQ(parallel.gen<u32>(), serial.gen<u32>());
+}
+
+TEST(Philox4x32Test, KnownAnswer)
+{
+    // Random123 kat_vectors 中的 philox4x32_10
+    using C = Philox4x32::Counter;
+    using K = Philox4x32::Key;
+    EXPECT_EQ(Philox4x32::random(K{0, 0}, C{0, 0, 0, 0}), (C{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(Philox4x32::random(K{0xffffffff, 0xffffffff}, C{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}),
+              (C{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(Philox4x32::random(K{0xa4093822, 0x299f31d0}, C{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}),
+              (C{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+
+    static_assert(Philox4x32::random(K{0, 0}, C{0, 0, 0, 0})[0] == 0x6627e8d5);
+}
+
+TEST(Philox4x32Test, FillMatchesScalar)
+{
+    constexpr u64 key = 0x0123456789abcdefull, first = 0xfffffffffffffff0ull;
+
+    // 长度不是 32 的倍数，并且计数器跨越 64 位的回绕
+    std::vector<u32> bits(4 * 37 + 3);
+    Philox4x32::fill(key, first, bits);
+    for (size i = 0; i < bits.size(); ++i)
+        ASSERT_EQ(bits[i], Philox4x32::random(key, first + i / 4)[i % 4]);
+
+    std::vector<f32> floats(101);
+    Philox4x32::fill(key, 5, floats);
+    for (size i = 0; i < floats.size(); ++i) {
+        const auto u = Philox4x32::random(key, 5 + i / 4)[i % 4];
+        ASSERT_EQ(floats[i], std::bit_cast<f32>((u >> 9) | 0x3F800000u) - 1.f);
+        ASSERT_TRUE(floats[i] >= 0.f && floats[i] < 1.f);
+    }
+}
+
+TEST(HashCounterRngTest, FillMatchesScalar)
+{
+    constexpr u64 key = 42;
+
+    std::vector<u64> bits(4 * 25 + 3);
+    HashCounterRng::fill(key, 1000, bits);
+    for (size i = 0; i < bits.size(); ++i)
+        ASSERT_EQ(bits[i], HashCounterRng::random(key, 1000 + i));
+
+    // 同一计数器在不同的键下得到不同的结果
+    EXPECT_NE(HashCounterRng::random(1, 0), HashCounterRng::random(2, 0));
+    EXPECT_NE(HashCounterRng::random(1, 0), HashCounterRng::random(1, 1));
+
+    std::vector<f32> floats(600);
+    HashCounterRng::fill(key, 7, floats);
+    f64 mean = 0;
+    for (size i = 0; i < floats.size(); ++i) {
+        const auto u = u32(HashCounterRng::random(key, 7 + i) >> 32);
+        ASSERT_EQ(floats[i], std::bit_cast<f32>((u >> 9) | 0x3F800000u) - 1.f);
+        mean += floats[i];
+    }
+    EXPECT_NEAR(mean / f64(floats.size()), 0.5, 0.05);
+}
+
+namespace {
+
+/// 前 n 个点在 [0, 1) 的 n 等分中各占一格
+bool Stratified(std::span<const f32> x)
+{
+    std::vector<i32> cells(x.size(), 0);
+    for (const auto v : x) {
+        if (!(v >= 0.f && v < 1.f))
+            return false;
+        ++cells[size(v * f32(x.size()))];
+    }
+    return std::ranges::all_of(cells, [](i32 c) { return c == 1; });
+}
+
+} // namespace
+
+TEST(SobolTest, Values)
+{
+    // 第 0 维是 van der Corput 序列，第 1 维为 Joe-Kuo 表中的 x + 1
+    const f32 dim1[] = {0.f, 0.5f, 0.75f, 0.25f, 0.625f, 0.125f, 0.375f, 0.875f};
+    for (u32 i = 0; i < 8; ++i) {
+        EXPECT_EQ(SobolSample(i, 0), f32(ReverseBits(i)) * 0x1p-32f);
+        EXPECT_EQ(SobolSample(i, 1), dim1[i]);
+    }
+
+    // 每一维的前 2^k 个点都是 (0, k, 1)-网，Owen 扰乱后依然如此
+    std::vector<f32> x(256);
+    for (u32 dim = 0; dim < kSobolDimensions; ++dim) {
+        SobolFill(dim, 0, x);
+        EXPECT_TRUE(Stratified(x)) << dim;
+
+        OwenScrambledSobolFill(dim, 0, 7, x);
+        EXPECT_TRUE(Stratified(x)) << dim;
+    }
+
+    // 第 0、1 维的第 1 个点都是 0.5，扰乱后应当不同
+    EXPECT_NE(OwenScrambledSobolSample(1, 0, 7), OwenScrambledSobolSample(1, 1, 7));
+    EXPECT_NE(OwenScrambledSobolSample(3, 5, 7), OwenScrambledSobolSample(3, 5, 8));
+}
+
+TEST(SobolTest, FillMatchesScalar)
+{
+    // 起点不与块对齐，长度跨越多个块
+    std::vector<f32> x(300), y(300);
+    for (const u32 dim : {0u, 1u, 17u, kSobolDimensions - 1}) {
+        SobolFill(dim, 1000003, x);
+        OwenScrambledSobolFill(dim, 1000003, 42, y);
+        for (u32 i = 0; i < x.size(); ++i) {
+            ASSERT_EQ(x[i], SobolSample(1000003 + i, dim));
+            ASSERT_EQ(y[i], OwenScrambledSobolSample(1000003 + i, dim, 42));
+        }
+    }
+}
+
+TEST(HaltonTest, RadicalInverse)
+{
+    EXPECT_EQ(RadicalInverse(0, 1), 0.5f);
+    EXPECT_EQ(RadicalInverse(0, 6), 0.375f);
+    EXPECT_FLOAT_EQ(RadicalInverse(1, 1), 1.f / 3);
+    EXPECT_FLOAT_EQ(RadicalInverse(1, 5), 2.f / 3 + 1.f / 9);
+    EXPECT_FLOAT_EQ(RadicalInverse(2, 7), 2.f / 5 + 1.f / 25);
+
+    // 不带种子时与 RadicalInverse 一致
+    const HaltonSequence plain(kHaltonDimensions);
+    for (u32 dim = 0; dim < kHaltonDimensions; dim += 7) {
+        for (u64 i = 0; i < 1000; i += 13)
+            EXPECT_NEAR(plain.sample(i, dim), RadicalInverse(dim, i), 1e-6f);
+    }
+}
+
+TEST(HaltonTest, ScrambledFill)
+{
+    const HaltonSequence halton(kHaltonDimensions, 1234);
+
+    // 数字置换保留分层：以 b 为底的前 b^2 个点在 b^2 等分中各占一格
+    for (const u32 dim : {0u, 1u, 2u, 9u}) {
+        const auto base = dim == 9 ? 29u : (dim == 0 ? 2u : (dim == 1 ? 3u : 5u));
+        std::vector<f32> x(base * base);
+        halton.fill(dim, 0, x);
+        EXPECT_TRUE(Stratified(x)) << dim;
+    }
+
+    // 扰乱后不再是普通的 Halton 序列
+    EXPECT_NE(halton.sample(1, 1), RadicalInverse(1, 1));
+
+    // 批量生成与逐个计算一致，起点不对齐且覆盖块的边界
+    std::vector<f32> x(2000);
+    for (const u32 dim : {0u, 1u, 5u, kHaltonDimensions - 1}) {
+        halton.fill(dim, 123457, x);
+        for (u64 i = 0; i < x.size(); ++i)
+            ASSERT_EQ(x[i], halton.sample(123457 + i, dim));
+    }
+
+    std::vector<f32> shortRun(3);
+    halton.fill(4, 10, shortRun);
+    EXPECT_EQ(shortRun[2], halton.sample(12, 4));
+}
+
+TEST(AliasTableTest, MatchesWeights)
+{
+    const std::vector<f32> weights = {1.f, 0.f, 3.f, 0.5f, 2.f, 0.f, 1.5f};
+    const AliasTable table(weights);
+
+    // 每个格子的 q 与别名合起来正好还原出原分布：用分层的 u 统计每个下标被选中的比例
+    constexpr u32 kSamples = 1 << 16;
+    std::vector<u32> hits(weights.size(), 0);
+    for (u32 i = 0; i < kSamples; ++i) {
+        f32 pmf, uRemapped;
+        const auto index = table.sample((f32(i) + 0.5f) / kSamples, pmf, uRemapped);
+        ++hits[index];
+        ASSERT_EQ(pmf, table.pmf(index));
+        ASSERT_TRUE(uRemapped >= 0.f && uRemapped < 1.f);
+    }
+
+    for (size i = 0; i < weights.size(); ++i) {
+        EXPECT_FLOAT_EQ(table.pmf(u32(i)), weights[i] / 8.f);
+        EXPECT_NEAR(f32(hits[i]) / kSamples, weights[i] / 8.f, 1e-3f) << i;
+    }
+
+    // 权重全为 0 时为均匀分布
+    const std::vector<f32> zeros(4, 0.f);
+    EXPECT_EQ(AliasTable(zeros).pmf(3), 0.25f);
+}
+
+TEST(AliasTableTest, LargeInput)
+{
+    // 超过分块大小，并行构建与串行构建的结果逐位相同
+    std::vector<f32> weights(100000);
+    PCG32 rng(5);
+    for (auto& w : weights)
+        w = rng.gen<f32>() * rng.gen<f32>();
+
+    const AliasTable table(weights);
+    const AliasTable parallel(weights, ParallelChunks{});
+    f64 sum = 0;
+    for (size i = 0; i < weights.size(); ++i) {
+        sum += table.pmf(u32(i));
+        ASSERT_EQ(table.pmf(u32(i)), parallel.pmf(u32(i)));
+    }
+    EXPECT_NEAR(sum, 1.0, 1e-4);
+
+    for (u32 i = 0; i < 1000; ++i) {
+        f32 pmf, uRemapped;
+        const auto index = table.sample(rng.gen<f32>(), pmf, uRemapped);
+        ASSERT_GT(weights[index], 0.f);
+    }
+}
+
+TEST(PiecewiseConstantTest, Sample1D)
+{
+    const std::vector<f32> f = {0.f, 1.f, 3.f, 0.f, 4.f};
+    const PiecewiseConstant1D dist(f, -1.f, 4.f);
+    EXPECT_FLOAT_EQ(dist.integral(), 8.f);
+
+    // 0 值的区间不会被选中，落在各区间内的点的密度为 f / 积分
+    for (u32 i = 0; i < 1000; ++i) {
+        const auto u = (f32(i) + 0.5f) / 1000.f;
+        f32 pdf;
+        u32 offset;
+        const auto x = dist.sample(u, pdf, offset);
+
+        ASSERT_GT(f[offset], 0.f);
+        ASSERT_TRUE(x >= -1.f + f32(offset) && x < f32(offset)) << u;
+        ASSERT_FLOAT_EQ(pdf, f[offset] / 8.f);
+        ASSERT_FLOAT_EQ(dist.pdf(x), pdf);
+    }
+
+    // 离散抽样：u 落在 [1/8, 4/8) 时选中区间 2
+    f32 pmf, uRemapped;
+    EXPECT_EQ(dist.sampleDiscrete(0.25f, pmf, uRemapped), 2u);
+    EXPECT_FLOAT_EQ(pmf, 3.f / 8.f);
+    EXPECT_NEAR(uRemapped, 1.f / 3.f, 1e-6f);
+    EXPECT_EQ(dist.sampleDiscrete(0.f, pmf, uRemapped), 1u);
+    EXPECT_EQ(dist.sampleDiscrete(kFloatOneMinusEpsilon, pmf, uRemapped), 4u);
+
+    // 引导表与直接二分查找的结果一致
+    std::vector<f32> g(70000);
+    PCG32 rng(9);
+    for (size i = 0; i < g.size(); ++i)
+        g[i] = i % 7 == 0 ? 0.f : rng.gen<f32>();
+    const PiecewiseConstant1D big(g);
+    const PiecewiseConstant1D bigParallel(g, 0.f, 1.f, ParallelChunks{});
+    EXPECT_EQ(big.integral(), bigParallel.integral());
+
+    std::vector<f32> cdf(g.size() + 1, 0.f);
+    f64 run = 0, total = 0;
+    for (const auto v : g)
+        total += v;
+    for (size i = 0; i < g.size(); ++i) {
+        run += g[i];
+        cdf[i + 1] = f32(run / total);
+    }
+
+    for (u32 i = 0; i < 10000; ++i) {
+        const auto u = rng.gen<f32>();
+        const auto index = big.sampleDiscrete(u, pmf, uRemapped);
+        ASSERT_EQ(bigParallel.sampleDiscrete(u, pmf, uRemapped), index);
+        ASSERT_GT(g[index], 0.f);
+        ASSERT_LE(cdf[index], u);
+        ASSERT_GT(cdf[index + 1], u);
+    }
+}
+
+TEST(PiecewiseConstantTest, Sample2D)
+{
+    // 4 x 3 的函数，按行存放
+    const std::vector<f32> f = {1.f, 0.f, 0.f, 1.f, //
+                                0.f, 0.f, 0.f, 0.f, //
+                                2.f, 2.f, 0.f, 4.f};
+    const PiecewiseConstant2D dist(f, 4, 3);
+    EXPECT_EQ(dist.resolution(), uint2(4, 3));
+    EXPECT_FLOAT_EQ(dist.integral(), 10.f / 12.f);
+
+    PCG32 rng(3);
+    for (u32 i = 0; i < 1000; ++i) {
+        f32 pdf;
+        uint2 offset;
+        const auto p = dist.sample({rng.gen<f32>(), rng.gen<f32>()}, pdf, offset);
+
+        const auto value = f[offset.y * 4 + offset.x];
+        ASSERT_GT(value, 0.f);
+        ASSERT_EQ(u32(p.x * 4), offset.x);
+        ASSERT_EQ(u32(p.y * 3), offset.y);
+        ASSERT_FLOAT_EQ(pdf, value / (10.f / 12.f));
+        ASSERT_FLOAT_EQ(dist.pdf(p), pdf);
+    }
+}
+
+TEST(StreamHasherTest, ChunkingIndependent)
+{
+    std::vector<u8> data(100000);
+    PCG32 rng(17);
+    for (auto& b : data)
+        b = u8(rng.gen<u32>());
+
+    for (const size len : {0, 1, 3, 4, 16, 17, 63, 64, 65, 255, 256, 257, 1023, 1024, 1025, 5000, 100000}) {
+        const auto expected = StreamHasher::Hash(data.data(), len, 7);
+
+        for (i32 trial = 0; trial < 4; ++trial) {
+            StreamHasher hasher(7);
+            size offset = 0;
+            while (offset < len) {
+                const auto chunk = Min<size>(len - offset, rng.gen(trial == 0 ? 2u : 600u));
+                hasher.update(data.data() + offset, chunk);
+                offset += chunk;
+
+                // digest 不改变状态
+                if (offset < len)
+                    (void)hasher.digest();
+            }
+            EXPECT_EQ(hasher.digest(), expected) << len;
+        }
+    }
+}
+
+TEST(StreamHasherTest, Values)
+{
+    std::vector<u8> data(4096);
+    for (size i = 0; i < data.size(); ++i)
+        data[i] = u8(i * 31 + 7);
+
+    // 与是否启用 AVX2 无关
+    EXPECT_EQ(StreamHasher::Hash(data.data(), 100), 14130068067874898663ull);
+    EXPECT_EQ(StreamHasher::Hash(data.data(), 4096), 15516000143571180651ull);
+    EXPECT_NE(StreamHasher::Hash(data.data(), 4096, 1), StreamHasher::Hash(data.data(), 4096));
+    EXPECT_NE(StreamHasher::Hash(data.data(), 4095), StreamHasher::Hash(data.data(), 4096));
+
+    // 只改变一个字节
+    auto copy = data;
+    copy[1000] ^= 1;
+    EXPECT_NE(StreamHasher::Hash(copy.data(), 4096), StreamHasher::Hash(data.data(), 4096));
+
+    StreamHasher hasher;
+    hasher.update(data.data(), 300);
+    hasher.reset();
+    EXPECT_EQ(hasher.digest(), StreamHasher::Hash(nullptr, 0));
+}
@@ -172,6 +172,22 @@ TEST(CwEqualWithEpsilonTest, CompareVec4)
     EXPECT_TRUE(all(cwEqual(a4, b4, 1.1e-5)));
 }
 
+TEST(ScalarFirstOperatorTest, NonCommutative)
+{
+    auto v2 = 10.0f - vec<2, float>{1.0f, 2.0f};
+    EXPECT_FLOAT_EQ(v2.x, 9.0f);
+    EXPECT_FLOAT_EQ(v2.y, 8.0f);
+
+    auto v3 = 1.0f / vec<3, float>{2.0f, 4.0f, 8.0f};
+    EXPECT_FLOAT_EQ(v3.x, 0.5f);
+    EXPECT_FLOAT_EQ(v3.y, 0.25f);
+    EXPECT_FLOAT_EQ(v3.z, 0.125f);
+
+    auto v4 = vec<1, float>{1.0f} - vec<4, float>{1.0f, 2.0f, 3.0f, 4.0f};
+    EXPECT_FLOAT_EQ(v4.x, 0.0f);
+    EXPECT_FLOAT_EQ(v4.w, -3.0f);
+}
+
 TEST(LerpTest, Vec1)
 {
     auto a      = vec<1, float>{2.0f};
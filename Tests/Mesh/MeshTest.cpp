@@ -0,0 +1,656 @@
+/**
+ * @File MeshTest.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief 
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <unordered_set>
+#include <vector>
+
+#include "Nova/Nova.hpp"
+#include "Nova/Math/Random.hpp"
+#include "Nova/Math/TypeHash.hpp"
+
+using namespace nova;
+
+namespace {
+
+// 生成 n x n 个格子的网格，每个格子两个三角形
+void MakeGrid(u32 n, std::vector<float3>& positions, std::vector<u32>& indices)
+{
+    positions.clear();
+    indices.clear();
+
+    for (u32 y = 0; y <= n; ++y)
+        for (u32 x = 0; x <= n; ++x)
+            positions.emplace_back(f32(x), f32(y), 0.f);
+
+    for (u32 y = 0; y < n; ++y) {
+        for (u32 x = 0; x < n; ++x) {
+            const u32 i0 = y * (n + 1) + x;
+            const u32 i1 = i0 + 1;
+            const u32 i2 = i0 + n + 1;
+            const u32 i3 = i2 + 1;
+            indices.insert(indices.end(), {i0, i1, i2, i2, i1, i3});
+        }
+    }
+}
+
+// 随机打乱三角形的顺序
+void ShuffleTriangles(std::vector<u32>& indices, u64 seed)
+{
+    PCG32 rng(seed);
+    const auto faceCount = cast_to<u32>(indices.size() / 3);
+    for (u32 i = faceCount - 1; i > 0; --i) {
+        const auto j = rng.gen<u32>(i + 1);
+        for (u32 k = 0; k < 3; ++k)
+            std::swap(indices[i * 3 + k], indices[j * 3 + k]);
+    }
+}
+
+std::vector<std::array<u32, 3>> SortedTriangles(const std::vector<u32>& indices)
+{
+    std::vector<std::array<u32, 3>> tris;
+    for (size i = 0; i < indices.size(); i += 3)
+        tris.push_back({indices[i], indices[i + 1], indices[i + 2]});
+    std::sort(tris.begin(), tris.end());
+    return tris;
+}
+
+} // namespace
+
+TEST(MeshOptimizerTest, VertexCacheKeepsTriangles)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(32, positions, indices);
+    ShuffleTriangles(indices, 7);
+
+    std::vector<u32> optimized(indices.size());
+    OptimizeVertexCache(optimized, indices, positions.size());
+
+    EXPECT_EQ(SortedTriangles(indices), SortedTriangles(optimized));
+}
+
+TEST(MeshOptimizerTest, VertexCacheImprovesACMR)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(64, positions, indices);
+    ShuffleTriangles(indices, 42);
+
+    const auto before = AnalyzeVertexCache(indices, positions.size(), 16);
+
+    OptimizeVertexCache(indices, indices, positions.size());
+    const auto after = AnalyzeVertexCache(indices, positions.size(), 16);
+
+    EXPECT_LT(after.acmr, before.acmr);
+    EXPECT_LT(after.acmr, 1.0f);
+    EXPECT_GE(after.atvr, 1.0f);
+    EXPECT_LT(after.atvr, before.atvr);
+}
+
+TEST(MeshOptimizerTest, AnalyzeVertexCacheSingleTriangle)
+{
+    const std::vector<u32> indices = {0, 1, 2, 2, 1, 0};
+    const auto stats               = AnalyzeVertexCache(indices, 3, 16);
+
+    EXPECT_EQ(stats.vertexTransforms, 3u);
+    EXPECT_FLOAT_EQ(stats.acmr, 1.5f);
+    EXPECT_FLOAT_EQ(stats.atvr, 1.0f);
+}
+
+TEST(MeshOptimizerTest, VertexFetchRemapsByFirstUse)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(16, positions, indices);
+    ShuffleTriangles(indices, 3);
+
+    const auto original = indices;
+
+    std::vector<float3> reordered(positions.size());
+    const auto unique = OptimizeVertexFetch(reordered.data(), indices, positions.data(), positions.size(), sizeof(float3));
+    EXPECT_EQ(unique, positions.size());
+
+    // 顶点按首次使用的顺序排列
+    u32 next = 0;
+    for (const auto idx : indices) {
+        EXPECT_LE(idx, next);
+        if (idx == next)
+            ++next;
+    }
+
+    // 几何体本身保持不变
+    for (size i = 0; i < indices.size(); ++i)
+        EXPECT_EQ(reordered[indices[i]], positions[original[i]]);
+
+    const auto fetch = AnalyzeVertexFetch(indices, unique, sizeof(float3));
+    EXPECT_GE(fetch.overfetch, 1.0f);
+}
+
+TEST(MeshOptimizerTest, VertexFetchDropsUnusedVertices)
+{
+    const std::vector<float3> positions = {float3(0.f), float3(1.f), float3(2.f), float3(3.f)};
+    std::vector<u32> indices            = {3, 1, 0};
+
+    std::vector<float3> reordered(positions.size());
+    const auto unique = OptimizeVertexFetch(reordered.data(), indices, positions.data(), positions.size(), sizeof(float3));
+
+    EXPECT_EQ(unique, 3u);
+    EXPECT_EQ(indices, (std::vector<u32>{0, 1, 2}));
+    EXPECT_EQ(reordered[0], float3(3.f));
+    EXPECT_EQ(reordered[1], float3(1.f));
+    EXPECT_EQ(reordered[2], float3(0.f));
+}
+
+TEST(MeshWeldTest, TypeHash)
+{
+    EXPECT_EQ(std::hash<float3>()(float3(1.f, 2.f, 3.f)), std::hash<float3>()(float3(1.f, 2.f, 3.f)));
+    EXPECT_NE(std::hash<float3>()(float3(1.f, 2.f, 3.f)), std::hash<float3>()(float3(3.f, 2.f, 1.f)));
+    EXPECT_EQ(std::hash<float2>()(float2(0.f, 1.f)), std::hash<float2>()(float2(-0.f, 1.f)));
+
+    EXPECT_EQ(std::hash<quat<f32>>()(quat<f32>()), std::hash<quat<f32>>()(quat<f32>()));
+    EXPECT_NE(std::hash<float4x4>()(float4x4(1.f)), std::hash<float4x4>()(float4x4(2.f)));
+
+    std::unordered_set<int3> set;
+    set.insert(int3(1, 2, 3));
+    set.insert(int3(1, 2, 3));
+    set.insert(int3(3, 2, 1));
+    EXPECT_EQ(set.size(), 2u);
+}
+
+TEST(MeshWeldTest, WeldExactDuplicates)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(48, positions, indices);
+
+    // 展开为三角形汤，每个三角形都拥有独立的顶点
+    std::vector<float3> soup;
+    std::vector<u32> soupIndices;
+    for (const auto idx : indices) {
+        soupIndices.push_back(cast_to<u32>(soup.size()));
+        soup.push_back(positions[idx]);
+    }
+
+    const auto unique = WeldMesh(soup, soupIndices);
+    EXPECT_EQ(unique, positions.size());
+    EXPECT_EQ(soup.size(), positions.size());
+
+    for (size i = 0; i < indices.size(); ++i)
+        EXPECT_EQ(soup[soupIndices[i]], positions[indices[i]]);
+}
+
+TEST(MeshWeldTest, WeldWithEpsilon)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(16, positions, indices);
+
+    std::vector<float3> soup;
+    std::vector<u32> soupIndices;
+    PCG32 rng(11);
+    for (const auto idx : indices) {
+        soupIndices.push_back(cast_to<u32>(soup.size()));
+        const float3 jitter(rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f, rng.gen<f32>() - 0.5f);
+        soup.push_back(positions[idx] + jitter * 1e-4f);
+    }
+
+    std::vector<u32> exactRemap(soup.size());
+    EXPECT_EQ(WeldVertices(exactRemap, soup.data(), soup.size(), sizeof(float3)), soup.size());
+
+    const auto unique = WeldMesh(soup, soupIndices, 1e-2f);
+    EXPECT_EQ(unique, positions.size());
+
+    for (size i = 0; i < indices.size(); ++i)
+        EXPECT_TRUE(Equal(soup[soupIndices[i]], positions[indices[i]], 1e-3f));
+}
+
+TEST(MeshWeldTest, WeldLargeCoordinates)
+{
+    // 坐标除以 epsilon 后远超 i32 的范围
+    const std::vector<float3> positions = {
+        {          1e6f,    0.f, 0.f},
+        {1e6f + 0.0625f,    0.f, 0.f},
+        {          1e6f,    0.f, 0.f},
+        {         1e30f, -1e30f, 0.f},
+        {        -1e30f,  1e30f, 0.f},
+    };
+
+    std::vector<u32> remap(positions.size());
+    EXPECT_EQ(WeldVertices(remap, positions, 1e-6f), 4u);
+    EXPECT_EQ(remap[0], remap[2]);
+    EXPECT_NE(remap[0], remap[1]);
+    EXPECT_NE(remap[3], remap[4]);
+}
+
+TEST(MeshletTest, RespectsLimitsAndCoversAllTriangles)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(64, positions, indices);
+    ShuffleTriangles(indices, 5);
+
+    const auto data = BuildMeshlets(indices, positions, 64, 96);
+    ASSERT_FALSE(data.meshlets.empty());
+
+    std::vector<u32> rebuilt;
+    for (const auto& m : data.meshlets) {
+        EXPECT_GT(m.triangleCount, 0u);
+        EXPECT_LE(m.vertexCount, 64u);
+        EXPECT_LE(m.triangleCount, 96u);
+
+        for (u32 i = 0; i < m.triangleCount * 3; ++i) {
+            const auto local = data.triangles[m.triangleOffset + i];
+            ASSERT_LT(local, m.vertexCount);
+            rebuilt.push_back(data.vertices[m.vertexOffset + local]);
+        }
+    }
+
+    EXPECT_EQ(SortedTriangles(indices), SortedTriangles(rebuilt));
+}
+
+TEST(MeshletTest, ClustersAreSpatiallyCompact)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(64, positions, indices);
+    ShuffleTriangles(indices, 9);
+
+    const auto data   = BuildMeshlets(indices, positions, 64, 124);
+    const auto bounds = ComputeMeshletBounds(data, positions);
+    ASSERT_EQ(bounds.size(), data.meshlets.size());
+
+    // 124 个三角形约为 8x8 个格子，半径约为 5.7
+    f32 radiusSum = 0.f;
+    for (const auto& b : bounds)
+        radiusSum += b.radius;
+    EXPECT_LT(radiusSum / f32(bounds.size()), 8.f);
+}
+
+TEST(MeshletTest, BoundsAndNormalCone)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(16, positions, indices);
+
+    const auto data = BuildMeshlets(indices, positions);
+    for (const auto& m : data.meshlets) {
+        const auto b = ComputeMeshletBounds(data, m, positions);
+
+        for (u32 i = 0; i < m.vertexCount; ++i) {
+            const auto& p = positions[data.vertices[m.vertexOffset + i]];
+            EXPECT_TRUE(b.box.contains(p));
+            EXPECT_LE(Length(p - b.center), b.radius * 1.0001f);
+        }
+
+        // 平面网格的法线锥退化为单一方向
+        EXPECT_TRUE(Equal(b.coneAxis, float3(0, 0, 1), 1e-4f));
+        EXPECT_NEAR(b.coneCutoff, 0.f, 1e-3f);
+
+        EXPECT_TRUE(IsMeshletBackfacing(b, b.center - float3(0, 0, 10)));
+        EXPECT_FALSE(IsMeshletBackfacing(b, b.center + float3(0, 0, 10)));
+    }
+}
+
+namespace {
+
+// 起伏的高度场网格
+void MakeTerrain(u32 n, std::vector<float3>& positions, std::vector<u32>& indices)
+{
+    MakeGrid(n, positions, indices);
+    for (auto& p : positions)
+        p.z = 2.f * std::sin(p.x * 0.2f) * std::cos(p.y * 0.15f);
+}
+
+} // namespace
+
+TEST(MeshSimplifyTest, ReachesTargetOnCurvedMesh)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeTerrain(48, positions, indices);
+
+    SimplifyOptions options;
+    options.targetIndexCount = indices.size() / 4;
+    options.targetError      = 0.05f;
+
+    std::vector<u32> result(indices.size());
+    f32 error      = 0;
+    const auto cnt = SimplifyMesh(result, {indices, positions, {}, 0}, options, &error);
+    result.resize(cnt);
+
+    EXPECT_EQ(cnt % 3, 0u);
+    EXPECT_LE(cnt, options.targetIndexCount);
+    EXPECT_GT(cnt, 0u);
+    EXPECT_LE(error, options.targetError);
+
+    for (size i = 0; i < cnt; i += 3) {
+        EXPECT_LT(result[i], positions.size());
+        EXPECT_NE(result[i], result[i + 1]);
+        EXPECT_NE(result[i + 1], result[i + 2]);
+        EXPECT_NE(result[i], result[i + 2]);
+
+        // 高度场的三角形在简化后不会翻转
+        const auto n = Cross(positions[result[i + 1]] - positions[result[i]], positions[result[i + 2]] - positions[result[i]]);
+        EXPECT_GE(n.z, 0.f);
+    }
+}
+
+TEST(MeshSimplifyTest, PlanarGridCollapsesWithoutError)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(32, positions, indices);
+
+    SimplifyOptions options;
+    options.targetError = 1e-4f;
+
+    std::vector<u32> result(indices.size());
+    f32 error      = 1;
+    const auto cnt = SimplifyMesh(result, {indices, positions, {}, 0}, options, &error);
+
+    EXPECT_LT(cnt, indices.size() / 20);
+    EXPECT_NEAR(error, 0.f, 1e-4f);
+}
+
+TEST(MeshSimplifyTest, LockBorderKeepsBorderVertices)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(16, positions, indices);
+
+    SimplifyOptions options;
+    options.lockBorder  = true;
+    options.targetError = 1e-4f;
+
+    std::vector<u32> result(indices.size());
+    result.resize(SimplifyMesh(result, {indices, positions, {}, 0}, options));
+    EXPECT_LT(result.size(), indices.size());
+
+    std::vector<u8> used(positions.size(), 0);
+    for (const auto idx : result)
+        used[idx] = 1;
+
+    for (size v = 0; v < positions.size(); ++v) {
+        const auto& p = positions[v];
+        if (p.x == 0.f || p.y == 0.f || p.x == 16.f || p.y == 16.f) {
+            EXPECT_TRUE(used[v]);
+        }
+    }
+}
+
+TEST(MeshSimplifyTest, AttributesLimitCollapse)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeGrid(32, positions, indices);
+
+    // 平面上的属性在 x = 16 附近剧烈变化
+    std::vector<f32> attributes;
+    for (const auto& p : positions)
+        attributes.push_back(Clamp(p.x - 15.5f, 0.f, 1.f));
+
+    SimplifyOptions options;
+    options.targetError = 1e-3f;
+
+    std::vector<u32> plain(indices.size()), aware(indices.size());
+    const auto plainCount = SimplifyMesh(plain, {indices, positions, {}, 0}, options);
+
+    const f32 weight         = 10.f;
+    options.attributeWeights = {&weight, 1};
+    const auto awareCount    = SimplifyMesh(aware, {indices, positions, attributes, 1}, options);
+
+    EXPECT_GT(awareCount, plainCount);
+}
+
+TEST(MeshSimplifyTest, LodChain)
+{
+    std::vector<float3> positions;
+    std::vector<u32> indices;
+    MakeTerrain(64, positions, indices);
+
+    LodChainOptions options;
+    options.maxLevels = 6;
+    options.maxError  = 0.1f;
+
+    const auto lods = GenerateLodChain({indices, positions, {}, 0}, options);
+    ASSERT_GE(lods.size(), 3u);
+    EXPECT_EQ(lods[0].indices, indices);
+
+    for (size i = 1; i < lods.size(); ++i) {
+        EXPECT_LT(lods[i].indices.size(), lods[i - 1].indices.size());
+        EXPECT_GE(lods[i].error, lods[i - 1].error);
+        EXPECT_LE(lods[i].error, options.maxError + 1e-4f);
+    }
+
+    // 批量生成与逐个生成的结果一致
+    std::vector<float3> positions2;
+    std::vector<u32> indices2;
+    MakeTerrain(24, positions2, indices2);
+
+    const std::vector<MeshView> meshes = {
+        {indices2, positions2, {}, 0},
+        { indices,  positions, {}, 0},
+        {indices2, positions2, {}, 0},
+    };
+    const auto chains = GenerateLodChains(meshes, options);
+    ASSERT_EQ(chains.size(), 3u);
+
+    for (size m = 0; m < meshes.size(); ++m) {
+        const auto expected = GenerateLodChain(meshes[m], options);
+        ASSERT_EQ(chains[m].size(), expected.size());
+        for (size i = 0; i < expected.size(); ++i)
+            EXPECT_EQ(chains[m][i].indices, expected[i].indices);
+    }
+}
+
+namespace {
+
+// 检查凸包是封闭的二维流形，且所有点都位于各个平面的内侧
+void ExpectValidHull(const ConvexHull& hull, std::span<const float3> points, f32 tolerance)
+{
+    ASSERT_FALSE(hull.empty());
+    ASSERT_EQ(hull.planes.size() * 3, hull.indices.size());
+
+    std::unordered_set<u64> edges;
+    for (size i = 0; i < hull.indices.size(); i += 3) {
+        for (u32 k = 0; k < 3; ++k) {
+            const u64 a = hull.indices[i + k], b = hull.indices[i + (k + 1) % 3];
+            EXPECT_TRUE(edges.insert((a << 32) | b).second);
+        }
+    }
+    for (const auto e : edges)
+        EXPECT_TRUE(edges.contains((e << 32) | (e >> 32)));
+
+    // 欧拉公式 V - E + F = 2
+    const auto faceCount = hull.indices.size() / 3;
+    EXPECT_EQ(hull.positions.size() + faceCount, edges.size() / 2 + 2);
+
+    for (const auto& plane : hull.planes) {
+        for (const auto& p : points)
+            EXPECT_LE(Dot(plane, float4(p, 1.f)), tolerance);
+    }
+
+    for (size v = 0; v < hull.positions.size(); ++v)
+        EXPECT_TRUE(all_eq(hull.positions[v], points[hull.sourceIndices[v]]));
+}
+
+} // namespace
+
+TEST(ConvexHullTest, CubeWithInteriorPoints)
+{
+    PCG32 rng(21);
+    std::vector<float3> points;
+    for (u32 i = 0; i < 8; ++i)
+        points.emplace_back(f32(i & 1), f32((i >> 1) & 1), f32((i >> 2) & 1));
+
+    // 内部点与落在表面上的点都不应成为凸包顶点
+    for (u32 i = 0; i < 2000; ++i) {
+        float3 p(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>());
+        if (i % 2 == 0)
+            p[i % 3] = f32((i / 2) % 2);
+        points.push_back(p);
+    }
+
+    const auto hull = BuildConvexHull(points);
+    ExpectValidHull(hull, points, 1e-5f);
+    EXPECT_EQ(hull.positions.size(), 8u);
+    EXPECT_EQ(hull.indices.size(), 36u);
+
+    for (const auto v : hull.sourceIndices)
+        EXPECT_LT(v, 8u);
+}
+
+TEST(ConvexHullTest, SpherePoints)
+{
+    PCG32 rng(5);
+    std::vector<float3> points;
+    for (u32 i = 0; i < 50000; ++i) {
+        const float3 d(rng.gen<f32>() * 2.f - 1.f, rng.gen<f32>() * 2.f - 1.f, rng.gen<f32>() * 2.f - 1.f);
+        if (LengthSqr(d) > 1e-4f)
+            points.push_back(i % 100 == 0 ? Normalize(d) * 10.f : d * 5.f);
+    }
+
+    const auto hull = BuildConvexHull(points);
+    ExpectValidHull(hull, points, 1e-4f);
+
+    for (const auto& p : hull.positions)
+        EXPECT_NEAR(Length(p), 10.f, 1e-4f);
+
+    // 结果与点的顺序无关
+    auto shuffled = points;
+    std::reverse(shuffled.begin(), shuffled.end());
+    EXPECT_EQ(BuildConvexHull(shuffled).positions.size(), hull.positions.size());
+}
+
+TEST(ConvexHullTest, DegenerateInput)
+{
+    EXPECT_TRUE(BuildConvexHull(std::vector<float3>{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}).empty());
+
+    std::vector<float3> planar;
+    for (u32 i = 0; i < 100; ++i)
+        planar.emplace_back(f32(i % 10), f32(i / 10), 0.f);
+    EXPECT_TRUE(BuildConvexHull(planar).empty());
+
+    std::vector<float3> line;
+    for (u32 i = 0; i < 10; ++i)
+        line.emplace_back(f32(i), f32(i) * 2.f, 1.f);
+    EXPECT_TRUE(BuildConvexHull(line).empty());
+}
+
+TEST(ConvexHullTest, NearCoplanarTopIsConvex)
+{
+    // 顶面上的点在 z 方向的扰动与默认容差同一量级，许多面对新顶点只是略微可见
+    PCG32 rng(9);
+    std::vector<float3> points;
+    for (u32 i = 0; i < 64; ++i) {
+        for (u32 j = 0; j < 64; ++j)
+            points.emplace_back(f32(i) / 63.f, f32(j) / 63.f, 1.f + rng.gen<f32>() * 1e-5f);
+    }
+    points.emplace_back(0.5f, 0.5f, -1.f);
+
+    const auto hull = BuildConvexHull(points);
+    ExpectValidHull(hull, points, 1e-5f);
+
+    // 相邻面之间没有凹折：凸包的每个顶点都不严格位于任何面的外侧
+    for (size i = 0; i < hull.indices.size(); i += 3) {
+        const auto& a = hull.positions[hull.indices[i]];
+        const auto& b = hull.positions[hull.indices[i + 1]];
+        const auto& c = hull.positions[hull.indices[i + 2]];
+        for (const auto& v : hull.positions)
+            ASSERT_GE(Orient3D(a, b, c, v), 0.0);
+    }
+}
+
+namespace {
+
+/// 轴对齐盒子 [-h, h]^3 的解析有符号距离
+f32 BoxSdf(const float3& p, f32 h)
+{
+    const auto q = Abs(p) - float3(h);
+    return Length(Max(q, float3(0.f))) + Min(Max(q.x, Max(q.y, q.z)), 0.f);
+}
+
+} // namespace
+
+TEST(MeshSdfTest, CubeMatchesAnalytic)
+{
+    std::vector<float3> corners;
+    for (u32 i = 0; i < 8; ++i)
+        corners.emplace_back(i & 1 ? 1.f : -1.f, i & 2 ? 1.f : -1.f, i & 4 ? 1.f : -1.f);
+    const auto cube = BuildConvexHull(corners);
+
+    SdfOptions options;
+    options.resolution = 16;
+    options.brickSize  = 4;
+
+    const auto grid = BakeSdf(cube.indices, cube.positions, options);
+    EXPECT_FLOAT_EQ(grid.voxelSize, 2.f / 16.f);
+    EXPECT_EQ(grid.dims.x % options.brickSize, 0u);
+    EXPECT_EQ(grid.distances.size(), size(grid.dims.x) * grid.dims.y * grid.dims.z);
+
+    for (u32 z = 0; z < grid.dims.z; ++z) {
+        for (u32 y = 0; y < grid.dims.y; ++y) {
+            for (u32 x = 0; x < grid.dims.x; ++x) {
+                const auto p = grid.origin + (float3(f32(x), f32(y), f32(z)) + 0.5f) * grid.voxelSize;
+                EXPECT_NEAR(grid.at(x, y, z), BoxSdf(p, 1.f), 1e-4f);
+            }
+        }
+    }
+
+    EXPECT_NEAR(grid.sample(float3(-0.5f, 0.03f, 0.02f)), -0.5f, 1e-4f);
+    EXPECT_NEAR(grid.sample(float3(1.5f, 0.f, 0.f)), 0.5f, 1e-2f);
+}
+
+TEST(MeshSdfTest, SparseMatchesDenseInBand)
+{
+    PCG32 rng(7);
+    std::vector<float3> points;
+    for (u32 i = 0; i < 400; ++i) {
+        const auto d = float3(rng.gen<f32>(), rng.gen<f32>(), rng.gen<f32>()) * 2.f - 1.f;
+        if (LengthSqr(d) > 1e-4f)
+            points.push_back(Normalize(d));
+    }
+    const auto sphere = BuildConvexHull(points);
+
+    SdfOptions options;
+    options.resolution = 32;
+    options.brickSize  = 4;
+
+    const auto dense  = BakeSdf(sphere.indices, sphere.positions, options);
+    const auto sparse = BakeSparseSdf(sphere.indices, sphere.positions, options);
+
+    ASSERT_TRUE(all_eq(dense.dims, sparse.dims()));
+    EXPECT_GT(sparse.narrowBand, 0.f);
+    EXPECT_LT(sparse.allocatedBricks(), sparse.brickTable.size());
+    EXPECT_GT(sparse.allocatedBricks(), 0u);
+
+    size inside = 0, outside = 0;
+    for (u32 z = 0; z < dense.dims.z; ++z) {
+        for (u32 y = 0; y < dense.dims.y; ++y) {
+            for (u32 x = 0; x < dense.dims.x; ++x) {
+                const auto d = dense.at(x, y, z);
+                const auto s = sparse.at(x, y, z);
+                EXPECT_NEAR(s, Clamp(d, -sparse.narrowBand, sparse.narrowBand), 1e-5f);
+
+                // 单位球的内接凸包与真实距离只差一个很小的量
+                const auto p = dense.origin + (float3(f32(x), f32(y), f32(z)) + 0.5f) * dense.voxelSize;
+                EXPECT_NEAR(d, Length(p) - 1.f, 0.1f);
+
+                (d < 0 ? inside : outside)++;
+            }
+        }
+    }
+    EXPECT_GT(inside, 0u);
+    EXPECT_GT(outside, 0u);
+
+    EXPECT_NEAR(sparse.sample(float3(0.f)), -sparse.narrowBand, 1e-5f);
+    EXPECT_NEAR(sparse.sample(float3(0.f, 0.f, 1.f)), 0.f, 0.05f);
+}
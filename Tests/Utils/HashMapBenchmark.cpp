@@ -0,0 +1,98 @@
+/**
+ * @File HashMapBenchmark.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Nova/Math/Random.hpp>
+#include <Nova/Utils/HashMap.hpp>
+
+using namespace nova;
+
+namespace {
+
+std::vector<u64> RandomKeys(size n, u64 seed)
+{
+    PCG32 rng(seed);
+    std::vector<u64> keys(n);
+    for (auto& k : keys)
+        k = (u64(rng.gen<u32>()) << 32) | rng.gen<u32>();
+    return keys;
+}
+
+std::vector<std::string> StringKeys(size n)
+{
+    std::vector<std::string> keys(n);
+    for (size i = 0; i < n; ++i)
+        keys[i] = "Assets/Textures/Material_" + std::to_string(i) + ".png";
+    return keys;
+}
+
+template<typename Map> void InsertU64(benchmark::State& state)
+{
+    const auto keys = RandomKeys(size(state.range(0)), 1);
+    for (auto _ : state) {
+        Map map;
+        for (const auto k : keys)
+            map.try_emplace(k, k);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// 一半的查找命中，一半不命中
+template<typename Map> void FindU64(benchmark::State& state)
+{
+    const auto keys   = RandomKeys(size(state.range(0)), 1);
+    const auto misses = RandomKeys(size(state.range(0)), 2);
+
+    Map map;
+    for (const auto k : keys)
+        map.try_emplace(k, k);
+
+    for (auto _ : state) {
+        u64 sum = 0;
+        for (size i = 0; i < keys.size(); ++i) {
+            const auto& k = (i & 1) ? misses[i] : keys[i];
+            if (auto it = map.find(k); it != map.end())
+                sum += it->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Map> void FindString(benchmark::State& state)
+{
+    const auto keys = StringKeys(size(state.range(0)));
+
+    Map map;
+    for (size i = 0; i < keys.size(); ++i)
+        map.try_emplace(keys[i], i);
+
+    for (auto _ : state) {
+        size sum = 0;
+        for (const auto& k : keys)
+            sum += map.find(k)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(InsertU64<HashMap<u64, u64>>)->Range(1 << 10, 1 << 20);
+BENCHMARK(InsertU64<std::unordered_map<u64, u64>>)->Range(1 << 10, 1 << 20);
+BENCHMARK(FindU64<HashMap<u64, u64>>)->Range(1 << 10, 1 << 20);
+BENCHMARK(FindU64<std::unordered_map<u64, u64>>)->Range(1 << 10, 1 << 20);
+BENCHMARK(FindString<HashMap<std::string, size>>)->Range(1 << 10, 1 << 18);
+BENCHMARK(FindString<std::unordered_map<std::string, size>>)->Range(1 << 10, 1 << 18);
+
+BENCHMARK_MAIN();
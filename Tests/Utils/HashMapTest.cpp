@@ -0,0 +1,260 @@
+/**
+ * @File HashMapTest.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Nova/Math/Random.hpp>
+#include <Nova/Utils/HashMap.hpp>
+
+using namespace nova;
+
+TEST(HashMapTest, MatchesUnorderedMap)
+{
+    HashMap<u64, i32> map;
+    std::unordered_map<u64, i32> reference;
+
+    // 键的范围较小，插入与删除频繁命中同一个键，会留下大量墓碑并触发原地重建
+    PCG32 rng(3);
+    for (i32 i = 0; i < 200'000; ++i) {
+        const u64 key = rng.gen(5000u);
+        switch (rng.gen(4u)) {
+        case 0 :
+        case 1 : {
+            const auto [it, inserted] = map.try_emplace(key, i);
+            EXPECT_EQ(inserted, reference.try_emplace(key, i).second);
+            EXPECT_EQ(it->second, reference[key]);
+            break;
+        }
+        case 2 : EXPECT_EQ(map.erase(key), reference.erase(key)); break;
+        default : {
+            const auto it = map.find(key);
+            if (reference.contains(key)) {
+                ASSERT_NE(it, map.end());
+                EXPECT_EQ(it->second, reference[key]);
+            }
+            else {
+                EXPECT_EQ(it, map.end());
+            }
+        }
+        }
+    }
+
+    EXPECT_EQ(map.size(), reference.size());
+    EXPECT_LE(map.size(), map.capacity());
+
+    size visited = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(value, reference.at(key));
+        ++visited;
+    }
+    EXPECT_EQ(visited, reference.size());
+
+    // 边遍历边删除
+    for (auto it = map.begin(); it != map.end();)
+        it = it->first % 2 == 0 ? map.erase(it) : std::next(it);
+    for (const auto& [key, value] : map)
+        EXPECT_EQ(key % 2, 1u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+namespace {
+
+/// 所有键都从第一组开始探测，用来构造满的组与墓碑
+struct CollidingHash
+{
+    size operator()(u64 key) const { return key & 0x7F; }
+};
+
+} // namespace
+
+TEST(HashMapTest, TombstoneReuse)
+{
+    HashMap<u64, u64, CollidingHash> map;
+    map.reserve(64);
+    const auto capacity = map.capacity();
+
+    // 前 16 个键占满第一组，其余的沿探测序列落到后面的组
+    for (u64 k = 0; k < 40; ++k)
+        map.try_emplace(k, k);
+
+    // 满组中删除的槽成为墓碑，探测不能在此停止
+    for (u64 k = 0; k < 8; ++k)
+        EXPECT_EQ(map.erase(k), 1u);
+    for (u64 k = 0; k < 40; ++k)
+        EXPECT_EQ(map.contains(k), k >= 8) << k;
+
+    // 新键复用墓碑，不扩容
+    for (u64 k = 100; k < 108; ++k)
+        EXPECT_TRUE(map.try_emplace(k, k).second);
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.size(), 40u);
+    for (u64 k = 8; k < 40; ++k)
+        EXPECT_EQ(map.at(k), k);
+    for (u64 k = 100; k < 108; ++k)
+        EXPECT_EQ(map.at(k), k);
+
+    // 删除后立即插入同一个键
+    EXPECT_EQ(map.erase(20), 1u);
+    EXPECT_TRUE(map.try_emplace(20, 7).second);
+    EXPECT_EQ(map.at(20), 7u);
+    EXPECT_EQ(map.capacity(), capacity);
+}
+
+TEST(HashMapTest, ChurnKeepsCapacity)
+{
+    HashMap<u64, u64> map;
+    map.reserve(1000);
+    const auto capacity = map.capacity();
+
+    // 元素数量保持在最大负载的一半以下，反复删除与插入只会复用墓碑或原地重建，容量不变
+    std::vector<u64> live;
+    for (u64 k = 0; k < 800; ++k) {
+        map.try_emplace(k, k);
+        live.push_back(k);
+    }
+
+    PCG32 rng(17);
+    u64 next = live.size();
+    for (i32 round = 0; round < 200; ++round) {
+        for (i32 i = 0; i < 100; ++i) {
+            const auto j = rng.gen(u32(live.size()));
+            ASSERT_EQ(map.erase(live[j]), 1u);
+            live[j] = next;
+            map.try_emplace(next, next);
+            ++next;
+        }
+        ASSERT_EQ(map.capacity(), capacity);
+        ASSERT_EQ(map.size(), live.size());
+    }
+
+    for (const auto k : live) {
+        const auto it = map.find(k);
+        ASSERT_NE(it, map.end());
+        EXPECT_EQ(it->second, k);
+    }
+}
+
+TEST(HashMapTest, RehashOnGrowth)
+{
+    HashMap<u64, u64> map;
+    EXPECT_EQ(map.capacity(), 0u);
+
+    // 键的低位全相同，只有好的哈希函数才能把它们分散到不同的组
+    size growths      = 0;
+    size lastCapacity = 0;
+    for (u64 i = 0; i < 100'000; ++i) {
+        map.try_emplace(i << 20, i);
+
+        if (map.capacity() != lastCapacity) {
+            ++growths;
+            EXPECT_EQ(std::popcount(map.capacity()), 1);
+            EXPECT_GT(map.capacity(), lastCapacity);
+            lastCapacity = map.capacity();
+
+            // 每次扩容后所有已插入的键仍可找到
+            for (u64 k = 0; k <= i; ++k)
+                ASSERT_EQ(map.at(k << 20), k);
+        }
+
+        // 负载因子不超过 7/8
+        ASSERT_LE(map.size() * 8, map.capacity() * 7);
+    }
+    EXPECT_EQ(map.size(), 100'000u);
+    EXPECT_GT(growths, 10u);
+}
+
+TEST(HashMapTest, IterateAfterErase)
+{
+    HashMap<i32, i32> map;
+    for (i32 i = 0; i < 1000; ++i)
+        map.try_emplace(i, -i);
+
+    for (i32 i = 0; i < 1000; i += 3)
+        EXPECT_EQ(map.erase(i), 1u);
+
+    std::vector<i32> keys;
+    for (const auto& [key, value] : map) {
+        EXPECT_NE(key % 3, 0);
+        EXPECT_EQ(value, -key);
+        keys.push_back(key);
+    }
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(keys.size(), map.size());
+    EXPECT_EQ(std::adjacent_find(keys.begin(), keys.end()), keys.end());
+
+    // 删除全部元素后容量保留，但遍历为空
+    for (i32 i = 0; i < 1000; ++i)
+        map.erase(i);
+    EXPECT_TRUE(map.empty());
+    EXPECT_GT(map.capacity(), 0u);
+    EXPECT_EQ(map.begin(), map.end());
+
+    const auto& cmap = map;
+    EXPECT_EQ(cmap.begin(), cmap.end());
+}
+
+TEST(HashMapTest, StringKeys)
+{
+    HashMap<std::string, std::unique_ptr<i32>> map;
+    for (i32 i = 0; i < 1000; ++i)
+        map.emplace("key" + std::to_string(i), std::make_unique<i32>(i));
+
+    // 不构造 std::string 的查找
+    const std::string_view view = "key42";
+    EXPECT_TRUE(map.contains(view));
+    EXPECT_TRUE(map.contains("key999"));
+    EXPECT_FALSE(map.contains("key1000"));
+    EXPECT_EQ(*map.at(view), 42);
+
+    EXPECT_EQ(map.erase("key7"), 1u);
+    EXPECT_FALSE(map.contains("key7"));
+
+    map["key7"] = std::make_unique<i32>(-7);
+    EXPECT_EQ(*map.at("key7"), -7);
+    EXPECT_EQ(map.size(), 1000u);
+
+    // 复制与移动
+    HashMap<std::string, i32> counts = {{"a", 1}, {"b", 2}};
+    auto copy                        = counts;
+    copy.insert_or_assign("a", 10);
+    EXPECT_EQ(counts.at("a"), 1);
+    EXPECT_EQ(copy.at("a"), 10);
+
+    auto moved = std::move(copy);
+    EXPECT_EQ(moved.size(), 2u);
+    EXPECT_TRUE(copy.empty());
+}
+
+TEST(HashSetTest, Basic)
+{
+    HashSet<i32> set = {1, 2, 3};
+    EXPECT_FALSE(set.insert(2).second);
+    EXPECT_TRUE(set.insert(-5).second);
+    EXPECT_TRUE(set.contains(-5));
+    EXPECT_EQ(set.size(), 4u);
+
+    set.reserve(10'000);
+    const auto capacity = set.capacity();
+    for (i32 i = 0; i < 10'000; ++i)
+        set.insert(i);
+    EXPECT_EQ(set.capacity(), capacity);
+    EXPECT_EQ(set.size(), 10'001u);
+
+    HashSet<std::string> names;
+    names.emplace(3, 'x');
+    EXPECT_TRUE(names.contains("xxx"));
+}
@@ -0,0 +1,120 @@
+/**
+ * @File SketchTest.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Nova/Math/Parallel/Sketch.hpp>
+#include <Nova/Math/Random.hpp>
+#include <Nova/Utils/Sketch.hpp>
+
+using namespace nova;
+
+TEST(BloomFilterTest, FalsePositiveRate)
+{
+    constexpr size kCount = 100'000;
+
+    std::vector<u64> keys(kCount);
+    for (size i = 0; i < kCount; ++i)
+        keys[i] = i * 2;
+
+    BloomFilter<u64> filter(kCount, 0.01);
+    ParallelInsert(filter, keys);
+
+    // 并行插入后不会漏报，串行与并行查询的结果相同
+    const auto found = std::make_unique<bool[]>(kCount);
+    ParallelContains(filter, keys, std::span(found.get(), kCount));
+    for (size i = 0; i < kCount; ++i)
+        ASSERT_TRUE(found[i]) << i;
+
+    std::fill_n(found.get(), kCount, false);
+    filter.contains(keys, std::span(found.get(), kCount));
+    for (size i = 0; i < kCount; ++i)
+        ASSERT_TRUE(found[i]) << i;
+
+    size falsePositives = 0;
+    for (size i = 0; i < 1'000'000; ++i)
+        falsePositives += filter.contains(i * 2 + 1);
+
+    const auto rate = f64(falsePositives) / 1e6;
+    EXPECT_LT(rate, 0.013);
+    EXPECT_NEAR(rate, filter.falsePositiveRate(kCount), 0.003);
+
+    filter.clear();
+    EXPECT_FALSE(filter.contains(keys[0]));
+}
+
+TEST(BloomFilterTest, StringKeys)
+{
+    BloomFilter<std::string> filter(1000, 0.001);
+    for (i32 i = 0; i < 1000; ++i)
+        filter.insert("Assets/Mesh_" + std::to_string(i) + ".obj");
+
+    EXPECT_TRUE(filter.contains("Assets/Mesh_42.obj"));
+
+    i32 falsePositives = 0;
+    for (i32 i = 0; i < 10'000; ++i)
+        falsePositives += filter.contains("Assets/Texture_" + std::to_string(i) + ".png");
+    EXPECT_LT(falsePositives, 30);
+}
+
+TEST(CountMinSketchTest, Estimate)
+{
+    CountMinSketch<u32> sketch(1e-3, 1e-3);
+    EXPECT_EQ(sketch.depth(), 7u);
+
+    // 长尾分布：少数较小的键占据大部分计数
+    constexpr u32 kKeys = 20'000;
+    std::vector<u32> counts(kKeys);
+    PCG32 rng(11);
+    for (i32 i = 0; i < 500'000; ++i) {
+        const auto u   = rng.gen<f32>();
+        const auto key = u32(f32(kKeys) * u * u * u * u);
+        ++counts[key];
+        sketch.add(key);
+    }
+    EXPECT_EQ(sketch.total(), 500'000u);
+
+    const auto bound = u32(1e-3 * f64(sketch.total()));
+    u32 exceeded     = 0;
+    for (u32 k = 0; k < kKeys; ++k) {
+        const auto estimate = sketch.estimate(k);
+        ASSERT_GE(estimate, counts[k]);
+        exceeded += estimate > counts[k] + bound;
+    }
+    EXPECT_LE(exceeded, kKeys / 100);
+
+    const auto before = sketch.estimate(0);
+    sketch.halve();
+    EXPECT_EQ(sketch.estimate(0), before / 2);
+    EXPECT_EQ(sketch.total(), 250'000u);
+}
+
+TEST(CountMinSketchTest, Saturation)
+{
+    CountMinSketch<u32> sketch(1e-2, 1e-2);
+    sketch.add(7, u32_max - 10);
+    EXPECT_EQ(sketch.estimate(7), u32_max - 10);
+
+    // 计数器到达最大值后保持不变，不会回绕成很小的值
+    sketch.add(7, 100);
+    EXPECT_EQ(sketch.estimate(7), u32_max);
+
+    ParallelFor(0, 100'000, 1000, [&](size first, size last) {
+        for (auto i = first; i < last; ++i)
+            sketch.add(7);
+    });
+    EXPECT_EQ(sketch.estimate(7), u32_max);
+    EXPECT_EQ(sketch.total(), u64(u32_max) - 10 + 100 + 100'000);
+
+    sketch.halve();
+    EXPECT_EQ(sketch.estimate(7), u32_max / 2);
+}
@@ -0,0 +1,69 @@
+/**
+ * @File StringTableTest.cpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Date 2026/10/19
+ * @Brief This file is part of Nova.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Nova/Utils/StringTable.hpp>
+
+using namespace nova;
+using namespace nova::literals;
+
+TEST(StringTableTest, HashString)
+{
+    // 编译期与运行期的结果相同
+    constexpr auto kShort = HashString("abc");
+    constexpr auto kLong  = HashString("Assets/Textures/Terrain/Rock_Albedo_4096x4096.png");
+    static_assert(kShort != kLong);
+
+    const std::string s = "Assets/Textures/Terrain/Rock_Albedo_4096x4096.png";
+    EXPECT_EQ(kShort, wyHash("abc", 3));
+    EXPECT_EQ(kLong, wyHash(s.data(), s.size()));
+    for (size n = 0; n <= s.size(); ++n)
+        EXPECT_EQ(HashString(std::string_view(s).substr(0, n)), wyHash(s.data(), n));
+
+    static_assert("Albedo"_sid == StringId("Albedo"));
+    static_assert("Albedo"_sid.value() == HashString("Albedo"));
+}
+
+TEST(StringTableTest, Intern)
+{
+    auto& table = StringTable::inst();
+
+    std::string name = "Textures/Grass";
+    const auto id    = Intern(name);
+    EXPECT_EQ(id, "Textures/Grass"_sid);
+
+    // 原字符串释放后仍能取回
+    name.assign(name.size(), 'x');
+    EXPECT_EQ(id.str(), "Textures/Grass");
+    EXPECT_EQ("Textures/Unknown"_sid.str(), "");
+
+    const auto count = table.count();
+    EXPECT_EQ(Intern("Textures/Grass"), id);
+    EXPECT_EQ(table.count(), count);
+
+    // 多个线程同时注册相同与不同的字符串
+    std::vector<std::thread> threads;
+    for (i32 t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (i32 i = 0; i < 1000; ++i)
+                Intern("Mesh_" + std::to_string(i));
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    EXPECT_EQ(table.count(), count + 1000);
+    EXPECT_EQ(StringId("Mesh_123").str(), "Mesh_123");
+
+    const std::string large(100'000, 'a');
+    EXPECT_EQ(Intern(large).str(), large);
+}